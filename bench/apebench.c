@@ -0,0 +1,139 @@
+/* apebench - decodes streams through components/ape and reports speed and
+ * whether the output is lossless.
+ *
+ *   apebench [-n rounds] [file.ape ...]
+ *
+ * without files the synthetic corpus from apegen.c is decoded and every
+ * sample compared with the pcm it was encoded from, a mismatch fails the
+ * run. files are only timed. cyc/blk is host cycles per block (sample pair),
+ * the player has 5442 per block at 44.1 kHz on a 240 MHz core, see apedec.h.
+ * the stream is fetched in READER_BUF_SIZE pieces like file_reader.c hands
+ * them out on the player */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "apedec.h"
+#include "apegen.h"
+#include "gen.h"
+#include "bench.h"
+
+#define FETCH_SIZE (16 * 512)
+
+typedef struct {
+  const uint8_t *data;
+  size_t len, pos;
+} memStream_t;
+
+typedef struct {
+  uint32_t chunks, errors;
+  uint64_t samples, mismatches;
+} apeResult_t;
+
+static size_t mem_fetch(void *ctx, const uint8_t **data) {
+  memStream_t *m = ctx;
+  size_t n = m->len - m->pos < FETCH_SIZE ? m->len - m->pos : FETCH_SIZE;
+  *data = m->data + m->pos;
+  m->pos += n;
+  return n;
+}
+
+/* ref is the interleaved source pcm or NULL */
+static int decode(const uint8_t *data, size_t len, const int32_t *ref, size_t refSamples,
+                  apeResult_t *res, apeInfo_t *info) {
+  memStream_t m = {data, len, 0};
+  memset(res, 0, sizeof(apeResult_t));
+  apeDecoder_t *d = ape_open(mem_fetch, &m);
+  if(d == NULL) return -1;
+  *info = d->info;
+  while(1) {
+    int n = ape_decode(d);
+    if(n == 0 || n == APE_ERR_END) break;
+    if(n < 0) {
+      res->errors++;
+      continue;
+    }
+    if(ref != NULL) {
+      int chans = d->info.channels;
+      for(int i = 0; i < n; ++i) {
+        for(int ch = 0; ch < chans; ++ch) {
+          size_t at = d->blockPos + i;
+          if(at >= refSamples || d->decoded[ch][i] != ref[at * chans + ch]) {
+            if(res->mismatches++ == 0)
+              printf("  block %zu ch %d: %d, expected %d\n", at, ch, d->decoded[ch][i],
+                     at < refSamples ? ref[at * chans + ch] : 0);
+          }
+        }
+      }
+    }
+    res->chunks++;
+    res->samples += n;
+  }
+  ape_close(d);
+  return 0;
+}
+
+static int bench(const char *name, const uint8_t *data, size_t len, const int32_t *ref,
+                 size_t refSamples, int rounds) {
+  apeResult_t res = {0};
+  apeInfo_t info = {0};
+  double best = 1e30;
+  uint64_t bestCycles = UINT64_MAX;
+  int fail = 0;
+  for(int r = 0; r < rounds; ++r) {
+    double t = bench_seconds();
+    uint64_t c = bench_cycles();
+    if(decode(data, len, r == 0 ? ref : NULL, refSamples, &res, &info) != 0) {
+      printf("%-24s not a supported ape stream\n", name);
+      return 1;
+    }
+    c = bench_cycles() - c;
+    t = bench_seconds() - t;
+    if(t < best) best = t;
+    if(c < bestCycles) bestCycles = c;
+    if(r == 0 && ref != NULL)
+      fail = res.mismatches != 0 || res.samples != refSamples || res.errors != 0;
+  }
+  double audio = (double)res.samples / info.sampleRate;
+  printf("%-24s %4u %4u %2d/%-6u %7.0f %7.1f %7.2f  %s\n", name, info.compression,
+         res.errors, info.bitsPerSample, info.sampleRate,
+         res.samples ? (double)bestCycles / res.samples : 0.0, audio / best, len / best / 1e6,
+         ref == NULL ? "-" : (fail ? "FAIL" : "lossless"));
+  return fail;
+}
+
+int main(int argc, char **argv) {
+  int opt, rounds = 5, ret = 0;
+  while((opt = getopt(argc, argv, "n:")) != -1) {
+    if(opt == 'n') rounds = atoi(optarg) > 0 ? atoi(optarg) : 1;
+    else {
+      fprintf(stderr, "usage: %s [-n rounds] [file.ape ...]\n", argv[0]);
+      return 2;
+    }
+  }
+  printf("%-24s %4s %4s %9s %7s %7s %7s\n", "stream", "lvl", "errs", "bits/rate",
+         "cyc/blk", "xRT", "MB/s");
+  if(optind == argc) {
+    for(const apeGenCase_t *c = apeGenCorpus; c->name != NULL; ++c) {
+      apeGenStream_t s;
+      if(apegen_stream(c, &s) != 0) return 1;
+      ret |= bench(c->name, s.data, s.len, s.pcm, s.samples, rounds);
+      apegen_free(&s);
+    }
+    return ret != 0;
+  }
+  for(int i = optind; i < argc; ++i) {
+    size_t len;
+    uint8_t *buf = load_file(argv[i], &len);
+    if(buf == NULL) {
+      fprintf(stderr, "apebench: cannot read %s\n", argv[i]);
+      ret = 1;
+      continue;
+    }
+    ret |= bench(base_name(argv[i]), buf, len, NULL, 0, rounds);
+    free(buf);
+  }
+  return ret != 0;
+}
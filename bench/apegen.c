@@ -0,0 +1,481 @@
+/* apegen - writes the synthetic Monkey's Audio corpus used by apebench.
+ *
+ * there is no encoder on the build hosts, so this is a small one for the 3.99
+ * format. the predictor and NN filter stages are the decoder's adaptive
+ * filters run the other way round, the residuals go through a range coder
+ * with the decoder's overflow model. frames come out silent, pseudo stereo
+ * or plain at random so that every decoder path runs, and the pcm is kept so
+ * the output can be checked sample for sample */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "gen.h"
+#include "apegen.h"
+
+#define CODE_BITS 32
+#define TOP_VALUE (1u << (CODE_BITS - 1))
+#define SHIFT_BITS (CODE_BITS - 9)
+#define BOTTOM_VALUE (TOP_VALUE >> 8)
+
+#define HISTORY_SIZE 512
+#define PREDICTOR_SIZE 50
+#define YDELAYA 50
+#define YDELAYB 42
+#define XDELAYA 34
+#define XDELAYB 26
+#define YADAPTCOEFFSA 18
+#define XADAPTCOEFFSA 14
+#define YADAPTCOEFFSB 10
+#define XADAPTCOEFFSB 5
+
+#define APESIGN(x) (((x) < 0) - ((x) > 0))
+
+typedef struct {
+  uint32_t low, range, help;
+  uint8_t buffer;
+  byteWriter_t *w;
+} rangeEnc_t;
+
+typedef struct {
+  uint32_t k, ksum;
+} rice_t;
+
+typedef struct {
+  int16_t coeffs[256];
+  int16_t history[HISTORY_SIZE + 512];
+  int16_t *delay, *adapt;
+  uint32_t avg;
+} filter_t;
+
+typedef struct {
+  int32_t history[HISTORY_SIZE + PREDICTOR_SIZE];
+  int32_t *buf;
+  int32_t lastA[2], filterA[2], filterB[2];
+  int32_t coeffsA[2][4], coeffsB[2][5];
+} predictor_t;
+
+static const uint32_t counts[22] = {
+  0, 19578, 36160, 48417, 56323, 60899, 63265, 64435, 64971, 65232, 65351,
+  65416, 65447, 65466, 65476, 65482, 65485, 65488, 65490, 65491, 65492, 65493
+};
+static const uint16_t filterOrders[4][2] = {{0, 0}, {16, 0}, {64, 0}, {32, 256}};
+static const uint8_t filterFracBits[4][2] = {{0, 0}, {11, 0}, {11, 0}, {10, 13}};
+
+const apeGenCase_t apeGenCorpus[] = {
+  {"s16_44k_fast", 44100, 2, 16, 1000, 73728, 5},
+  {"s16_44k_normal", 44100, 2, 16, 2000, 73728, 5},
+  {"s16_44k_high", 44100, 2, 16, 3000, 73728, 3},
+  {"s16_44k_extrahigh", 44100, 2, 16, 4000, 294912, 1},
+  {"s16_48k_mono_normal", 48000, 1, 16, 2000, 73728, 3},
+  {"s24_96k_normal", 96000, 2, 24, 2000, 73728, 4},
+  {"s8_22k_mono_fast", 22050, 1, 8, 1000, 73728, 2},
+  {"s16_44k_short_frames", 44100, 2, 16, 2000, 4608, 60},
+  {NULL}
+};
+
+static void put_le(byteWriter_t *w, uint32_t v, int bytes) {
+  for(int i = 0; i < bytes; ++i) put_byte(w, v >> (8 * i));
+}
+
+static void put_be32(byteWriter_t *w, uint32_t v) {
+  for(int i = 3; i >= 0; --i) put_byte(w, v >> (8 * i));
+}
+
+/* ---- range coder ---- */
+
+static void range_shift_out(rangeEnc_t *r) {
+  if(r->low < (0xFFu << SHIFT_BITS)) {
+    put_byte(r->w, r->buffer);
+    for(; r->help; r->help--) put_byte(r->w, 0xFF);
+    r->buffer = r->low >> SHIFT_BITS;
+  } else if(r->low & TOP_VALUE) { //carry
+    put_byte(r->w, r->buffer + 1);
+    for(; r->help; r->help--) put_byte(r->w, 0x00);
+    r->buffer = r->low >> SHIFT_BITS;
+  } else {
+    r->help++;
+  }
+}
+
+static void range_normalize(rangeEnc_t *r) {
+  while(r->range <= BOTTOM_VALUE) {
+    range_shift_out(r);
+    r->range <<= 8;
+    r->low = (r->low << 8) & (TOP_VALUE - 1);
+  }
+}
+
+/* the first byte out is the buffer's initial zero, the decoder skips it */
+static void range_start(rangeEnc_t *r, byteWriter_t *w) {
+  r->low = 0;
+  r->range = TOP_VALUE;
+  r->buffer = 0;
+  r->help = 0;
+  r->w = w;
+}
+
+static void range_encode(rangeEnc_t *r, uint32_t cumFreq, uint32_t freq, uint32_t totFreq) {
+  range_normalize(r);
+  uint32_t step = r->range / totFreq;
+  r->low += step * cumFreq;
+  r->range = step * freq;
+}
+
+static void range_encode_shift(rangeEnc_t *r, uint32_t cumFreq, uint32_t freq, int shift) {
+  range_normalize(r);
+  uint32_t step = r->range >> shift;
+  r->low += step * cumFreq;
+  r->range = step * freq;
+}
+
+/* writes out all of low, the bytes past it are zero */
+static void range_finish(rangeEnc_t *r) {
+  range_normalize(r);
+  for(int i = 0; i < 6; ++i) {
+    range_shift_out(r);
+    r->low = (r->low << 8) & (TOP_VALUE - 1);
+  }
+}
+
+static void update_rice(rice_t *r, uint32_t x) {
+  uint32_t lim = r->k ? 1u << (r->k + 4) : 0;
+  r->ksum += ((x + 1) / 2) - ((r->ksum + 16) >> 5);
+  if(r->ksum < lim) r->k--;
+  else if(r->ksum >= (1u << (r->k + 5)) && r->k < 24) r->k++;
+}
+
+static void put_value(rangeEnc_t *r, rice_t *rice, int32_t v) {
+  uint32_t x = v > 0 ? 2 * (uint32_t)v - 1 : -2 * (uint32_t)v;
+  uint32_t pivot = rice->ksum >> 5;
+  if(pivot == 0) pivot = 1;
+  uint32_t overflow = x / pivot, base = x % pivot;
+  if(overflow < 21) {
+    range_encode_shift(r, counts[overflow], counts[overflow + 1] - counts[overflow], 16);
+  } else if(overflow < 63) {
+    range_encode_shift(r, overflow + 65535 - 63, 1, 16);
+  } else {
+    range_encode_shift(r, 65535, 1, 16);
+    range_encode_shift(r, overflow >> 16, 1, 16);
+    range_encode_shift(r, overflow & 0xFFFF, 1, 16);
+  }
+  if(pivot < 0x10000) {
+    range_encode(r, base, 1, pivot);
+  } else {
+    int bits = 0;
+    while((pivot >> bits) & ~0xFFFFu) bits++;
+    range_encode(r, base >> bits, 1, (pivot >> bits) + 1);
+    range_encode(r, base & ((1u << bits) - 1), 1, 1u << bits);
+  }
+  update_rice(rice, x);
+}
+
+/* ---- inverse NN filter ---- */
+
+static void init_filter(filter_t *f, int order) {
+  memset(f, 0, sizeof(filter_t));
+  f->adapt = f->history + order;
+  f->delay = f->history + 2 * order;
+}
+
+static int16_t clip16(int32_t v) {
+  return v > 32767 ? 32767 : (v < -32768 ? -32768 : v);
+}
+
+/* data holds what the decoder's filter must output, it is replaced by the
+ * input that makes it do so */
+static void unfilter(filter_t *f, int32_t *data, int count, int order, int fracbits) {
+  for(; count > 0; --count, ++data) {
+    const int16_t *hist = f->delay - order, *adapt = f->adapt - order;
+    uint32_t dot = 0;
+    for(int i = 0; i < order; ++i) dot += f->coeffs[i] * hist[i];
+    int32_t pred = ((int64_t)(int32_t)dot + (1 << (fracbits - 1))) >> fracbits;
+    int32_t res = *data, in = (uint32_t)res - (uint32_t)pred;
+    int sign = APESIGN(in);
+    for(int i = 0; i < order; ++i) f->coeffs[i] += sign * adapt[i];
+    *data = in;
+    *f->delay++ = clip16(res);
+    uint32_t absres = res < 0 ? -(uint32_t)res : (uint32_t)res;
+    if(absres)
+      *f->adapt = APESIGN(res) * (8 << ((absres > f->avg * 3ULL) + (absres > f->avg + f->avg / 3)));
+    else
+      *f->adapt = 0;
+    f->avg += (int32_t)(absres - f->avg) / 16;
+    f->adapt[-1] >>= 1;
+    f->adapt[-2] >>= 1;
+    f->adapt[-8] >>= 1;
+    f->adapt++;
+    if(f->delay == f->history + HISTORY_SIZE + 2 * order) {
+      memmove(f->history, f->delay - 2 * order, 2 * order * sizeof(int16_t));
+      f->adapt = f->history + order;
+      f->delay = f->history + 2 * order;
+    }
+  }
+}
+
+/* ---- inverse predictor ---- */
+
+static void init_predictor(predictor_t *p) {
+  static const int32_t initialA[4] = {360, 317, -109, 98};
+  memset(p, 0, sizeof(predictor_t));
+  p->buf = p->history;
+  memcpy(p->coeffsA[0], initialA, sizeof(initialA));
+  memcpy(p->coeffsA[1], initialA, sizeof(initialA));
+}
+
+static void predictor_advance(predictor_t *p) {
+  if(++p->buf == p->history + HISTORY_SIZE) {
+    memmove(p->history, p->buf, PREDICTOR_SIZE * sizeof(int32_t));
+    p->buf = p->history;
+  }
+}
+
+/* returns the residual that makes the decoder's filterA come out as target */
+static int32_t unpredict(predictor_t *p, int32_t target, int filter, int delayA, int delayB,
+                         int adaptA, int adaptB) {
+  int32_t *b = p->buf, *cA = p->coeffsA[filter], *cB = p->coeffsB[filter];
+  b[delayA] = p->lastA[filter];
+  b[adaptA] = APESIGN(b[delayA]);
+  b[delayA - 1] = (uint32_t)b[delayA] - (uint32_t)b[delayA - 1];
+  b[adaptA - 1] = APESIGN(b[delayA - 1]);
+  int32_t predA = (uint32_t)b[delayA] * cA[0] + (uint32_t)b[delayA - 1] * cA[1]
+                  + (uint32_t)b[delayA - 2] * cA[2] + (uint32_t)b[delayA - 3] * cA[3];
+  b[delayB] = (uint32_t)p->filterA[filter ^ 1] - ((int32_t)(p->filterB[filter] * 31u) >> 5);
+  b[adaptB] = APESIGN(b[delayB]);
+  b[delayB - 1] = (uint32_t)b[delayB] - (uint32_t)b[delayB - 1];
+  b[adaptB - 1] = APESIGN(b[delayB - 1]);
+  p->filterB[filter] = p->filterA[filter ^ 1];
+  int32_t predB = (uint32_t)b[delayB] * cB[0] + (uint32_t)b[delayB - 1] * cB[1]
+                  + (uint32_t)b[delayB - 2] * cB[2] + (uint32_t)b[delayB - 3] * cB[3]
+                  + (uint32_t)b[delayB - 4] * cB[4];
+
+  int32_t lastA = (uint32_t)target - ((int32_t)(p->filterA[filter] * 31u) >> 5);
+  int32_t res = (uint32_t)lastA - (uint32_t)((int32_t)((uint32_t)predA + (predB >> 1)) >> 10);
+  p->lastA[filter] = lastA;
+  p->filterA[filter] = target;
+
+  int sign = APESIGN(res);
+  for(int i = 0; i < 4; ++i) cA[i] += b[adaptA - i] * sign;
+  for(int i = 0; i < 5; ++i) cB[i] += b[adaptB - i] * sign;
+  return res;
+}
+
+static void unpredict_mono(predictor_t *p, int32_t *s, int count) {
+  int32_t *cA = p->coeffsA[0];
+  for(int i = 0; i < count; ++i) {
+    int32_t *b = p->buf;
+    b[YDELAYA] = p->lastA[0];
+    b[YDELAYA - 1] = (uint32_t)b[YDELAYA] - (uint32_t)b[YDELAYA - 1];
+    int32_t predA = (uint32_t)b[YDELAYA] * cA[0] + (uint32_t)b[YDELAYA - 1] * cA[1]
+                    + (uint32_t)b[YDELAYA - 2] * cA[2] + (uint32_t)b[YDELAYA - 3] * cA[3];
+    int32_t current = (uint32_t)s[i] - ((int32_t)(p->filterA[0] * 31u) >> 5);
+    int32_t a = (uint32_t)current - (uint32_t)(predA >> 10);
+    b[YADAPTCOEFFSA] = APESIGN(b[YDELAYA]);
+    b[YADAPTCOEFFSA - 1] = APESIGN(b[YDELAYA - 1]);
+    int sign = APESIGN(a);
+    for(int j = 0; j < 4; ++j) cA[j] += b[YADAPTCOEFFSA - j] * sign;
+    predictor_advance(p);
+    p->filterA[0] = s[i];
+    p->lastA[0] = current;
+    s[i] = a;
+  }
+}
+
+/* ---- frames ---- */
+
+/* band limited noise with a spike now and then for the escape codes */
+static void gen_signal(int32_t *x, int n, int bits, int32_t *state) {
+  int32_t peak = (1 << (bits - 1)) - 1, step = 1 << (bits > 10 ? bits - 7 : 3);
+  for(int i = 0; i < n; ++i) {
+    if(gen_rnd(3000) == 0) {
+      x[i] = gen_rnd(2) ? peak : -peak;
+      continue;
+    }
+    *state += (int32_t)gen_rnd(2 * step + 1) - step;
+    *state -= *state / 64;
+    if(*state > peak) *state = peak;
+    if(*state < -peak) *state = -peak;
+    x[i] = *state;
+  }
+}
+
+/* x holds the decoder's channel outputs before decorrelation */
+static void put_frame(byteWriter_t *w, const apeGenCase_t *c, int32_t *x[2], int n, int chans,
+                      uint32_t flags) {
+  int fset = c->compression / 1000 - 1;
+  uint32_t crc = gen_rnd(0) & 0x7FFFFFFF;
+  if(flags || gen_rnd(2)) {
+    put_be32(w, crc | 0x80000000);
+    put_be32(w, flags);
+  } else {
+    put_be32(w, crc);
+  }
+  rangeEnc_t r;
+  range_start(&r, w);
+  bool silent = chans == 1 ? (flags & 3) != 0 : (flags & 3) == 3;
+  if(!silent) {
+    predictor_t p;
+    init_predictor(&p);
+    if(chans == 1) {
+      unpredict_mono(&p, x[0], n);
+    } else {
+      for(int i = 0; i < n; ++i) {
+        x[0][i] = unpredict(&p, x[0][i], 0, YDELAYA, YDELAYB, YADAPTCOEFFSA, YADAPTCOEFFSB);
+        x[1][i] = unpredict(&p, x[1][i], 1, XDELAYA, XDELAYB, XADAPTCOEFFSA, XADAPTCOEFFSB);
+        predictor_advance(&p);
+      }
+    }
+    //the decoder runs the levels first to last, so undo them last to first
+    for(int lvl = 1; lvl >= 0; --lvl) {
+      if(filterOrders[fset][lvl] == 0) continue;
+      for(int ch = 0; ch < chans; ++ch) {
+        static filter_t f;
+        init_filter(&f, filterOrders[fset][lvl]);
+        unfilter(&f, x[ch], n, filterOrders[fset][lvl], filterFracBits[fset][lvl]);
+      }
+    }
+    rice_t riceX = {10, 16 << 10}, riceY = {10, 16 << 10};
+    for(int i = 0; i < n; ++i) {
+      put_value(&r, &riceY, x[0][i]);
+      if(chans == 2) put_value(&r, &riceX, x[1][i]);
+    }
+  }
+  range_finish(&r);
+}
+
+/* 0 on success */
+int apegen_stream(const apeGenCase_t *c, apeGenStream_t *s) {
+  int bpf = c->blocksPerFrame, chans = c->channels;
+  uint32_t finalBlocks;
+  byteWriter_t frames = {0};
+  uint32_t *offsets = malloc(c->frames * sizeof(uint32_t));
+  int32_t *x[2] = {malloc(bpf * sizeof(int32_t)), malloc(bpf * sizeof(int32_t))};
+  int32_t state[2] = {0, 0};
+  memset(s, 0, sizeof(apeGenStream_t));
+  gen_seed(c->name);
+  finalBlocks = c->frames > 1 ? 1 + gen_rnd(bpf) : bpf;
+  s->samples = (size_t)(c->frames - 1) * bpf + finalBlocks;
+  s->pcm = malloc(s->samples * chans * sizeof(int32_t));
+  if(offsets == NULL || x[0] == NULL || x[1] == NULL || s->pcm == NULL) {
+    free(offsets);
+    free(x[0]);
+    free(x[1]);
+    apegen_free(s);
+    return -1;
+  }
+
+  int32_t *pcm = s->pcm;
+  for(int f = 0; f < c->frames; ++f) {
+    int n = f == c->frames - 1 ? (int)finalBlocks : bpf;
+    int mode = gen_rnd(8); //0 silent, 1 pseudo stereo
+    uint32_t flags = 0;
+    int coded = chans;
+    for(int ch = 0; ch < chans; ++ch) {
+      if(mode == 0) memset(x[ch], 0, n * sizeof(int32_t));
+      else if(mode == 1 && ch == 1) memcpy(x[1], x[0], n * sizeof(int32_t));
+      else gen_signal(x[ch], n, c->bits, &state[ch]);
+      for(int i = 0; i < n; ++i) pcm[i * chans + ch] = x[ch][i];
+    }
+    if(mode == 0) {
+      flags = chans == 2 ? 3 : 1;
+    } else if(mode == 1 && chans == 2) {
+      flags = 4;
+      coded = 1;
+    } else if(chans == 2) {
+      for(int i = 0; i < n; ++i) { //left, right to X, Y
+        int32_t y = x[1][i] - x[0][i];
+        x[1][i] = x[0][i] + y / 2;
+        x[0][i] = y;
+      }
+    }
+    offsets[f] = frames.len;
+    put_frame(&frames, c, x, n, coded, flags);
+    pcm += n * chans;
+  }
+  free(x[0]);
+  free(x[1]);
+
+  uint32_t seekBytes = c->frames * 4, wavBytes = 44;
+  uint32_t frameBytes = (frames.len + 3) & ~3u;
+  uint32_t first = 52 + 24 + seekBytes + wavBytes;
+  byteWriter_t w = {0};
+  put_byte(&w, 'M');
+  put_byte(&w, 'A');
+  put_byte(&w, 'C');
+  put_byte(&w, ' ');
+  put_le(&w, 3990, 2);
+  put_le(&w, 0, 2);
+  put_le(&w, 52, 4);
+  put_le(&w, 24, 4);
+  put_le(&w, seekBytes, 4);
+  put_le(&w, wavBytes, 4);
+  put_le(&w, frameBytes, 4);
+  put_le(&w, 0, 4);
+  put_le(&w, 0, 4);
+  for(int i = 0; i < 16; ++i) put_byte(&w, 0); //md5 not computed
+  put_le(&w, c->compression, 2);
+  put_le(&w, 0, 2);
+  put_le(&w, bpf, 4);
+  put_le(&w, finalBlocks, 4);
+  put_le(&w, c->frames, 4);
+  put_le(&w, c->bits, 2);
+  put_le(&w, chans, 2);
+  put_le(&w, c->sampleRate, 4);
+  for(int f = 0; f < c->frames; ++f) put_le(&w, first + offsets[f], 4);
+  for(uint32_t i = 0; i < wavBytes; ++i) put_byte(&w, 0);
+  //the frame data is written as little endian 32-bit words
+  while(frames.len & 3) put_byte(&frames, 0);
+  for(size_t i = 0; i < frames.len; i += 4)
+    for(int k = 3; k >= 0; --k) put_byte(&w, frames.buf[i + k]);
+  free(frames.buf);
+  free(offsets);
+
+  //APEv2 footer with the title, the player lists files by it
+  static const char key[] = "Title";
+  size_t titleLen = strlen(c->name);
+  uint32_t tagBytes = 8 + sizeof(key) + titleLen + 32;
+  put_le(&w, titleLen, 4);
+  put_le(&w, 0, 4);
+  for(size_t i = 0; i < sizeof(key); ++i) put_byte(&w, key[i]);
+  for(size_t i = 0; i < titleLen; ++i) put_byte(&w, c->name[i]);
+  const char *id = "APETAGEX";
+  while(*id) put_byte(&w, *id++);
+  put_le(&w, 2000, 4);
+  put_le(&w, tagBytes, 4);
+  put_le(&w, 1, 4);
+  put_le(&w, 0, 4);
+  put_le(&w, 0, 4);
+  put_le(&w, 0, 4);
+  s->data = w.buf;
+  s->len = w.len;
+  return 0;
+}
+
+void apegen_free(apeGenStream_t *s) {
+  free(s->data);
+  free(s->pcm);
+  memset(s, 0, sizeof(apeGenStream_t));
+}
+
+#ifdef APEGEN_MAIN
+int main(int argc, char **argv) {
+  const char *dir = argc > 1 ? argv[1] : ".";
+  char path[512];
+  for(const apeGenCase_t *c = apeGenCorpus; c->name != NULL; ++c) {
+    apeGenStream_t s;
+    if(apegen_stream(c, &s) != 0) return 1;
+    snprintf(path, sizeof(path), "%s/%s.ape", dir, c->name);
+    FILE *f = fopen(path, "wb");
+    if(f == NULL || fwrite(s.data, 1, s.len, f) != s.len) {
+      fprintf(stderr, "apegen: cannot write %s\n", path);
+      return 1;
+    }
+    fclose(f);
+    printf("%s %zu bytes\n", path, s.len);
+    apegen_free(&s);
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,29 @@
+#ifndef _APEGEN_H_
+#define _APEGEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  const char *name;
+  int sampleRate;
+  int channels;
+  int bits;
+  int compression; //1000 Fast .. 4000 Extra High
+  int blocksPerFrame;
+  int frames;
+} apeGenCase_t;
+
+/* a stream and the pcm it decodes to, samples interleaved */
+typedef struct {
+  uint8_t *data;
+  size_t len;
+  int32_t *pcm;
+  size_t samples; //per channel
+} apeGenStream_t;
+
+extern const apeGenCase_t apeGenCorpus[];
+
+int apegen_stream(const apeGenCase_t *c, apeGenStream_t *s);
+void apegen_free(apeGenStream_t *s);
+#endif
@@ -0,0 +1,192 @@
+/* blitbench - pixels per second of main/jpeg_blit.c against packing the
+ * picojpeg MCU buffers one pixel at a time, the way the UI used to.
+ *
+ *   blitbench [-n rounds]
+ *
+ * the MCU buffers are filled with noise for every scan type, full and
+ * reduced, and blitted into strided destinations that crop the image or
+ * reach past its edges. the result has to match the pixel at a time
+ * reference exactly, including the pixels around the destination rectangle
+ * that must not be touched */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "jpeg_blit.h"
+#include "bench.h"
+
+#define IMG_W 500
+#define IMG_H 500
+#define ROUND_SECONDS 0.05
+#define GUARD 0x5A5A
+
+static const struct {
+  const char *name;
+  pjpeg_scan_type_t type;
+  int w, h;
+} scanTypes[] = {
+  {"gray", PJPG_GRAYSCALE, 8, 8},
+  {"h1v1", PJPG_YH1V1, 8, 8},
+  {"h2v1", PJPG_YH2V1, 16, 8},
+  {"h1v2", PJPG_YH1V2, 8, 16},
+  {"h2v2", PJPG_YH2V2, 16, 16},
+};
+
+static const uint8_t bayer[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+static uint8_t bufR[256], bufG[256], bufB[256];
+
+static int clamp255(int v) {
+  return v > 255 ? 255 : v;
+}
+
+static void ref_mcu(const pjpeg_image_info_t *info, int mcuX, int mcuY, const jpegBlit_t *dst) {
+  int s = dst->flags & JPEG_BLIT_REDUCED ? 8 : 1;
+  int mw = info->m_MCUWidth / s, mh = info->m_MCUHeight / s;
+  int imgW = (info->m_width + s - 1) / s, imgH = (info->m_height + s - 1) / s;
+  for(int py = 0; py < mh; ++py) {
+    for(int px = 0; px < mw; ++px) {
+      int x = mcuX * mw + px, y = mcuY * mh + py, dx = x - dst->x0, dy = y - dst->y0;
+      if(x >= imgW || y >= imgH || dx < 0 || dy < 0 || dx >= dst->width || dy >= dst->height) continue;
+      int i = s == 8 ? py * 128 + px * 64 : (py >> 3) * 128 + (px >> 3) * 64 + (py & 7) * 8 + (px & 7);
+      int r = info->m_pMCUBufR[i], g = info->m_pMCUBufG[i], b = info->m_pMCUBufB[i];
+      if(info->m_scanType == PJPG_GRAYSCALE) g = b = r;
+      if(dst->flags & JPEG_BLIT_DITHER) {
+        int d = bayer[dy & 3][dx & 3];
+        r = clamp255(r + d / 2);
+        g = clamp255(g + d / 4);
+        b = clamp255(b + d / 2);
+      }
+      uint16_t c = (r >> 3) << 11 | (g >> 2) << 5 | b >> 3;
+      uint8_t *p = (uint8_t *)&dst->pixels[dy * dst->stride + dx];
+      if(dst->flags & JPEG_BLIT_SWAP) {
+        p[0] = c >> 8;
+        p[1] = c & 0xFF;
+      } else {
+        p[0] = c & 0xFF;
+        p[1] = c >> 8;
+      }
+    }
+  }
+}
+
+static void blit_image(const pjpeg_image_info_t *info, const jpegBlit_t *dst,
+                       void (*blit)(const pjpeg_image_info_t *, int, int, const jpegBlit_t *)) {
+  for(int my = 0; my < info->m_MCUSPerCol; ++my)
+    for(int mx = 0; mx < info->m_MCUSPerRow; ++mx) blit(info, mx, my, dst);
+}
+
+/* best of rounds in seconds per image */
+static double bench(const pjpeg_image_info_t *info, const jpegBlit_t *dst, int rounds,
+                    void (*blit)(const pjpeg_image_info_t *, int, int, const jpegBlit_t *)) {
+  double best = 1e30;
+  for(int r = 0; r < rounds; ++r) {
+    long count = 0;
+    double start = bench_seconds(), t;
+    do {
+      blit_image(info, dst, blit);
+      count++;
+    } while((t = bench_seconds() - start) < ROUND_SECONDS);
+    if(t / count < best) best = t / count;
+  }
+  return best;
+}
+
+/* odd sizes, a crop into the middle of a wider destination, so that every
+ * edge MCU is clipped on some side */
+static int check(pjpeg_image_info_t *info, int flags) {
+  int s = flags & JPEG_BLIT_REDUCED ? 8 : 1;
+  int fail = 0;
+  static const int sizes[][2] = {{203, 157}, {8, 8}, {17, 33}, {IMG_W, IMG_H}};
+  for(size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k) {
+    info->m_width = sizes[k][0];
+    info->m_height = sizes[k][1];
+    info->m_MCUSPerRow = (info->m_width + info->m_MCUWidth - 1) / info->m_MCUWidth;
+    info->m_MCUSPerCol = (info->m_height + info->m_MCUHeight - 1) / info->m_MCUHeight;
+    int w = (info->m_width + s - 1) / s, h = (info->m_height + s - 1) / s, stride = w + 7;
+    //cropped inside the image, then larger than the image
+    jpegBlit_t dsts[2] = {
+      {NULL, stride, w - w / 3, h - h / 4, w / 5, h / 7, flags},
+      {NULL, stride, w + 5, h + 2, 0, 0, flags},
+    };
+    size_t n = (size_t)stride * (h + 4);
+    uint16_t *pa = malloc(n * 2), *pb = malloc(n * 2);
+    for(int d = 0; d < 2; ++d) {
+      jpegBlit_t a = dsts[d], b = dsts[d];
+      for(size_t i = 0; i < n; ++i) pa[i] = pb[i] = GUARD;
+      a.pixels = pa + stride; //a guard row above
+      b.pixels = pb + stride;
+      for(int my = 0; my < info->m_MCUSPerCol; ++my) {
+        for(int mx = 0; mx < info->m_MCUSPerRow; ++mx) {
+          for(int i = 0; i < 256; ++i) {
+            bufR[i] = rand();
+            bufG[i] = rand();
+            bufB[i] = rand();
+          }
+          ref_mcu(info, mx, my, &a);
+          jpeg_blit_mcu(info, mx, my, &b);
+        }
+      }
+      if(memcmp(pa, pb, n * 2) != 0) {
+        for(size_t i = 0; i < n; ++i) {
+          if(pa[i] == pb[i]) continue;
+          printf("  %dx%d flags %d: pixel %zu is %04x, expected %04x\n", info->m_width, info->m_height,
+                 flags, i, pb[i], pa[i]);
+          break;
+        }
+        fail = 1;
+      }
+    }
+    free(pa);
+    free(pb);
+  }
+  return fail;
+}
+
+int main(int argc, char **argv) {
+  int opt, rounds = 5, fail = 0;
+  while((opt = getopt(argc, argv, "n:")) != -1) {
+    if(opt == 'n') rounds = atoi(optarg) > 0 ? atoi(optarg) : 1;
+    else {
+      fprintf(stderr, "usage: %s [-n rounds]\n", argv[0]);
+      return 2;
+    }
+  }
+  static uint16_t pixels[IMG_W * IMG_H];
+  printf("%-6s %-14s %12s %12s %6s\n", "scan", "mode", "ref Mpx/s", "blit Mpx/s", "");
+  for(size_t t = 0; t < sizeof(scanTypes) / sizeof(scanTypes[0]); ++t) {
+    static const struct {
+      const char *name;
+      int flags;
+    } modes[] = {
+      {"native", 0},
+      {"swap", JPEG_BLIT_SWAP},
+      {"swap+dither", JPEG_BLIT_SWAP | JPEG_BLIT_DITHER},
+      {"reduced", JPEG_BLIT_REDUCED | JPEG_BLIT_SWAP},
+    };
+    for(size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); ++m) {
+      pjpeg_image_info_t info;
+      memset(&info, 0, sizeof(info));
+      info.m_scanType = scanTypes[t].type;
+      info.m_comps = scanTypes[t].type == PJPG_GRAYSCALE ? 1 : 3;
+      info.m_MCUWidth = scanTypes[t].w;
+      info.m_MCUHeight = scanTypes[t].h;
+      info.m_pMCUBufR = bufR;
+      info.m_pMCUBufG = bufG;
+      info.m_pMCUBufB = bufB;
+      int bad = check(&info, modes[m].flags);
+      //check() leaves the full size image set up
+      int s = modes[m].flags & JPEG_BLIT_REDUCED ? 8 : 1;
+      jpegBlit_t dst = {pixels, IMG_W / s, IMG_W / s, IMG_H / s, 0, 0, modes[m].flags};
+      double px = (double)(IMG_W / s) * (IMG_H / s);
+      double ref = bench(&info, &dst, rounds, ref_mcu), blit = bench(&info, &dst, rounds, jpeg_blit_mcu);
+      printf("%-6s %-14s %12.1f %12.1f  %s\n", scanTypes[t].name, modes[m].name, px / ref / 1e6,
+             px / blit / 1e6, bad ? "FAIL" : "ok");
+      fail |= bad;
+    }
+  }
+  return fail;
+}
@@ -0,0 +1,132 @@
+/* flacbench - decodes streams through components/flac and reports speed and
+ * whether the output is lossless.
+ *
+ *   flacbench [-n rounds] [file.flac ...]
+ *
+ * without files the synthetic corpus from flacgen.c is decoded and every
+ * sample compared with the pcm it was encoded from, a mismatch fails the
+ * run. files are only timed. the stream is fetched in READER_BUF_SIZE pieces
+ * like file_reader.c hands them out on the player */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "flacdec.h"
+#include "flacgen.h"
+#include "gen.h"
+#include "bench.h"
+
+#define FETCH_SIZE (16 * 512)
+
+typedef struct {
+  const uint8_t *data;
+  size_t len, pos;
+} memStream_t;
+
+typedef struct {
+  uint32_t frames, errors;
+  uint64_t samples, mismatches;
+} flacResult_t;
+
+static size_t mem_fetch(void *ctx, const uint8_t **data) {
+  memStream_t *m = ctx;
+  size_t n = m->len - m->pos < FETCH_SIZE ? m->len - m->pos : FETCH_SIZE;
+  *data = m->data + m->pos;
+  m->pos += n;
+  return n;
+}
+
+/* ref is the interleaved source pcm or NULL */
+static int decode(const uint8_t *data, size_t len, const int32_t *ref, size_t refSamples,
+                  flacResult_t *res, flacStreamInfo_t *info) {
+  memStream_t m = {data, len, 0};
+  memset(res, 0, sizeof(flacResult_t));
+  flacDecoder_t *d = flac_open(mem_fetch, &m);
+  if(d == NULL) return -1;
+  *info = d->info;
+  while(1) {
+    int n = flac_decode_frame(d);
+    if(n == FLAC_ERR_END) break;
+    if(n < 0) {
+      res->errors++;
+      continue;
+    }
+    if(ref != NULL) {
+      int chans = d->frame.channels;
+      for(int i = 0; i < n; ++i) {
+        for(int ch = 0; ch < chans; ++ch) {
+          size_t at = d->frame.firstSample + i;
+          if(at >= refSamples || d->samples[ch][i] != ref[at * chans + ch]) {
+            if(res->mismatches++ == 0)
+              printf("  frame %u sample %zu ch %d: %d, expected %d\n", res->frames, at, ch,
+                     d->samples[ch][i], at < refSamples ? ref[at * chans + ch] : 0);
+          }
+        }
+      }
+    }
+    res->frames++;
+    res->samples += n;
+  }
+  flac_close(d);
+  return 0;
+}
+
+static int bench(const char *name, const uint8_t *data, size_t len, const int32_t *ref,
+                 size_t refSamples, int rounds) {
+  flacResult_t res = {0};
+  flacStreamInfo_t info = {0};
+  double best = 1e30;
+  int fail = 0;
+  for(int r = 0; r < rounds; ++r) {
+    double t = bench_seconds();
+    if(decode(data, len, r == 0 ? ref : NULL, refSamples, &res, &info) != 0) {
+      printf("%-24s not a supported flac stream\n", name);
+      return 1;
+    }
+    t = bench_seconds() - t;
+    if(t < best) best = t;
+    if(r == 0 && ref != NULL)
+      fail = res.mismatches != 0 || res.samples != refSamples || res.errors != 0;
+  }
+  double audio = (double)res.samples / info.sampleRate;
+  printf("%-24s %6u %4u %2d/%-6u %9.0f %7.1f %7.2f  %s\n", name, res.frames, res.errors,
+         info.bitsPerSample, info.sampleRate, res.frames / best, audio / best,
+         len / best / 1e6, ref == NULL ? "-" : (fail ? "FAIL" : "lossless"));
+  return fail;
+}
+
+int main(int argc, char **argv) {
+  int opt, rounds = 5, ret = 0;
+  while((opt = getopt(argc, argv, "n:")) != -1) {
+    if(opt == 'n') rounds = atoi(optarg) > 0 ? atoi(optarg) : 1;
+    else {
+      fprintf(stderr, "usage: %s [-n rounds] [file.flac ...]\n", argv[0]);
+      return 2;
+    }
+  }
+  printf("%-24s %6s %4s %9s %9s %7s %7s\n", "stream", "frames", "errs", "bits/rate",
+         "frames/s", "xRT", "MB/s");
+  if(optind == argc) {
+    for(const flacGenCase_t *c = flacGenCorpus; c->name != NULL; ++c) {
+      flacGenStream_t s;
+      if(flacgen_stream(c, &s) != 0) return 1;
+      ret |= bench(c->name, s.data, s.len, s.pcm, s.samples, rounds);
+      flacgen_free(&s);
+    }
+    return ret != 0;
+  }
+  for(int i = optind; i < argc; ++i) {
+    size_t len;
+    uint8_t *buf = load_file(argv[i], &len);
+    if(buf == NULL) {
+      fprintf(stderr, "flacbench: cannot read %s\n", argv[i]);
+      ret = 1;
+      continue;
+    }
+    ret |= bench(base_name(argv[i]), buf, len, NULL, 0, rounds);
+    free(buf);
+  }
+  return ret != 0;
+}
@@ -0,0 +1,379 @@
+/* flacgen - writes the synthetic FLAC corpus used by flacbench.
+ *
+ * like mp3gen there is no encoder on the build hosts, so this is a small one.
+ * it does not search for the best encoding, it picks subframe types,
+ * predictor orders, LPC coefficients, stereo modes, Rice partitions and
+ * escapes at random so that every decoder path runs, and it keeps the pcm
+ * it encoded so the decoder output can be checked sample for sample */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "gen.h"
+#include "flacgen.h"
+
+#define GEN_MAX_BLOCK 4608
+#define GEN_MAX_ORDER 32
+
+static void put_signed(bitWriter_t *w, int32_t val, int n) {
+  put_bits(w, (uint32_t)val & (n == 32 ? 0xFFFFFFFFu : (1u << n) - 1), n);
+}
+
+static void put_unary(bitWriter_t *w, uint32_t zeros) {
+  w->bit += zeros;
+  put_bits(w, 1, 1);
+}
+
+static void align(bitWriter_t *w) {
+  w->bit = (w->bit + 7) & ~(size_t)7;
+}
+
+const flacGenCase_t flacGenCorpus[] = {
+  {"s16_44k_stereo", 44100, 2, 16, 4096, 120},
+  {"s16_48k_mono", 48000, 1, 16, 4608, 100},
+  {"s24_96k_stereo", 96000, 2, 24, 4096, 200},
+  {"s24_48k_stereo_b1152", 48000, 2, 24, 1152, 300},
+  {"s16_44k_variable", 44100, 2, 16, 0, 200},
+  {"s8_22k_mono", 22050, 1, 8, 576, 200},
+  {"s20_88k_stereo", 88200, 2, 20, 2048, 200},
+  {NULL}
+};
+
+static const int blockCodes[16] = {0, 192, 576, 1152, 2304, 4608, 0, 0,
+  256, 512, 1024, 2048, 4096, 8192, 16384, 32768};
+static const int rateCodes[12] = {0, 88200, 176400, 192000, 8000, 16000, 22050, 24000,
+  32000, 44100, 48000, 96000};
+
+static uint8_t crc8(const uint8_t *p, size_t n) {
+  uint8_t crc = 0;
+  while(n-- > 0) {
+    crc ^= *p++;
+    for(int k = 0; k < 8; ++k) crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+  }
+  return crc;
+}
+
+static uint16_t crc16(const uint8_t *p, size_t n) {
+  uint16_t crc = 0;
+  while(n-- > 0) {
+    crc ^= *p++ << 8;
+    for(int k = 0; k < 8; ++k) crc = crc & 0x8000 ? (crc << 1) ^ 0x8005 : crc << 1;
+  }
+  return crc;
+}
+
+/* band limited noise, smooth enough for the predictors to have something to
+ * do, with the occasional silent or DC block */
+static void gen_signal(int32_t *x, int n, int bits, int32_t *state) {
+  int32_t peak = (1 << (bits - 1)) - 1, step = 1 << (bits > 10 ? bits - 7 : 3);
+  int mode = gen_rnd(40);
+  for(int i = 0; i < n; ++i) {
+    if(mode == 0) {
+      x[i] = 0;
+      continue;
+    }
+    if(mode == 1) {
+      x[i] = *state;
+      continue;
+    }
+    *state += (int32_t)gen_rnd(2 * step + 1) - step;
+    *state -= *state / 64;
+    if(*state > peak) *state = peak;
+    if(*state < -peak) *state = -peak;
+    x[i] = *state;
+  }
+}
+
+static int32_t fixed_predict(const int32_t *s, int i, int order) {
+  switch(order) {
+    case 1: return s[i - 1];
+    case 2: return 2 * s[i - 1] - s[i - 2];
+    case 3: return 3 * (s[i - 1] - s[i - 2]) + s[i - 3];
+    case 4: return 4 * (s[i - 1] + s[i - 3]) - 6 * s[i - 2] - s[i - 4];
+  }
+  return 0;
+}
+
+static void put_residual(bitWriter_t *w, const int32_t *res, int n, int order) {
+  int maxPart = 0;
+  while(maxPart < 8 && (n >> (maxPart + 1)) >= order && (n % (2 << maxPart)) == 0
+        && (n >> (maxPart + 1)) > 0)
+    maxPart++;
+  int partOrder = gen_rnd(maxPart + 1), parts = 1 << partOrder, partSize = n >> partOrder;
+  int method = gen_rnd(2);
+  //a parameter above 14 needs the 5-bit method
+  for(int i = order; i < n; ++i) {
+    uint32_t u = res[i] >= 0 ? (uint32_t)res[i] << 1 : ((uint32_t)-res[i] << 1) - 1;
+    if(u >> 15) method = 1;
+  }
+  put_bits(w, method, 2);
+  put_bits(w, partOrder, 4);
+  int i = order;
+  for(int p = 0; p < parts; ++p) {
+    int end = (p + 1) * partSize;
+    uint64_t sum = 0;
+    int32_t maxAbs = 0;
+    for(int j = i; j < end; ++j) {
+      uint32_t u = res[j] >= 0 ? (uint32_t)res[j] << 1 : ((uint32_t)-res[j] << 1) - 1;
+      sum += u;
+      if(abs(res[j]) > maxAbs) maxAbs = abs(res[j]);
+    }
+    int k = 0;
+    if(end > i) while(k < (method ? 30 : 14) && ((uint64_t)(end - i) << (k + 1)) < sum) k++;
+    if(gen_rnd(16) == 0) {
+      //escape, raw signed values
+      int raw = 0;
+      while(raw < 31 && maxAbs >= (1 << raw) / 2) raw++;
+      if(maxAbs == 0 && gen_rnd(2)) raw = 0;
+      else if(raw == 0) raw = 1;
+      put_bits(w, method ? 31 : 15, method ? 5 : 4);
+      put_bits(w, raw, 5);
+      for(; i < end; ++i) put_signed(w, res[i], raw);
+      continue;
+    }
+    put_bits(w, k, method ? 5 : 4);
+    for(; i < end; ++i) {
+      uint32_t u = res[i] >= 0 ? (uint32_t)res[i] << 1 : ((uint32_t)-res[i] << 1) - 1;
+      put_unary(w, u >> k);
+      put_bits(w, u & ((1u << k) - 1), k);
+    }
+  }
+}
+
+static void put_subframe(bitWriter_t *w, const int32_t *x, int n, int bits) {
+  static int32_t res[GEN_MAX_BLOCK];
+  int wasted = 0;
+  int32_t s[GEN_MAX_BLOCK], all = 0, first = x[0];
+  bool constant = true;
+  for(int i = 0; i < n; ++i) {
+    all |= x[i];
+    if(x[i] != first) constant = false;
+  }
+  if(all != 0) while(((all >> wasted) & 1) == 0) wasted++;
+  else if(constant == false) wasted = 0;
+  if(constant && gen_rnd(4) != 0) {
+    put_bits(w, 0, 8); //CONSTANT, no wasted bits
+    put_signed(w, first, bits);
+    return;
+  }
+  if(wasted >= bits) wasted = 0;
+  for(int i = 0; i < n; ++i) s[i] = x[i] >> wasted;
+  int b = bits - wasted, type = gen_rnd(20), order;
+  if(type == 0) {
+    put_bits(w, (1 << 1) | (wasted > 0), 8);
+    if(wasted) put_unary(w, wasted - 1);
+    for(int i = 0; i < n; ++i) put_signed(w, s[i], b);
+    return;
+  }
+  if(type < 8) {
+    order = gen_rnd(5);
+    if(order > n) order = 0;
+    put_bits(w, ((8 + order) << 1) | (wasted > 0), 8);
+    if(wasted) put_unary(w, wasted - 1);
+    for(int i = 0; i < order; ++i) put_signed(w, s[i], b);
+    for(int i = order; i < n; ++i) res[i] = s[i] - fixed_predict(s, i, order);
+    put_residual(w, res, n, order);
+    return;
+  }
+  //LPC, a fixed predictor in LPC form plus random taps
+  int32_t coef[GEN_MAX_ORDER];
+  order = gen_rnd(8) == 0 ? 1 + gen_rnd(GEN_MAX_ORDER) : 1 + gen_rnd(12);
+  if(order > n) order = 1;
+  int precision = 12 + gen_rnd(4), shift = precision - 3;
+  int32_t cmax = (1 << (precision - 1)) - 1;
+  for(int j = 0; j < order; ++j) coef[j] = (int32_t)gen_rnd(2 * (cmax >> 8) + 1) - (cmax >> 8);
+  coef[0] = 1 << shift;
+  if(order >= 2) {
+    coef[0] = (int32_t)(2 << shift) - (1 << (shift - 2));
+    coef[1] = -(1 << shift) + (1 << (shift - 2));
+  }
+  for(int j = 0; j < order; ++j) {
+    if(coef[j] > cmax) coef[j] = cmax;
+    if(coef[j] < -cmax - 1) coef[j] = -cmax - 1;
+  }
+  put_bits(w, ((31 + order) << 1) | (wasted > 0), 8);
+  if(wasted) put_unary(w, wasted - 1);
+  for(int i = 0; i < order; ++i) put_signed(w, s[i], b);
+  put_bits(w, precision - 1, 4);
+  put_signed(w, shift, 5);
+  for(int j = 0; j < order; ++j) put_signed(w, coef[j], precision);
+  for(int i = order; i < n; ++i) {
+    int64_t sum = 0;
+    for(int j = 0; j < order; ++j) sum += (int64_t)coef[j] * s[i - 1 - j];
+    res[i] = s[i] - (int32_t)(sum >> shift);
+  }
+  put_residual(w, res, n, order);
+}
+
+/* frame or sample number, UTF-8 style */
+static void put_coded(bitWriter_t *w, uint64_t v) {
+  if(v < 0x80) {
+    put_bits(w, v, 8);
+    return;
+  }
+  int extra = 1;
+  while(v >= (1ull << (5 * extra + 6))) extra++;
+  put_bits(w, ((0xFF << (7 - extra)) & 0xFF) | (v >> (6 * extra)), 8);
+  for(int i = extra - 1; i >= 0; --i) put_bits(w, 0x80 | ((v >> (6 * i)) & 0x3F), 8);
+}
+
+static size_t put_frame(bitWriter_t *w, const flacGenCase_t *c, const int32_t *x, int n,
+                        uint64_t number) {
+  static int32_t ch[2][GEN_MAX_BLOCK];
+  size_t start = w->bit / 8;
+  int blockCode = 0, rateCode = 0, bitsCode, assign = c->channels - 1;
+  for(int i = 1; i < 16; ++i) if(blockCodes[i] == n && gen_rnd(4)) blockCode = i;
+  if(blockCode == 0) blockCode = n <= 256 ? 6 : 7;
+  for(int i = 1; i < 12; ++i) if(rateCodes[i] == c->sampleRate && gen_rnd(4)) rateCode = i;
+  if(rateCode == 0 && gen_rnd(2)) rateCode = c->sampleRate % 10 ? 13 : 14;
+  switch(c->bits) {
+    case 8: bitsCode = 1; break;
+    case 12: bitsCode = 2; break;
+    case 16: bitsCode = 4; break;
+    case 20: bitsCode = 5; break;
+    default: bitsCode = 6; break;
+  }
+  if(gen_rnd(8) == 0) bitsCode = 0;
+  for(int i = 0; i < n; ++i)
+    for(int k = 0; k < c->channels; ++k) ch[k][i] = x[i * c->channels + k];
+  if(c->channels == 2) {
+    assign = gen_rnd(2) ? 1 : 8 + gen_rnd(3);
+    for(int i = 0; i < n && assign >= 8; ++i) {
+      int32_t l = ch[0][i], r = ch[1][i];
+      if(assign == 8) ch[1][i] = l - r;
+      else if(assign == 9) ch[0][i] = l - r;
+      else {
+        ch[0][i] = (l + r) >> 1;
+        ch[1][i] = l - r;
+      }
+    }
+  }
+  put_bits(w, c->blockSize ? 0xFFF8 : 0xFFF9, 16);
+  put_bits(w, blockCode, 4);
+  put_bits(w, rateCode, 4);
+  put_bits(w, assign, 4);
+  put_bits(w, bitsCode, 3);
+  put_bits(w, 0, 1);
+  put_coded(w, number);
+  if(blockCode == 6) put_bits(w, n - 1, 8);
+  if(blockCode == 7) put_bits(w, n - 1, 16);
+  if(rateCode == 13) put_bits(w, c->sampleRate, 16);
+  if(rateCode == 14) put_bits(w, c->sampleRate / 10, 16);
+  put_bits(w, crc8(w->buf + start, w->bit / 8 - start), 8);
+  for(int k = 0; k < c->channels; ++k) {
+    int side = (k == 1 && (assign == 8 || assign == 10)) || (k == 0 && assign == 9);
+    put_subframe(w, ch[k], n, c->bits + side);
+  }
+  align(w);
+  put_bits(w, crc16(w->buf + start, w->bit / 8 - start), 16);
+  return w->bit / 8 - start;
+}
+
+static void put_meta(bitWriter_t *w, int type, bool last, uint32_t len) {
+  put_bits(w, (last ? 0x80 : 0) | type, 8);
+  put_bits(w, len, 24);
+}
+
+/* 0 on success */
+int flacgen_stream(const flacGenCase_t *c, flacGenStream_t *s) {
+  static const char vendor[] = "flacgen", comment[] = "TITLE=flacgen";
+  int maxBlock = c->blockSize ? c->blockSize : GEN_MAX_BLOCK;
+  size_t total = 0, cap;
+  int32_t state[2] = {0, 0};
+  int *sizes = malloc(c->frames * sizeof(int));
+  memset(s, 0, sizeof(flacGenStream_t));
+  gen_seed(c->name);
+  for(int f = 0; f < c->frames; ++f) {
+    sizes[f] = c->blockSize ? c->blockSize : 16 + gen_rnd(GEN_MAX_BLOCK - 15);
+    //the last frame of a fixed block size stream may be short
+    if(c->blockSize && f == c->frames - 1) sizes[f] = 1 + gen_rnd(c->blockSize);
+    total += sizes[f];
+  }
+  cap = 1024 + total * c->channels * (c->bits + 8);
+  s->data = calloc(1, cap);
+  s->pcm = malloc(total * c->channels * sizeof(int32_t));
+  s->samples = total;
+  if(s->data == NULL || s->pcm == NULL || sizes == NULL) {
+    free(sizes);
+    flacgen_free(s);
+    return -1;
+  }
+  bitWriter_t w = {s->data, 0};
+  put_bits(&w, 0x664C6143, 32);
+  put_meta(&w, 0, false, 34);
+  put_bits(&w, c->blockSize ? c->blockSize : 16, 16);
+  put_bits(&w, maxBlock, 16);
+  put_bits(&w, 0, 24);
+  put_bits(&w, 0, 24);
+  put_bits(&w, c->sampleRate, 20);
+  put_bits(&w, c->channels - 1, 3);
+  put_bits(&w, c->bits - 1, 5);
+  put_bits(&w, total >> 32, 4);
+  put_bits(&w, total & 0xFFFFFFFF, 32);
+  w.bit += 128; //md5 not computed
+  put_meta(&w, 4, false, 4 + sizeof(vendor) - 1 + 4 + 4 + sizeof(comment) - 1);
+  for(int i = 0; i < 4; ++i) put_bits(&w, ((sizeof(vendor) - 1) >> (8 * i)) & 0xFF, 8);
+  for(size_t i = 0; i < sizeof(vendor) - 1; ++i) put_bits(&w, vendor[i], 8);
+  put_bits(&w, 0x01000000, 32); //one comment, little endian
+  for(int i = 0; i < 4; ++i) put_bits(&w, ((sizeof(comment) - 1) >> (8 * i)) & 0xFF, 8);
+  for(size_t i = 0; i < sizeof(comment) - 1; ++i) put_bits(&w, comment[i], 8);
+  put_meta(&w, 1, true, 100); //padding
+  w.bit += 800;
+
+  int32_t *x = s->pcm;
+  uint64_t sample = 0;
+  for(int f = 0; f < c->frames; ++f) {
+    int n = sizes[f];
+    int32_t mono[GEN_MAX_BLOCK];
+    for(int k = 0; k < c->channels; ++k) {
+      gen_signal(mono, n, c->bits, &state[k]);
+      for(int i = 0; i < n; ++i) x[i * c->channels + k] = mono[i];
+    }
+    //wasted bits now and then
+    if(gen_rnd(10) == 0) {
+      int z = 1 + gen_rnd(4);
+      for(int i = 0; i < n * c->channels; ++i) x[i] &= ~((1 << z) - 1);
+    }
+    put_frame(&w, c, x, n, c->blockSize ? (uint64_t)f : sample);
+    if(w.bit / 8 > cap / 2) {
+      fprintf(stderr, "flacgen: %s outgrew its buffer\n", c->name);
+      free(sizes);
+      flacgen_free(s);
+      return -1;
+    }
+    x += n * c->channels;
+    sample += n;
+  }
+  s->len = w.bit / 8;
+  free(sizes);
+  return 0;
+}
+
+void flacgen_free(flacGenStream_t *s) {
+  free(s->data);
+  free(s->pcm);
+  memset(s, 0, sizeof(flacGenStream_t));
+}
+
+#ifdef FLACGEN_MAIN
+int main(int argc, char **argv) {
+  const char *dir = argc > 1 ? argv[1] : ".";
+  char path[512];
+  for(const flacGenCase_t *c = flacGenCorpus; c->name != NULL; ++c) {
+    flacGenStream_t s;
+    if(flacgen_stream(c, &s) != 0) return 1;
+    snprintf(path, sizeof(path), "%s/%s.flac", dir, c->name);
+    FILE *f = fopen(path, "wb");
+    if(f == NULL || fwrite(s.data, 1, s.len, f) != s.len) {
+      fprintf(stderr, "flacgen: cannot write %s\n", path);
+      return 1;
+    }
+    fclose(f);
+    printf("%s %zu bytes\n", path, s.len);
+    flacgen_free(&s);
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,28 @@
+#ifndef _FLACGEN_H_
+#define _FLACGEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  const char *name;
+  int sampleRate;
+  int channels;
+  int bits;
+  int blockSize; //0 = variable, random per frame
+  int frames;
+} flacGenCase_t;
+
+/* a stream and the pcm it decodes to, samples interleaved */
+typedef struct {
+  uint8_t *data;
+  size_t len;
+  int32_t *pcm;
+  size_t samples; //per channel
+} flacGenStream_t;
+
+extern const flacGenCase_t flacGenCorpus[];
+
+int flacgen_stream(const flacGenCase_t *c, flacGenStream_t *s);
+void flacgen_free(flacGenStream_t *s);
+#endif
@@ -0,0 +1,316 @@
+/* framebench - frame times of LVGL drawing screens like the player's at
+ * 320x240, through a display driver that does what drv/ili9341.c does
+ * with the VDB: swap the two bytes of every pixel for the 8 bit SPI bus,
+ * unless LV_COLOR_16_SWAP already rendered them in that order.
+ *
+ *   framebench [-n rounds] [-o frames.raw]
+ *
+ * the Makefile builds it twice, build/framebench with plain RGB565 and
+ * build/framebench_swap with LV_COLOR_16_SWAP. between them the screens
+ * use every lv_draw primitive: filled, gradient, rounded, bordered and
+ * shadowed rectangles, opacity, anti-aliased text in 2 and 4 bpp fonts,
+ * lines, arcs of a gauge and a line meter, and images plain, chroma keyed,
+ * with an alpha byte and recoloured. -o writes the bytes the display got
+ * for each screen, make check requires the two builds to send the same */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lvgl/lvgl.h"
+#include "bench.h"
+
+#define ROUND_SECONDS 0.2
+#define ICON_SIZE 48
+
+LV_IMG_DECLARE(default_cover);
+
+typedef struct {
+  const char *name;
+  void (*draw)(lv_obj_t *scr);
+} screen_t;
+
+/* what the display got, in the bytes that went over the bus */
+static uint8_t wire[LV_VER_RES][LV_HOR_RES * 2];
+static double swapTime;
+
+static lv_style_t styleCard, styleBar, styleText, styleFaded, styleRecolor, styleLine;
+static uint8_t alphaPixels[ICON_SIZE * ICON_SIZE * (sizeof(lv_color_t) + 1)];
+static lv_color_t keyedPixels[ICON_SIZE * ICON_SIZE];
+static lv_img_t alphaIcon, keyedIcon;
+
+static void disp_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lv_color_t *color_p) {
+  uint8_t *color_u8 = (uint8_t *)color_p;
+  double start = bench_seconds();
+#if LV_COLOR_16_SWAP == 0
+  uint32_t size = (x2 - x1 + 1) * (y2 - y1 + 1);
+  for(uint32_t i = 0; i < size * 2; i += 2) {
+    uint8_t color_tmp = color_u8[i + 1];
+    color_u8[i + 1] = color_u8[i];
+    color_u8[i] = color_tmp;
+  }
+#endif
+  swapTime += bench_seconds() - start;
+  //the DMA transfer, not timed
+  for(int32_t y = y1; y <= y2; ++y, color_u8 += (x2 - x1 + 1) * 2)
+    memcpy(&wire[y][x1 * 2], color_u8, (x2 - x1 + 1) * 2);
+  lv_flush_ready();
+}
+
+static void make_icons(void) {
+  uint8_t *p = alphaPixels;
+  for(int y = 0; y < ICON_SIZE; ++y) {
+    for(int x = 0; x < ICON_SIZE; ++x) {
+      lv_color_t c = LV_COLOR_MAKE(x * 5, y * 5, 255 - x * 5);
+      memcpy(p, &c, sizeof(c));
+      p[sizeof(c)] = (x + y) * 255 / (2 * ICON_SIZE - 2);
+      p += sizeof(c) + 1;
+      keyedPixels[y * ICON_SIZE + x] = (x / 8 + y / 8) & 1 ? LV_COLOR_TRANSP : LV_COLOR_MAKE(255 - y * 5, 40, x * 5);
+    }
+  }
+  alphaIcon.header.format = LV_IMG_FORMAT_INTERNAL_RAW;
+  alphaIcon.header.alpha_byte = 1;
+  alphaIcon.header.w = ICON_SIZE;
+  alphaIcon.header.h = ICON_SIZE;
+  alphaIcon.pixel_map = alphaPixels;
+  keyedIcon.header.format = LV_IMG_FORMAT_INTERNAL_RAW;
+  keyedIcon.header.chroma_keyed = 1;
+  keyedIcon.header.w = ICON_SIZE;
+  keyedIcon.header.h = ICON_SIZE;
+  keyedIcon.pixel_map = (const uint8_t *)keyedPixels;
+}
+
+static void make_styles(void) {
+  lv_style_copy(&styleCard, &lv_style_pretty);
+  styleCard.body.main_color = LV_COLOR_HEX(0x3A6EA5);
+  styleCard.body.grad_color = LV_COLOR_HEX(0xC0E8FF);
+  styleCard.body.radius = 12;
+  styleCard.body.border.color = LV_COLOR_HEX(0xFF8800);
+  styleCard.body.border.width = 3;
+  styleCard.body.border.opa = LV_OPA_70;
+  styleCard.body.shadow.color = LV_COLOR_HEX(0x202020);
+  styleCard.body.shadow.width = 8;
+  styleCard.body.shadow.type = LV_SHADOW_FULL;
+
+  lv_style_copy(&styleBar, &styleCard);
+  styleBar.body.opa = LV_OPA_50;
+  styleBar.body.radius = LV_RADIUS_CIRCLE;
+  styleBar.body.shadow.width = 0;
+
+  lv_style_copy(&styleText, &lv_style_plain);
+  styleText.text.color = LV_COLOR_HEX(0xF0F040);
+  styleText.text.font = &lv_font_dejavu_20;
+
+  lv_style_copy(&styleFaded, &lv_style_plain);
+  styleFaded.text.color = LV_COLOR_WHITE;
+  styleFaded.text.font = &lv_font_dejavu_40;
+  styleFaded.text.opa = LV_OPA_60;
+  styleFaded.image.opa = LV_OPA_60;
+
+  lv_style_copy(&styleRecolor, &lv_style_plain);
+  styleRecolor.image.color = LV_COLOR_HEX(0x8040C0);
+  styleRecolor.image.intense = LV_OPA_50;
+
+  lv_style_copy(&styleLine, &lv_style_plain);
+  styleLine.line.color = LV_COLOR_HEX(0x20D080);
+  styleLine.line.width = 3;
+  styleLine.line.opa = LV_OPA_80;
+}
+
+static lv_obj_t *status_bar(lv_obj_t *scr) {
+  lv_obj_t *bar = lv_obj_create(scr, NULL);
+  lv_obj_set_size(bar, LV_HOR_RES, 24);
+  lv_obj_set_style(bar, &lv_style_plain_color);
+  lv_obj_t *label = lv_label_create(bar, NULL);
+  lv_label_set_text(label, SYMBOL_BATTERY_3 "  " SYMBOL_VOLUME_MAX "80%");
+  lv_obj_set_pos(label, 5, 2);
+  label = lv_label_create(bar, NULL);
+  lv_label_set_text(label, SYMBOL_WIFI "  " SYMBOL_PLAY);
+  lv_obj_set_pos(label, 265, 2);
+  return bar;
+}
+
+static void draw_home(lv_obj_t *scr) {
+  status_bar(scr);
+  lv_obj_t *list = lv_list_create(scr, NULL);
+  lv_obj_set_size(list, LV_HOR_RES, 216);
+  lv_obj_set_pos(list, 0, 24);
+  lv_list_add(list, SYMBOL_AUDIO, "Library", NULL);
+  lv_list_add(list, SYMBOL_IMAGE, "Gallery", NULL);
+  lv_list_add(list, SYMBOL_SETTINGS, "Settings", NULL);
+  lv_list_add(list, SYMBOL_PLAY, "Now Playing", NULL);
+}
+
+static void draw_playing(lv_obj_t *scr) {
+  status_bar(scr);
+  lv_obj_t *img = lv_img_create(scr, NULL);
+  lv_img_set_src(img, &default_cover);
+  lv_obj_set_pos(img, 15, 39);
+  static const char *lines[] = {"Bohemian Rhapsody", "Queen", "A Night at the Opera", "44100Hz 16-Bit"};
+  for(int i = 0; i < 4; ++i) {
+    lv_obj_t *label = lv_label_create(scr, NULL);
+    lv_label_set_style(label, &styleText);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+    lv_obj_set_size(label, 150, 24);
+    lv_obj_set_pos(label, 160, 44 + i * 30);
+    lv_label_set_text(label, lines[i]);
+  }
+  lv_obj_t *bar = lv_bar_create(scr, NULL);
+  lv_obj_set_size(bar, 290, 10);
+  lv_obj_set_pos(bar, 15, 211);
+  lv_bar_set_value(bar, 37);
+  lv_obj_t *time = lv_label_create(scr, NULL);
+  lv_label_set_style(time, &styleText);
+  lv_obj_set_pos(time, 15, 182);
+  lv_label_set_text(time, "2:13 / 5:55");
+}
+
+static void draw_shapes(lv_obj_t *scr) {
+  lv_obj_t *card = lv_obj_create(scr, NULL);
+  lv_obj_set_style(card, &styleCard);
+  lv_obj_set_pos(card, 10, 10);
+  lv_obj_set_size(card, 140, 100);
+  lv_obj_t *pill = lv_obj_create(scr, NULL);
+  lv_obj_set_style(pill, &styleBar);
+  lv_obj_set_pos(pill, 60, 60);
+  lv_obj_set_size(pill, 200, 40);
+  static const lv_point_t points[] = {{0, 0}, {60, 90}, {120, 10}, {150, 70}};
+  lv_obj_t *line = lv_line_create(scr, NULL);
+  lv_line_set_style(line, &styleLine);
+  lv_line_set_points(line, points, 4);
+  lv_obj_set_pos(line, 10, 130);
+  lv_obj_t *gauge = lv_gauge_create(scr, NULL);
+  lv_obj_set_size(gauge, 130, 130);
+  lv_obj_set_pos(gauge, 180, 110);
+  lv_gauge_set_value(gauge, 0, 64);
+  lv_obj_t *meter = lv_lmeter_create(scr, NULL);
+  lv_obj_set_size(meter, 90, 90);
+  lv_obj_set_pos(meter, 220, 5);
+  lv_lmeter_set_value(meter, 70);
+  lv_obj_t *led = lv_led_create(scr, NULL);
+  lv_obj_set_pos(led, 20, 200);
+  lv_led_set_bright(led, 160);
+  lv_obj_t *chart = lv_chart_create(scr, NULL);
+  lv_obj_set_size(chart, 100, 60);
+  lv_obj_set_pos(chart, 70, 175);
+  lv_chart_series_t *ser = lv_chart_add_series(chart, LV_COLOR_HEX(0xE02020));
+  for(int i = 0; i < 10; ++i) lv_chart_set_next(chart, ser, (i * 37) % 100);
+}
+
+static void draw_images(lv_obj_t *scr) {
+  lv_obj_t *bg = lv_obj_create(scr, NULL);
+  lv_obj_set_style(bg, &styleCard);
+  lv_obj_set_size(bg, LV_HOR_RES, LV_VER_RES);
+  static const lv_style_t *styles[] = {NULL, &styleRecolor, &styleFaded};
+  for(int i = 0; i < 3; ++i) {
+    lv_obj_t *img = lv_img_create(scr, NULL);
+    lv_img_set_src(img, &default_cover);
+    if(styles[i] != NULL) lv_img_set_style(img, (lv_style_t *)styles[i]);
+    lv_obj_set_pos(img, -40 + i * 110, 10 + i * 20);
+  }
+  for(int i = 0; i < 4; ++i) {
+    lv_obj_t *img = lv_img_create(scr, NULL);
+    lv_img_set_src(img, i & 1 ? &keyedIcon : &alphaIcon);
+    if(i >= 2) lv_img_set_style(img, &styleRecolor);
+    lv_obj_set_pos(img, 20 + i * 75, 180);
+  }
+}
+
+static void draw_text(lv_obj_t *scr) {
+  lv_obj_t *bg = lv_obj_create(scr, NULL);
+  lv_obj_set_style(bg, &styleCard);
+  lv_obj_set_size(bg, LV_HOR_RES, LV_VER_RES);
+  lv_obj_t *label = lv_label_create(scr, NULL);
+  lv_label_set_style(label, &styleText);
+  lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+  lv_obj_set_width(label, 300);
+  lv_obj_set_pos(label, 10, 5);
+  lv_label_set_text(label, "The quick brown fox jumps over the lazy dog. 0123456789 "
+                           "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG!");
+  label = lv_label_create(scr, NULL);
+  lv_label_set_style(label, &styleFaded);
+  lv_obj_set_pos(label, 10, 90);
+  lv_label_set_text(label, "Ag" SYMBOL_AUDIO SYMBOL_HOME "%&");
+  static lv_style_t style30;
+  lv_style_copy(&style30, &styleText);
+  style30.text.font = &lv_font_dejavu_30;
+  style30.text.color = LV_COLOR_HEX(0x102040);
+  label = lv_label_create(scr, NULL);
+  lv_label_set_style(label, &style30);
+  lv_obj_set_pos(label, 10, 150);
+  lv_label_set_text(label, "Shuffle " SYMBOL_SHUFFLE " 1:23");
+}
+
+static const screen_t screens[] = {
+  {"home", draw_home},
+  {"playing", draw_playing},
+  {"shapes", draw_shapes},
+  {"images", draw_images},
+  {"text", draw_text},
+};
+
+/* one refresh of the whole screen */
+static void frame(void) {
+  lv_obj_invalidate(lv_scr_act());
+  lv_tick_inc(LV_REFR_PERIOD);
+  lv_task_handler();
+}
+
+int main(int argc, char **argv) {
+  int opt, rounds = 5;
+  const char *out = NULL;
+  while((opt = getopt(argc, argv, "n:o:")) != -1) {
+    if(opt == 'n') rounds = atoi(optarg) > 0 ? atoi(optarg) : 1;
+    else if(opt == 'o') out = optarg;
+    else {
+      fprintf(stderr, "usage: %s [-n rounds] [-o frames.raw]\n", argv[0]);
+      return 2;
+    }
+  }
+  FILE *f = NULL;
+  if(out != NULL && (f = fopen(out, "wb")) == NULL) {
+    fprintf(stderr, "framebench: cannot write %s\n", out);
+    return 1;
+  }
+  lv_init();
+  lv_disp_drv_t disp;
+  lv_disp_drv_init(&disp);
+  disp.disp_flush = disp_flush;
+  lv_disp_drv_register(&disp);
+  lv_theme_set_current(lv_theme_material_init(210, NULL));
+  make_icons();
+  make_styles();
+
+  printf("%s\n", LV_COLOR_16_SWAP ? "LV_COLOR_16_SWAP, rendered in the display's byte order"
+                                  : "RGB565, swapped in the flush");
+  printf("%-10s %10s %10s %6s\n", "screen", "frame ms", "swap ms", "fps");
+  for(size_t s = 0; s < sizeof(screens) / sizeof(screens[0]); ++s) {
+    lv_obj_t *scr = lv_obj_create(NULL, NULL);
+    lv_scr_load(scr);
+    screens[s].draw(scr);
+    frame();
+    if(f != NULL) fwrite(wire, sizeof(wire), 1, f);
+    double best = 1e30, bestSwap = 0;
+    for(int r = 0; r < rounds; ++r) {
+      long count = 0;
+      double start = bench_seconds(), t;
+      swapTime = 0;
+      do {
+        frame();
+        count++;
+      } while((t = bench_seconds() - start) < ROUND_SECONDS);
+      if(t / count < best) {
+        best = t / count;
+        bestSwap = swapTime / count;
+      }
+    }
+    printf("%-10s %10.3f %10.3f %6.0f\n", screens[s].name, best * 1e3, bestSwap * 1e3, 1 / best);
+    lv_obj_del(scr);
+  }
+  if(f != NULL && fclose(f) != 0) {
+    fprintf(stderr, "framebench: cannot write %s\n", out);
+    return 1;
+  }
+  return 0;
+}
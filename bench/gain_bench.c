@@ -0,0 +1,68 @@
+/* gain_bench - cycles per sample of the old double multiply against the
+ * Q15 gain stage in main/gain.c, the best of ROUNDS. every round scales a
+ * fresh copy of the same noise, the copy is timed on its own and taken
+ * off. a host FPU multiplies doubles in hardware, the ESP32 doesn't:
+ * CONFIG_GAIN_BENCH runs the same comparison on the target
+ * (main/gain_bench.c) */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "gain.h"
+#include "bench.h"
+
+#define FRAMES 1152
+#define ROUNDS 20000
+
+static void volume_double(int16_t *buf, int samples, double multiplier) {
+  for(int i = 0; i < samples; ++i)
+    buf[i] *= multiplier;
+}
+
+/* best of ROUNDS in cycles */
+static uint64_t copy_only(int16_t *buf, const int16_t *src) {
+  uint64_t best = UINT64_MAX;
+  for(int r = 0; r < ROUNDS; ++r) {
+    uint64_t t = bench_cycles();
+    memcpy(buf, src, FRAMES * 2 * sizeof(int16_t));
+    t = bench_cycles() - t;
+    if(t < best) best = t;
+  }
+  return best;
+}
+
+int main(void) {
+  static int16_t src[FRAMES * 2], buf[FRAMES * 2];
+  volatile int32_t sink = 0;
+  double multiplier = pow(10, -25 / 20.0);
+  int32_t gain = gain_from_db(-25);
+  uint64_t t, copy, before = UINT64_MAX, after = UINT64_MAX;
+
+  for(int i = 0; i < FRAMES * 2; ++i) src[i] = (int16_t)(rand() & 0xFFFF);
+  copy = copy_only(buf, src);
+  for(int r = 0; r < ROUNDS; ++r) {
+    t = bench_cycles();
+    memcpy(buf, src, sizeof(buf));
+    volume_double(buf, FRAMES * 2, multiplier);
+    t = bench_cycles() - t;
+    if(t < before) before = t;
+    sink += buf[r % (FRAMES * 2)];
+  }
+
+  memcpy(buf, src, sizeof(buf));
+  gain_apply_s16(buf, FRAMES, 2, gain); //no ramp in the timed calls
+  for(int r = 0; r < ROUNDS; ++r) {
+    t = bench_cycles();
+    memcpy(buf, src, sizeof(buf));
+    gain_apply_s16(buf, FRAMES, 2, gain);
+    t = bench_cycles() - t;
+    if(t < after) after = t;
+    sink += buf[r % (FRAMES * 2)];
+  }
+
+  printf("double multiply : %6.2f cycles/sample\n", (double)(before - copy) / (FRAMES * 2));
+  printf("q15 gain stage  : %6.2f cycles/sample\n", (double)(after - copy) / (FRAMES * 2));
+  return sink == 0x7FFFFFFF;
+}
@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gen.h"
+
+static uint32_t rng;
+
+/* every case gets its own sequence, taken from its name */
+void gen_seed(const char *name) {
+  rng = 0x9E3779B9u;
+  for(const char *p = name; *p; ++p) rng = (rng ^ (uint8_t)*p) * 16777619u;
+  if(rng == 0) rng = 1;
+}
+
+/* 0..n-1, or all 32 bits for n = 0 */
+uint32_t gen_rnd(uint32_t n) {
+  //xorshift32, the corpus must not depend on the host libc
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return n ? rng % n : rng;
+}
+
+void put_bits(bitWriter_t *w, uint32_t val, int n) {
+  while(n-- > 0) {
+    if((val >> n) & 1) w->buf[w->bit >> 3] |= 0x80 >> (w->bit & 7);
+    w->bit++;
+  }
+}
+
+void put_bytes(byteWriter_t *w, const void *p, size_t n) {
+  if(w->len + n > w->cap) {
+    size_t cap = w->cap ? w->cap : 65536;
+    while(cap < w->len + n) cap *= 2;
+    uint8_t *buf = realloc(w->buf, cap);
+    if(buf == NULL) {
+      fprintf(stderr, "gen: out of memory\n");
+      exit(1);
+    }
+    w->buf = buf;
+    w->cap = cap;
+  }
+  memcpy(w->buf + w->len, p, n);
+  w->len += n;
+}
+
+void put_byte(byteWriter_t *w, uint8_t b) {
+  put_bytes(w, &b, 1);
+}
+
+uint8_t *load_file(const char *path, size_t *len) {
+  FILE *f = fopen(path, "rb");
+  if(f == NULL) return NULL;
+  fseek(f, 0, SEEK_END);
+  *len = ftell(f);
+  rewind(f);
+  uint8_t *buf = malloc(*len ? *len : 1);
+  if(buf != NULL && fread(buf, 1, *len, f) != *len) {
+    free(buf);
+    buf = NULL;
+  }
+  fclose(f);
+  return buf;
+}
+
+const char *base_name(const char *path) {
+  const char *s = strrchr(path, '/');
+  return s ? s + 1 : path;
+}
@@ -0,0 +1,28 @@
+#ifndef _GEN_H_
+#define _GEN_H_
+
+/* pseudo random numbers and bit/byte writers shared by the corpus generators,
+ * and the file helpers of the benches */
+#include <stddef.h>
+#include <stdint.h>
+
+/* msb first into a zeroed buffer the caller sized */
+typedef struct {
+  uint8_t *buf;
+  size_t bit;
+} bitWriter_t;
+
+/* grows as needed, buf is the caller's to free */
+typedef struct {
+  uint8_t *buf;
+  size_t len, cap;
+} byteWriter_t;
+
+void gen_seed(const char *name);
+uint32_t gen_rnd(uint32_t n);
+void put_bits(bitWriter_t *w, uint32_t val, int n);
+void put_bytes(byteWriter_t *w, const void *p, size_t n);
+void put_byte(byteWriter_t *w, uint8_t b);
+uint8_t *load_file(const char *path, size_t *len);
+const char *base_name(const char *path);
+#endif
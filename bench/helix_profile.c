@@ -0,0 +1,20 @@
+#include <string.h>
+
+#include "bench.h"
+#include "helix_profile.h"
+
+uint64_t helixProfile[PROFILE_STAGES];
+const char *helixProfileNames[PROFILE_STAGES] = {
+  "frame", "huffman", "dequant", "imdct", "subband"
+};
+static uint64_t last;
+
+void HelixProfileMark(int stage) {
+  uint64_t now = bench_cycles();
+  if(stage >= 0) helixProfile[stage] += now - last;
+  last = now;
+}
+
+void helix_profile_reset(void) {
+  memset(helixProfile, 0, sizeof(helixProfile));
+}
@@ -0,0 +1,13 @@
+#ifndef _HELIX_PROFILE_H_
+#define _HELIX_PROFILE_H_
+
+/* cycles charged to each decoder stage by the PROFILE_MARK hooks in
+ * components/helix/src/mp3dec.c, libhelix.a is built with HELIX_PROFILE */
+#include <stdint.h>
+#include "mp3common.h"
+
+extern uint64_t helixProfile[PROFILE_STAGES];
+extern const char *helixProfileNames[PROFILE_STAGES];
+
+void helix_profile_reset(void);
+#endif
@@ -0,0 +1,163 @@
+/* id3bench - parses ID3v2 tags through main/id3_tag.c and reports tags per
+ * second, the library scan spends most of its time there.
+ *
+ *   id3bench [-n rounds] [file.mp3 ...]
+ *
+ * without files the synthetic corpus from id3gen.c is parsed from memory and
+ * every field compared with what the tag was written from, pictures byte for
+ * byte after undoing unsynchronisation. a mismatch fails the run. files are
+ * parsed through id3_parse_file() like the scan does, timed and listed */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "id3_tag.h"
+#include "id3gen.h"
+#include "bench.h"
+
+#define ROUND_SECONDS 0.05
+
+typedef struct {
+  const uint8_t *data;
+  size_t len, pos;
+} memStream_t;
+
+static size_t mem_read(void *ctx, uint8_t *buf, size_t len) {
+  memStream_t *m = ctx;
+  size_t n = m->len - m->pos < len ? m->len - m->pos : len;
+  memcpy(buf, m->data + m->pos, n);
+  m->pos += n;
+  return n;
+}
+
+//seeking past the end is fine, like fseek()
+static int mem_skip(void *ctx, uint32_t bytes) {
+  memStream_t *m = ctx;
+  m->pos = m->len - m->pos < bytes ? m->len : m->pos + bytes;
+  return 0;
+}
+
+static int check_text(const char *name, const char *field, const char *got, const char *want) {
+  if(strcmp(got, want) == 0) return 0;
+  printf("  %s %s: \"%s\", expected \"%s\"\n", name, field, got, want);
+  return 1;
+}
+
+static int check_value(const char *name, const char *field, long got, long want) {
+  if(got == want) return 0;
+  printf("  %s %s: %ld, expected %ld\n", name, field, got, want);
+  return 1;
+}
+
+static int check(const char *name, const id3GenTag_t *t, int result, const id3Info_t *info) {
+  const id3Info_t *e = &t->expect;
+  int fail = check_value(name, "result", result, t->result);
+  if(result != 0 || t->result != 0) return fail;
+  fail |= check_value(name, "version", info->version, e->version);
+  fail |= check_value(name, "tagBytes", info->tagBytes, e->tagBytes);
+  fail |= check_text(name, "title", info->title, e->title);
+  fail |= check_text(name, "artist", info->artist, e->artist);
+  fail |= check_text(name, "album", info->album, e->album);
+  fail |= check_value(name, "track", info->track, e->track);
+  fail |= check_value(name, "lengthMs", info->lengthMs, e->lengthMs);
+  fail |= check_value(name, "trackGain", info->trackGain, e->trackGain);
+  fail |= check_value(name, "albumGain", info->albumGain, e->albumGain);
+  fail |= check_value(name, "picture", info->pictureOffset != 0, e->pictureOffset != 0);
+  if(info->pictureOffset == 0 || e->pictureOffset == 0) return fail;
+  fail |= check_text(name, "pictureMime", info->pictureMime, e->pictureMime);
+  fail |= check_value(name, "pictureType", info->pictureType, e->pictureType);
+  fail |= check_value(name, "pictureUnsync", info->pictureUnsync, e->pictureUnsync);
+  if(t->picture == NULL) return fail | check_value(name, "pictureBytes", info->pictureBytes, e->pictureBytes);
+  if(info->pictureOffset + info->pictureBytes > t->len)
+    return fail | check_value(name, "pictureBytes", info->pictureBytes, t->len - info->pictureOffset);
+  //resynchronised the way the cover loader has to
+  const uint8_t *p = t->data + info->pictureOffset;
+  uint8_t *img = malloc(info->pictureBytes + 1);
+  size_t n = 0;
+  for(uint32_t i = 0; i < info->pictureBytes; ++i)
+    if(info->pictureUnsync == false || i == 0 || p[i - 1] != 0xFF || p[i] != 0) img[n++] = p[i];
+  if(n != t->pictureLen || memcmp(img, t->picture, n) != 0) {
+    printf("  %s picture: %zu bytes differ from the %zu written\n", name, n, t->pictureLen);
+    fail = 1;
+  }
+  free(img);
+  return fail;
+}
+
+/* best of rounds, each parsing the tag for at least ROUND_SECONDS */
+static double bench(const uint8_t *data, size_t len, int rounds, int *result, id3Info_t *info) {
+  double best = 1e30;
+  for(int r = 0; r < rounds; ++r) {
+    long count = 0;
+    double start = bench_seconds(), t;
+    do {
+      memStream_t m = {data, len, 0};
+      id3Io_t io = {mem_read, mem_skip, &m};
+      *result = id3_parse(&io, info);
+      count++;
+    } while((t = bench_seconds() - start) < ROUND_SECONDS);
+    if(t / count < best) best = t / count;
+  }
+  return best;
+}
+
+static int bench_corpus(int rounds) {
+  int fail = 0;
+  double total = 0;
+  for(const id3GenCase_t *c = id3GenCorpus; c->name != NULL; ++c) {
+    id3GenTag_t t;
+    id3Info_t info;
+    int result = -1;
+    if(id3gen_tag(c, &t) != 0) return 1;
+    double sec = bench(t.data, t.len, rounds, &result, &info);
+    int bad = check(c->name, &t, result, &info);
+    printf("%-16s %4d %8zu %10.0f %8.0f  %s\n", c->name, t.expect.version, t.len, 1 / sec,
+           sec * 1e9, bad ? "FAIL" : "ok");
+    fail |= bad;
+    total += sec;
+    id3gen_free(&t);
+  }
+  printf("%-16s %4s %8s %10.0f %8.0f\n", "corpus", "", "", 1 / total, total * 1e9);
+  return fail;
+}
+
+static int bench_file(const char *path, int rounds) {
+  id3Info_t info;
+  double best = 1e30;
+  FILE *f = fopen(path, "rb");
+  if(f == NULL) {
+    fprintf(stderr, "id3bench: cannot read %s\n", path);
+    return 1;
+  }
+  for(int r = 0; r < rounds; ++r) {
+    double t = bench_seconds();
+    id3_parse_file(f, &info);
+    t = bench_seconds() - t;
+    if(t < best) best = t;
+  }
+  fclose(f);
+  const char *name = strrchr(path, '/') != NULL ? strrchr(path, '/') + 1 : path;
+  printf("%-16s %4d %8u %10.0f %8.0f  %s / %s / %s\n", name, info.version, info.tagBytes,
+         1 / best, best * 1e9, info.title, info.artist, info.album);
+  if(info.pictureOffset != 0)
+    printf("%16s picture %s type %d, %u bytes at %u%s\n", "", info.pictureMime, info.pictureType,
+           info.pictureBytes, info.pictureOffset, info.pictureUnsync ? " unsynchronised" : "");
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  int opt, rounds = 5, ret = 0;
+  while((opt = getopt(argc, argv, "n:")) != -1) {
+    if(opt == 'n') rounds = atoi(optarg) > 0 ? atoi(optarg) : 1;
+    else {
+      fprintf(stderr, "usage: %s [-n rounds] [file.mp3 ...]\n", argv[0]);
+      return 2;
+    }
+  }
+  printf("%-16s %4s %8s %10s %8s\n", "tag", "ver", "bytes", "tags/s", "ns/tag");
+  if(optind == argc) return bench_corpus(rounds) != 0;
+  for(int i = optind; i < argc; ++i) ret |= bench_file(argv[i], rounds);
+  return ret != 0;
+}
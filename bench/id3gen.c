@@ -0,0 +1,402 @@
+/* id3gen - writes the synthetic ID3v2 corpus used by id3bench.
+ *
+ * every case is a tag the way some tagger writes it: v2.2 from old iTunes,
+ * v2.3 in UTF-16 with and without unsynchronisation, v2.4 with syncsafe,
+ * per frame unsynchronised and iTunes' plain frame sizes, and tags that are
+ * cut short or lie about their sizes. the pictures are noise with plenty of
+ * 0xFF bytes so that unsynchronisation has something to do */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "gen.h"
+#include "id3gen.h"
+
+#define ENC_LATIN1 0
+#define ENC_UTF16 1
+#define ENC_UTF16BE 2
+#define ENC_UTF8 3
+
+static void put_be(byteWriter_t *w, uint32_t v, int bytes) {
+  while(bytes-- > 0) put_byte(w, v >> (bytes * 8));
+}
+
+static void put_syncsafe(byteWriter_t *w, uint32_t v) {
+  for(int shift = 21; shift >= 0; shift -= 7) put_byte(w, (v >> shift) & 0x7F);
+}
+
+/* a 0x00 after every 0xFF that is followed by 0x00, 0xE0 and up or nothing */
+static void put_unsync(byteWriter_t *w, const uint8_t *p, size_t n) {
+  for(size_t i = 0; i < n; ++i) {
+    put_byte(w, p[i]);
+    if(p[i] == 0xFF && (i + 1 == n || p[i + 1] == 0 || p[i + 1] >= 0xE0)) put_byte(w, 0);
+  }
+}
+
+static uint32_t next_cp(const char **s) {
+  const uint8_t *p = (const uint8_t *)*s;
+  uint32_t cp;
+  int n;
+  if(p[0] < 0x80) cp = p[0], n = 1;
+  else if(p[0] < 0xE0) cp = p[0] & 0x1F, n = 2;
+  else if(p[0] < 0xF0) cp = p[0] & 0x0F, n = 3;
+  else cp = p[0] & 0x07, n = 4;
+  for(int i = 1; i < n; ++i) cp = (cp << 6) | (p[i] & 0x3F);
+  *s += n;
+  return cp;
+}
+
+static void put_u16(byteWriter_t *w, uint16_t u, bool be) {
+  put_byte(w, be ? u >> 8 : u & 0xFF);
+  put_byte(w, be ? u & 0xFF : u >> 8);
+}
+
+/* utf8 in enc, UTF-16 little endian with a byte order mark */
+static void put_text(byteWriter_t *w, uint8_t enc, const char *utf8, bool terminate) {
+  if(enc == ENC_UTF8) {
+    put_bytes(w, utf8, strlen(utf8) + (terminate ? 1 : 0));
+    return;
+  }
+  bool be = enc == ENC_UTF16BE;
+  if(enc == ENC_UTF16) put_u16(w, 0xFEFF, false);
+  while(*utf8 != 0) {
+    uint32_t cp = next_cp(&utf8);
+    if(enc == ENC_LATIN1) put_byte(w, cp);
+    else if(cp < 0x10000) put_u16(w, cp, be);
+    else {
+      put_u16(w, 0xD800 + ((cp - 0x10000) >> 10), be);
+      put_u16(w, 0xDC00 + ((cp - 0x10000) & 0x3FF), be);
+    }
+  }
+  if(terminate == true) {
+    put_byte(w, 0);
+    if(enc == ENC_UTF16 || enc == ENC_UTF16BE) put_byte(w, 0);
+  }
+}
+
+/* v2.2 has 3 character ids and sizes, v2.4 frames are unsynchronised on
+ * their own (flag 0x02) and may carry the length before that (0x01) */
+static void put_frame(byteWriter_t *w, int major, const char *id, const byteWriter_t *p,
+                      uint8_t flags, bool plainSize) {
+  byteWriter_t body = {0};
+  if(flags & 0x01) put_syncsafe(&body, p->len);
+  if(flags & 0x02) put_unsync(&body, p->buf, p->len);
+  else put_bytes(&body, p->buf, p->len);
+  if(major == 2) {
+    put_bytes(w, id, 3);
+    put_be(w, body.len, 3);
+  } else {
+    put_bytes(w, id, 4);
+    if(major == 4 && plainSize == false) put_syncsafe(w, body.len);
+    else put_be(w, body.len, 4);
+    put_byte(w, 0);
+    put_byte(w, flags);
+  }
+  put_bytes(w, body.buf, body.len);
+  free(body.buf);
+}
+
+static void text_frame(byteWriter_t *w, int major, const char *id, uint8_t enc, const char *utf8,
+                       uint8_t flags) {
+  byteWriter_t p = {0};
+  put_byte(&p, enc);
+  put_text(&p, enc, utf8, major == 4);
+  put_frame(w, major, id, &p, flags, false);
+  free(p.buf);
+}
+
+static void user_frame(byteWriter_t *w, int major, uint8_t enc, const char *desc, const char *value) {
+  byteWriter_t p = {0};
+  put_byte(&p, enc);
+  put_text(&p, enc, desc, true);
+  put_text(&p, enc, value, false);
+  put_frame(w, major, major == 2 ? "TXX" : "TXXX", &p, 0, false);
+  free(p.buf);
+}
+
+static void volume_frame(byteWriter_t *w, const char *ident, int16_t adj) {
+  byteWriter_t p = {0};
+  put_bytes(&p, ident, strlen(ident) + 1);
+  put_byte(&p, 2); //front right, to be passed over
+  put_be(&p, 0x0100, 2);
+  put_byte(&p, 0);
+  put_byte(&p, 1); //master volume
+  put_be(&p, (uint16_t)adj, 2);
+  put_byte(&p, 16);
+  put_be(&p, 0x7FFF, 2);
+  put_frame(w, 4, "RVA2", &p, 0, false);
+  free(p.buf);
+}
+
+static uint8_t *noise(size_t n, uint32_t seed) {
+  uint8_t *b = malloc(n);
+  for(size_t i = 0; i < n; ++i) {
+    seed = seed * 1664525 + 1013904223;
+    b[i] = (seed >> 24) < 0x30 ? 0xFF : seed >> 16;
+  }
+  if(n >= 4) memcpy(b, "\xFF\xD8\xFF\xE0", 4);
+  return b;
+}
+
+static void picture_frame(byteWriter_t *w, int major, uint8_t enc, const char *mime, uint8_t type,
+                          const char *desc, const uint8_t *img, size_t n, uint8_t flags,
+                          bool plainSize) {
+  byteWriter_t p = {0};
+  put_byte(&p, enc);
+  if(major == 2) put_bytes(&p, strcmp(mime, "image/png") == 0 ? "PNG" : "JPG", 3);
+  else put_bytes(&p, mime, strlen(mime) + 1);
+  put_byte(&p, type);
+  put_text(&p, enc, desc, true);
+  put_bytes(&p, img, n);
+  put_frame(w, major, major == 2 ? "PIC" : "APIC", &p, flags, plainSize);
+  free(p.buf);
+}
+
+static void other_frame(byteWriter_t *w, int major, const char *id, size_t n, uint8_t flags) {
+  byteWriter_t p = {0};
+  uint8_t *b = noise(n, n);
+  put_bytes(&p, b, n);
+  put_frame(w, major, id, &p, flags, false);
+  free(b);
+  free(p.buf);
+}
+
+/* header, the frames (unsynchronised as a whole for v2.2 and v2.3 with
+ * flag 0x80), padding, the v2.4 footer (flag 0x10) and some audio */
+static void finish(id3GenTag_t *t, int major, uint8_t flags, const byteWriter_t *ext,
+                   const byteWriter_t *frames, size_t padding) {
+  byteWriter_t body = {0}, out = {0};
+  if(ext != NULL) put_bytes(&body, ext->buf, ext->len);
+  put_bytes(&body, frames->buf, frames->len);
+  for(size_t i = 0; i < padding; ++i) put_byte(&body, 0);
+  put_bytes(&out, "ID3", 3);
+  put_byte(&out, major);
+  put_byte(&out, 0);
+  put_byte(&out, flags);
+  size_t at = out.len;
+  put_syncsafe(&out, 0);
+  if((flags & 0x80) && major < 4) put_unsync(&out, body.buf, body.len);
+  else put_bytes(&out, body.buf, body.len);
+  size_t size = out.len - ID3_HEADER;
+  for(int i = 0; i < 4; ++i) out.buf[at + i] = (size >> (21 - i * 7)) & 0x7F;
+  if(major == 4 && (flags & 0x10)) {
+    put_bytes(&out, "3DI", 3);
+    put_bytes(&out, out.buf + 3, 7);
+  }
+  put_bytes(&out, "\xFF\xFB\x90\x64\x00\x00\x00\x00", 8);
+  t->data = out.buf;
+  t->len = out.len;
+  t->expect.version = major;
+  t->expect.tagBytes = out.len - 8;
+  free(body.buf);
+}
+
+static void set_picture(id3GenTag_t *t, uint8_t *img, size_t n, const char *mime, uint8_t type,
+                        bool unsync) {
+  t->picture = img;
+  t->pictureLen = n;
+  t->expect.pictureOffset = 1; //any
+  t->expect.pictureBytes = n;
+  t->expect.pictureType = type;
+  t->expect.pictureUnsync = unsync;
+  strcpy(t->expect.pictureMime, mime);
+}
+
+static void v22_latin1(id3GenTag_t *t) {
+  byteWriter_t w = {0};
+  uint8_t *img = noise(3000, 22);
+  text_frame(&w, 2, "TT2", ENC_LATIN1, "Café del Mar", 0);
+  text_frame(&w, 2, "TP1", ENC_LATIN1, "Señor Coconut", 0);
+  text_frame(&w, 2, "TAL", ENC_LATIN1, "Yellow Fever!", 0);
+  text_frame(&w, 2, "TRK", ENC_LATIN1, "7/12", 0);
+  other_frame(&w, 2, "COM", 200, 0);
+  picture_frame(&w, 2, ENC_LATIN1, "image/jpeg", ID3_FRONT_COVER, "", img, 3000, 0, false);
+  finish(t, 2, 0, NULL, &w, 256);
+  strcpy(t->expect.title, "Café del Mar");
+  strcpy(t->expect.artist, "Señor Coconut");
+  strcpy(t->expect.album, "Yellow Fever!");
+  t->expect.track = 7;
+  set_picture(t, img, 3000, "image/jpeg", ID3_FRONT_COVER, false);
+  free(w.buf);
+}
+
+/* unsync tags also get a compressed title in front of the real one */
+static void v23_frames(byteWriter_t *w, id3GenTag_t *t, bool unsync) {
+  uint8_t *back = noise(1000, 1), *front = noise(20000, 2);
+  if(unsync == true) other_frame(w, 3, "TIT2", 64, 0x80);
+  text_frame(w, 3, "TIT2", ENC_UTF16, "夜に駆ける 𝄞", 0);
+  text_frame(w, 3, "TPE1", ENC_UTF16, "YOASOBI", 0);
+  text_frame(w, 3, "TALB", ENC_LATIN1, "THE BOOK", 0);
+  text_frame(w, 3, "TLEN", ENC_LATIN1, "261000", 0);
+  other_frame(w, 3, "COMM", 300, 0);
+  user_frame(w, 3, ENC_UTF16, "REPLAYGAIN_TRACK_GAIN", "-6.50 dB");
+  user_frame(w, 3, ENC_LATIN1, "replaygain_album_gain", "-7.25 dB");
+  picture_frame(w, 3, ENC_LATIN1, "image/png", 0, "", back, 1000, 0, false);
+  picture_frame(w, 3, ENC_UTF16, "image/jpeg", ID3_FRONT_COVER, "Cover", front, 20000, 0, false);
+  strcpy(t->expect.title, "夜に駆ける 𝄞");
+  strcpy(t->expect.artist, "YOASOBI");
+  strcpy(t->expect.album, "THE BOOK");
+  t->expect.lengthMs = 261000;
+  t->expect.trackGain = -650;
+  t->expect.albumGain = -725;
+  set_picture(t, front, 20000, "image/jpeg", ID3_FRONT_COVER, unsync);
+  free(back);
+}
+
+static void v23_utf16(id3GenTag_t *t) {
+  byteWriter_t w = {0};
+  v23_frames(&w, t, false);
+  finish(t, 3, 0, NULL, &w, 2048);
+  free(w.buf);
+}
+
+/* unsynchronised as a whole, with an extended header */
+static void v23_unsync(id3GenTag_t *t) {
+  byteWriter_t w = {0}, ext = {0};
+  v23_frames(&w, t, true);
+  put_be(&ext, 6, 4);
+  put_be(&ext, 0, 2);
+  put_be(&ext, 1024, 4);
+  finish(t, 3, 0xC0, &ext, &w, 1024);
+  free(w.buf);
+  free(ext.buf);
+}
+
+static void v24_utf8(id3GenTag_t *t) {
+  byteWriter_t w = {0};
+  uint8_t *img = noise(200000, 24);
+  text_frame(&w, 4, "TIT2", ENC_UTF8, "Ágætis byrjun", 0);
+  text_frame(&w, 4, "TPE1", ENC_UTF8, "Sigur Rós", 0);
+  text_frame(&w, 4, "TALB", ENC_UTF8, "Ágætis byrjun", 0);
+  text_frame(&w, 4, "TRCK", ENC_UTF8, "3", 0);
+  volume_frame(&w, "track", -1792);
+  volume_frame(&w, "album", -2048);
+  picture_frame(&w, 4, ENC_UTF8, "image/jpeg", ID3_FRONT_COVER, "Front", img, 200000, 0, false);
+  finish(t, 4, 0x10, NULL, &w, 0);
+  strcpy(t->expect.title, "Ágætis byrjun");
+  strcpy(t->expect.artist, "Sigur Rós");
+  strcpy(t->expect.album, "Ágætis byrjun");
+  t->expect.track = 3;
+  t->expect.trackGain = -350;
+  t->expect.albumGain = -400;
+  set_picture(t, img, 200000, "image/jpeg", ID3_FRONT_COVER, false);
+  free(w.buf);
+}
+
+/* frames unsynchronised one by one, with data length indicators */
+static void v24_unsync(id3GenTag_t *t) {
+  byteWriter_t w = {0};
+  uint8_t *img = noise(50000, 42);
+  text_frame(&w, 4, "TIT2", ENC_UTF16BE, "Jóga", 0x03);
+  text_frame(&w, 4, "TPE1", ENC_UTF16, "Björk", 0x02);
+  text_frame(&w, 4, "TALB", ENC_LATIN1, "Homogenic", 0);
+  other_frame(&w, 4, "PRIV", 500, 0x03);
+  picture_frame(&w, 4, ENC_LATIN1, "image/jpeg", ID3_FRONT_COVER, "", img, 50000, 0x03, false);
+  finish(t, 4, 0, NULL, &w, 512);
+  strcpy(t->expect.title, "Jóga");
+  strcpy(t->expect.artist, "Björk");
+  strcpy(t->expect.album, "Homogenic");
+  set_picture(t, img, 50000, "image/jpeg", ID3_FRONT_COVER, true);
+  free(w.buf);
+}
+
+/* iTunes' plain frame sizes in a v2.4 tag, a title too long for the library */
+static void v24_itunes(id3GenTag_t *t) {
+  byteWriter_t w = {0}, p = {0};
+  char title[256] = "";
+  uint8_t *img = noise(5000, 7);
+  for(int i = 0; i < 100; ++i) strcat(title, "ü");
+  put_byte(&p, ENC_UTF8);
+  put_text(&p, ENC_UTF8, title, true);
+  put_frame(&w, 4, "TIT2", &p, 0, true);
+  text_frame(&w, 4, "TPE1", ENC_UTF8, "Artist", 0);
+  picture_frame(&w, 4, ENC_LATIN1, "image/jpeg", 0, "", img, 5000, 0, true);
+  finish(t, 4, 0, NULL, &w, 1024);
+  title[63 * 2] = 0; //whole characters only
+  strcpy(t->expect.title, title);
+  strcpy(t->expect.artist, "Artist");
+  set_picture(t, img, 5000, "image/jpeg", 0, false);
+  free(w.buf);
+  free(p.buf);
+}
+
+/* a frame size running far past the end of the tag */
+static void bad_size(id3GenTag_t *t) {
+  byteWriter_t w = {0};
+  text_frame(&w, 3, "TIT2", ENC_LATIN1, "Title", 0);
+  put_bytes(&w, "TALB\x7F\xFF\xFF\xF0\x00\x00\x00" "Album", 16);
+  text_frame(&w, 3, "TPE1", ENC_LATIN1, "Artist", 0);
+  finish(t, 3, 0, NULL, &w, 64);
+  strcpy(t->expect.title, "Title");
+  free(w.buf);
+}
+
+/* a file cut off inside the picture */
+static void truncated(id3GenTag_t *t) {
+  byteWriter_t w = {0};
+  uint8_t *img = noise(30000, 5);
+  text_frame(&w, 3, "TIT2", ENC_LATIN1, "Title", 0);
+  picture_frame(&w, 3, ENC_LATIN1, "image/jpeg", ID3_FRONT_COVER, "", img, 30000, 0, false);
+  text_frame(&w, 3, "TPE1", ENC_LATIN1, "Artist", 0);
+  finish(t, 3, 0, NULL, &w, 0);
+  t->len = 10000;
+  strcpy(t->expect.title, "Title");
+  set_picture(t, NULL, 30000, "image/jpeg", ID3_FRONT_COVER, false);
+  free(img);
+  free(w.buf);
+}
+
+static void no_tag(id3GenTag_t *t) {
+  t->data = noise(1000, 9);
+  t->len = 1000;
+  t->result = -1;
+}
+
+const id3GenCase_t id3GenCorpus[] = {
+  {"v22-latin1", v22_latin1},
+  {"v23-utf16", v23_utf16},
+  {"v23-unsync", v23_unsync},
+  {"v24-utf8", v24_utf8},
+  {"v24-unsync", v24_unsync},
+  {"v24-itunes", v24_itunes},
+  {"bad-size", bad_size},
+  {"truncated", truncated},
+  {"no-tag", no_tag},
+  {NULL, NULL}
+};
+
+int id3gen_tag(const id3GenCase_t *c, id3GenTag_t *t) {
+  memset(t, 0, sizeof(id3GenTag_t));
+  t->expect.trackGain = t->expect.albumGain = ID3_GAIN_NONE;
+  c->build(t);
+  return t->data == NULL ? -1 : 0;
+}
+
+void id3gen_free(id3GenTag_t *t) {
+  free(t->data);
+  free(t->picture);
+  memset(t, 0, sizeof(id3GenTag_t));
+}
+
+#ifdef ID3GEN_MAIN
+int main(int argc, char **argv) {
+  const char *dir = argc > 1 ? argv[1] : ".";
+  char path[512];
+  for(const id3GenCase_t *c = id3GenCorpus; c->name != NULL; ++c) {
+    id3GenTag_t t;
+    if(id3gen_tag(c, &t) != 0) return 1;
+    snprintf(path, sizeof(path), "%s/%s.mp3", dir, c->name);
+    FILE *f = fopen(path, "wb");
+    if(f == NULL || fwrite(t.data, 1, t.len, f) != t.len) {
+      fprintf(stderr, "id3gen: cannot write %s\n", path);
+      return 1;
+    }
+    fclose(f);
+    printf("%s %zu bytes\n", path, t.len);
+    id3gen_free(&t);
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,28 @@
+#ifndef _ID3GEN_H_
+#define _ID3GEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "id3_tag.h"
+
+/* a tag and what id3_parse() has to make of it. picture is the image as
+ * it was before unsynchronisation */
+typedef struct {
+  uint8_t *data;
+  size_t len;
+  int result;
+  id3Info_t expect;
+  uint8_t *picture;
+  size_t pictureLen;
+} id3GenTag_t;
+
+typedef struct {
+  const char *name;
+  void (*build)(id3GenTag_t *t);
+} id3GenCase_t;
+
+extern const id3GenCase_t id3GenCorpus[];
+
+int id3gen_tag(const id3GenCase_t *c, id3GenTag_t *t);
+void id3gen_free(id3GenTag_t *t);
+#endif
@@ -0,0 +1,197 @@
+/* jpegbench - decodes baseline JPEGs through main/picojpeg.c with the
+ * Huffman lookahead tables and with the original bit at a time decoder
+ * (pjpeg_bitwise.c), and reports the time of both.
+ *
+ *   jpegbench [-n rounds] [file.jpg ...]
+ *
+ * without files the synthetic corpus from jpeggen.c is decoded, album cover
+ * sized. the two decoders have to agree on every pixel, full and reduced,
+ * and the full decode has to be close to the picture it was encoded from,
+ * otherwise the run fails. files are decoded the same way and compared
+ * between the decoders only, ones picojpeg can't decode are skipped. the
+ * data comes through the callback in the 252 byte pieces picojpeg asks for,
+ * like the cover loader feeds it */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "picojpeg.h"
+#include "jpeggen.h"
+#include "bench.h"
+
+#define ROUND_SECONDS 0.05
+#define MIN_PSNR 30.0
+
+typedef unsigned char (*decodeInit_t)(pjpeg_image_info_t *, pjpeg_need_bytes_callback_t, void *, unsigned char);
+typedef unsigned char (*decodeMcu_t)(void);
+
+unsigned char pjpeg_bitwise_decode_init(pjpeg_image_info_t *pInfo, pjpeg_need_bytes_callback_t pNeed_bytes_callback,
+                                        void *pCallback_data, unsigned char reduce);
+unsigned char pjpeg_bitwise_decode_mcu(void);
+
+typedef struct {
+  const uint8_t *data;
+  size_t len, pos;
+} memStream_t;
+
+/* a decoded picture, rgb, one pixel per 8x8 block when reduced */
+typedef struct {
+  uint8_t *rgb;
+  int width, height;
+} picture_t;
+
+static unsigned char mem_read(unsigned char *buf, unsigned char size, unsigned char *read, void *ctx) {
+  memStream_t *m = ctx;
+  size_t n = m->len - m->pos < size ? m->len - m->pos : size;
+  memcpy(buf, m->data + m->pos, n);
+  m->pos += n;
+  *read = n;
+  return 0;
+}
+
+static int decode(decodeInit_t init, decodeMcu_t mcu, const uint8_t *data, size_t len, int reduce,
+                  picture_t *pic) {
+  memStream_t m = {data, len, 0};
+  pjpeg_image_info_t info;
+  unsigned char status = init(&info, mem_read, &m, reduce);
+  if(status != 0) return status;
+  int s = reduce ? 8 : 1;
+  int mw = info.m_MCUWidth / s, mh = info.m_MCUHeight / s;
+  pic->width = (info.m_width + s - 1) / s;
+  pic->height = (info.m_height + s - 1) / s;
+  if(pic->rgb == NULL) pic->rgb = malloc((size_t)pic->width * pic->height * 3);
+  const uint8_t *R = info.m_pMCUBufR;
+  const uint8_t *G = info.m_scanType == PJPG_GRAYSCALE ? R : info.m_pMCUBufG;
+  const uint8_t *B = info.m_scanType == PJPG_GRAYSCALE ? R : info.m_pMCUBufB;
+  for(int my = 0; my < info.m_MCUSPerCol; ++my) {
+    for(int mx = 0; mx < info.m_MCUSPerRow; ++mx) {
+      status = mcu();
+      if(status != 0) return status;
+      for(int py = 0; py < mh && my * mh + py < pic->height; ++py) {
+        for(int px = 0; px < mw && mx * mw + px < pic->width; ++px) {
+          int i = reduce ? py * 128 + px * 64 : (py >> 3) * 128 + (px >> 3) * 64 + (py & 7) * 8 + (px & 7);
+          uint8_t *p = pic->rgb + ((size_t)(my * mh + py) * pic->width + mx * mw + px) * 3;
+          p[0] = R[i];
+          p[1] = G[i];
+          p[2] = B[i];
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/* best of rounds in seconds per picture */
+static double bench(decodeInit_t init, decodeMcu_t mcu, const uint8_t *data, size_t len, int reduce,
+                    int rounds, picture_t *pic, int *status) {
+  double best = 1e30;
+  for(int r = 0; r < rounds; ++r) {
+    long count = 0;
+    double start = bench_seconds(), t;
+    do {
+      *status = decode(init, mcu, data, len, reduce, pic);
+      count++;
+    } while((t = bench_seconds() - start) < ROUND_SECONDS && *status == 0);
+    if(t / count < best) best = t / count;
+  }
+  return best;
+}
+
+static double psnr(const picture_t *pic, const jpegGenImage_t *img) {
+  double err = 0;
+  size_t n = (size_t)img->width * img->height;
+  for(size_t i = 0; i < n; ++i) {
+    for(int k = 0; k < img->comps; ++k) {
+      double d = (double)pic->rgb[i * 3 + k] - img->pixels[i * img->comps + k];
+      err += d * d;
+    }
+  }
+  err /= n * img->comps;
+  return err == 0 ? 99 : 10 * log10(255.0 * 255.0 / err);
+}
+
+/* both decoders, full and reduced. img is the source picture or NULL */
+static int run(const char *name, const uint8_t *data, size_t len, const jpegGenImage_t *img, int rounds) {
+  int fail = 0;
+  for(int reduce = 0; reduce < 2; ++reduce) {
+    picture_t before = {NULL, 0, 0}, after = {NULL, 0, 0};
+    int sb, sa;
+    double tb = bench(pjpeg_bitwise_decode_init, pjpeg_bitwise_decode_mcu, data, len, reduce, rounds, &before, &sb);
+    double ta = bench(pjpeg_decode_init, pjpeg_decode_mcu, data, len, reduce, rounds, &after, &sa);
+    const char *verdict = "ok";
+    double q = 0;
+    if(sa != 0 && sa == sb && img == NULL) {
+      verdict = "unsupported"; //progressive, CMYK, ...
+    } else if(sa != 0 || sb != 0) {
+      printf("  %s: decode error %d, bit at a time %d\n", name, sa, sb);
+      verdict = "FAIL";
+    } else if(before.width != after.width || before.height != after.height
+              || memcmp(before.rgb, after.rgb, (size_t)after.width * after.height * 3) != 0) {
+      printf("  %s: the decoders disagree\n", name);
+      verdict = "FAIL";
+    } else if(img != NULL && reduce == 0 && (q = psnr(&after, img)) < MIN_PSNR) {
+      printf("  %s: %.1f dB from the source, expected %.0f\n", name, q, MIN_PSNR);
+      verdict = "FAIL";
+    }
+    char db[16] = "-";
+    if(q != 0) snprintf(db, sizeof(db), "%.1f", q);
+    printf("%-16s %6s %5dx%-5d %9.2f %9.2f %6.2fx %7s  %s\n", name, reduce ? "reduce" : "full",
+           after.width, after.height, tb * 1e3, ta * 1e3, tb / ta, db, verdict);
+    fail |= verdict[0] == 'F';
+    free(before.rgb);
+    free(after.rgb);
+  }
+  return fail;
+}
+
+static uint8_t *load(const char *path, size_t *len) {
+  FILE *f = fopen(path, "rb");
+  if(f == NULL) return NULL;
+  fseek(f, 0, SEEK_END);
+  *len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  uint8_t *data = malloc(*len);
+  if(data != NULL && fread(data, 1, *len, f) != *len) {
+    free(data);
+    data = NULL;
+  }
+  fclose(f);
+  return data;
+}
+
+int main(int argc, char **argv) {
+  int opt, rounds = 5, fail = 0;
+  while((opt = getopt(argc, argv, "n:")) != -1) {
+    if(opt == 'n') rounds = atoi(optarg) > 0 ? atoi(optarg) : 1;
+    else {
+      fprintf(stderr, "usage: %s [-n rounds] [file.jpg ...]\n", argv[0]);
+      return 2;
+    }
+  }
+  printf("%-16s %6s %11s %9s %9s %7s %7s\n", "picture", "mode", "pixels", "bit ms", "table ms", "speed", "dB");
+  if(optind == argc) {
+    for(const jpegGenCase_t *c = jpegGenCorpus; c->name != NULL; ++c) {
+      jpegGenImage_t img;
+      if(jpeggen_image(c, &img) != 0) return 1;
+      fail |= run(c->name, img.data, img.len, &img, rounds);
+      jpeggen_free(&img);
+    }
+    return fail;
+  }
+  for(int i = optind; i < argc; ++i) {
+    size_t len;
+    uint8_t *data = load(argv[i], &len);
+    if(data == NULL) {
+      fprintf(stderr, "jpegbench: cannot read %s\n", argv[i]);
+      fail = 1;
+      continue;
+    }
+    const char *name = strrchr(argv[i], '/') != NULL ? strrchr(argv[i], '/') + 1 : argv[i];
+    fail |= run(name, data, len, NULL, rounds);
+    free(data);
+  }
+  return fail;
+}
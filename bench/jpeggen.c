@@ -0,0 +1,391 @@
+/* jpeggen - writes the synthetic baseline JPEG corpus used by jpegbench.
+ *
+ * like the audio generators this is a small encoder of its own, there is no
+ * libjpeg on the build hosts. it uses the Annex K quantisation and Huffman
+ * tables, scaled by quality the way libjpeg does, and draws something like
+ * an album cover: gradients, soft shapes, small high contrast glyphs and
+ * grain. it keeps the picture it encoded so the decoder output can be
+ * compared with it */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "gen.h"
+#include "jpeggen.h"
+
+/* entropy coded segment on top of the byte writer */
+typedef struct {
+  byteWriter_t *out;
+  uint32_t acc;
+  int bits;
+} scanWriter_t;
+
+typedef struct {
+  uint16_t code[256];
+  uint8_t size[256];
+} huffCode_t;
+
+const jpegGenCase_t jpegGenCorpus[] = {
+  {"cover_h2v2", 500, 500, 2, 2, 85, 0},
+  {"cover_h1v1", 500, 500, 1, 1, 90, 0},
+  {"cover_h2v1", 500, 500, 2, 1, 85, 0},
+  {"cover_h1v2", 500, 500, 1, 2, 85, 0},
+  {"cover_gray", 500, 500, 0, 0, 85, 0},
+  {"cover_h2v2_q98", 500, 500, 2, 2, 98, 0},
+  {"odd_h2v2_rst5", 333, 217, 2, 2, 75, 5},
+  {"odd_h1v1_rst1", 61, 45, 1, 1, 50, 1},
+  {"large_h2v2", 1200, 1200, 2, 2, 85, 0},
+  {NULL}
+};
+
+static const uint8_t zigzag[64] = {
+  0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+//Annex K.1, natural order
+static const uint8_t quantLuma[64] = {
+  16, 11, 10, 16, 24, 40, 51, 61, 12, 12, 14, 19, 26, 58, 60, 55,
+  14, 13, 16, 24, 40, 57, 69, 56, 14, 17, 22, 29, 51, 87, 80, 62,
+  18, 22, 37, 56, 68, 109, 103, 77, 24, 35, 55, 64, 81, 104, 113, 92,
+  49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99
+};
+static const uint8_t quantChroma[64] = {
+  17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99,
+  24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99
+};
+
+//Annex K.3
+static const uint8_t dcLumaBits[16] = {0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+static const uint8_t dcChromaBits[16] = {0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+static const uint8_t dcVals[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+static const uint8_t acLumaBits[16] = {0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D};
+static const uint8_t acLumaVals[162] = {
+  0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+  0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0,
+  0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+  0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+  0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5,
+  0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+  0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+  0xF9, 0xFA
+};
+static const uint8_t acChromaBits[16] = {0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77};
+static const uint8_t acChromaVals[162] = {
+  0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+  0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0,
+  0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26,
+  0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+  0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+  0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+  0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5,
+  0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+  0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+  0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+  0xF9, 0xFA
+};
+
+static void put_word(byteWriter_t *w, uint16_t v) {
+  put_byte(w, v >> 8);
+  put_byte(w, v & 0xFF);
+}
+
+/* entropy coded bits, a zero stuffed after every 0xFF */
+static void put_scan(scanWriter_t *s, uint32_t val, int n) {
+  while(n-- > 0) {
+    s->acc = (s->acc << 1) | ((val >> n) & 1);
+    if(++s->bits == 8) {
+      put_byte(s->out, s->acc);
+      if(s->acc == 0xFF) put_byte(s->out, 0);
+      s->acc = 0;
+      s->bits = 0;
+    }
+  }
+}
+
+static void flush_scan(scanWriter_t *s) {
+  while(s->bits != 0) put_scan(s, 1, 1);
+}
+
+static void huff_build(const uint8_t *bits, const uint8_t *vals, huffCode_t *h) {
+  uint16_t code = 0;
+  int k = 0;
+  memset(h, 0, sizeof(huffCode_t));
+  for(int len = 1; len <= 16; ++len) {
+    for(int i = 0; i < bits[len - 1]; ++i, ++k) {
+      h->code[vals[k]] = code++;
+      h->size[vals[k]] = len;
+    }
+    code <<= 1;
+  }
+}
+
+static void put_dht(byteWriter_t *w, int index, const uint8_t *bits, const uint8_t *vals) {
+  int count = 0;
+  for(int i = 0; i < 16; ++i) count += bits[i];
+  put_word(w, 0xFFC4);
+  put_word(w, 2 + 1 + 16 + count);
+  put_byte(w, index);
+  for(int i = 0; i < 16; ++i) put_byte(w, bits[i]);
+  for(int i = 0; i < count; ++i) put_byte(w, vals[i]);
+}
+
+static void scale_quant(const uint8_t *base, int quality, uint8_t *q) {
+  int scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+  for(int i = 0; i < 64; ++i) {
+    int v = (base[i] * scale + 50) / 100;
+    q[i] = v < 1 ? 1 : v > 255 ? 255 : v;
+  }
+}
+
+static int category(int v) {
+  int n = 0;
+  if(v < 0) v = -v;
+  while(v) {
+    n++;
+    v >>= 1;
+  }
+  return n;
+}
+
+static void put_value(scanWriter_t *s, int v, int n) {
+  put_scan(s, v < 0 ? v + (1 << n) - 1 : v, n);
+}
+
+/* forward DCT of a level shifted 8x8 block, quantised and entropy coded */
+static void put_block(scanWriter_t *s, const float *in, const uint8_t *q, int *lastDC,
+                      const huffCode_t *dc, const huffCode_t *ac) {
+  static float cosTab[8][8];
+  float tmp[64], coef[64];
+  int zz[64];
+  if(cosTab[0][0] == 0) {
+    for(int u = 0; u < 8; ++u)
+      for(int x = 0; x < 8; ++x)
+        cosTab[u][x] = (u ? 0.5f : 0.35355339f) * cosf((2 * x + 1) * u * 3.14159265f / 16);
+  }
+  for(int y = 0; y < 8; ++y) {
+    for(int u = 0; u < 8; ++u) {
+      float s = 0;
+      for(int x = 0; x < 8; ++x) s += in[y * 8 + x] * cosTab[u][x];
+      tmp[y * 8 + u] = s;
+    }
+  }
+  for(int v = 0; v < 8; ++v) {
+    for(int u = 0; u < 8; ++u) {
+      float s = 0;
+      for(int y = 0; y < 8; ++y) s += tmp[y * 8 + u] * cosTab[v][y];
+      coef[v * 8 + u] = s;
+    }
+  }
+  for(int i = 0; i < 64; ++i) {
+    zz[i] = (int)lroundf(coef[zigzag[i]] / q[zigzag[i]]);
+    //AC categories stop at 10 bits
+    if(i > 0) zz[i] = zz[i] > 1023 ? 1023 : zz[i] < -1023 ? -1023 : zz[i];
+  }
+  int diff = zz[0] - *lastDC, n = category(diff);
+  *lastDC = zz[0];
+  put_scan(s, dc->code[n], dc->size[n]);
+  put_value(s, diff, n);
+  int run = 0;
+  for(int i = 1; i < 64; ++i) {
+    if(zz[i] == 0) {
+      run++;
+      continue;
+    }
+    for(; run > 15; run -= 16) put_scan(s, ac->code[0xF0], ac->size[0xF0]);
+    n = category(zz[i]);
+    put_scan(s, ac->code[run << 4 | n], ac->size[run << 4 | n]);
+    put_value(s, zz[i], n);
+    run = 0;
+  }
+  if(run > 0) put_scan(s, ac->code[0], ac->size[0]);
+}
+
+/* gradient background, a few soft discs, rows of glyph sized bars, grain */
+static void draw(uint8_t *px, int width, int height, int comps) {
+  uint8_t c0[3], c1[3];
+  struct {
+    int x, y, r;
+    uint8_t c[3];
+  } discs[6];
+  for(int k = 0; k < 3; ++k) {
+    c0[k] = gen_rnd(256);
+    c1[k] = gen_rnd(256);
+  }
+  for(int d = 0; d < 6; ++d) {
+    discs[d].x = gen_rnd(width);
+    discs[d].y = gen_rnd(height);
+    discs[d].r = 4 + gen_rnd(width / 3 + 1);
+    for(int k = 0; k < 3; ++k) discs[d].c[k] = gen_rnd(256);
+  }
+  for(int y = 0; y < height; ++y) {
+    for(int x = 0; x < width; ++x) {
+      float t = (float)(x + y) / (width + height), rgb[3];
+      for(int k = 0; k < 3; ++k) rgb[k] = c0[k] + (c1[k] - c0[k]) * t;
+      for(int d = 0; d < 6; ++d) {
+        float dist = sqrtf((float)(x - discs[d].x) * (x - discs[d].x) + (float)(y - discs[d].y) * (y - discs[d].y));
+        float a = dist < discs[d].r - 3 ? 1 : dist > discs[d].r + 3 ? 0 : (discs[d].r + 3 - dist) / 6;
+        for(int k = 0; k < 3; ++k) rgb[k] += (discs[d].c[k] - rgb[k]) * a;
+      }
+      //a title along the bottom
+      if(y > height * 4 / 5 && y < height * 9 / 10 && (x / 3) % 4 != 0 && ((x / 12) * 7 + y / 4) % 5 != 0
+         && x > width / 10 && x < width * 9 / 10)
+        rgb[0] = rgb[1] = rgb[2] = 250;
+      int grain = (int)gen_rnd(13) - 6;
+      for(int k = 0; k < 3; ++k) {
+        int v = (int)rgb[k] + grain;
+        rgb[k] = v < 0 ? 0 : v > 255 ? 255 : v;
+      }
+      if(comps == 1) px[y * width + x] = (uint8_t)(0.299f * rgb[0] + 0.587f * rgb[1] + 0.114f * rgb[2] + 0.5f);
+      else for(int k = 0; k < 3; ++k) px[(y * width + x) * 3 + k] = (uint8_t)rgb[k];
+    }
+  }
+}
+
+/* component c (0 Y, 1 Cb, 2 Cr) of the picture averaged over sx x sy pixels
+ * at x, y, edges replicated */
+static float sample(const jpegGenImage_t *img, int c, int x, int y, int sx, int sy) {
+  float sum = 0;
+  for(int j = 0; j < sy; ++j) {
+    for(int i = 0; i < sx; ++i) {
+      int px = x + i < img->width ? x + i : img->width - 1, py = y + j < img->height ? y + j : img->height - 1;
+      const uint8_t *p = img->pixels + (py * img->width + px) * img->comps;
+      if(img->comps == 1) sum += p[0];
+      else if(c == 0) sum += 0.299f * p[0] + 0.587f * p[1] + 0.114f * p[2];
+      else if(c == 1) sum += -0.168736f * p[0] - 0.331264f * p[1] + 0.5f * p[2] + 128;
+      else sum += 0.5f * p[0] - 0.418688f * p[1] - 0.081312f * p[2] + 128;
+    }
+  }
+  return sum / (sx * sy) - 128;
+}
+
+int jpeggen_image(const jpegGenCase_t *c, jpegGenImage_t *img) {
+  byteWriter_t w = {0};
+  scanWriter_t s = {&w, 0, 0};
+  uint8_t qLuma[64], qChroma[64];
+  huffCode_t dcL, dcC, acL, acC;
+  int comps = c->h == 0 ? 1 : 3, h = c->h ? c->h : 1, v = c->v ? c->v : 1;
+  memset(img, 0, sizeof(jpegGenImage_t));
+  gen_seed(c->name);
+  img->width = c->width;
+  img->height = c->height;
+  img->comps = comps;
+  img->pixels = malloc((size_t)c->width * c->height * comps);
+  if(img->pixels == NULL) return -1;
+  draw(img->pixels, c->width, c->height, comps);
+
+  scale_quant(quantLuma, c->quality, qLuma);
+  scale_quant(quantChroma, c->quality, qChroma);
+  huff_build(dcLumaBits, dcVals, &dcL);
+  huff_build(dcChromaBits, dcVals, &dcC);
+  huff_build(acLumaBits, acLumaVals, &acL);
+  huff_build(acChromaBits, acChromaVals, &acC);
+
+  put_word(&w, 0xFFD8);
+  put_word(&w, 0xFFDB);
+  put_word(&w, 2 + 65 * (comps == 1 ? 1 : 2));
+  put_byte(&w, 0);
+  for(int i = 0; i < 64; ++i) put_byte(&w, qLuma[zigzag[i]]);
+  if(comps == 3) {
+    put_byte(&w, 1);
+    for(int i = 0; i < 64; ++i) put_byte(&w, qChroma[zigzag[i]]);
+  }
+  put_word(&w, 0xFFC0);
+  put_word(&w, 8 + 3 * comps);
+  put_byte(&w, 8);
+  put_word(&w, c->height);
+  put_word(&w, c->width);
+  put_byte(&w, comps);
+  for(int k = 0; k < comps; ++k) {
+    put_byte(&w, k + 1);
+    put_byte(&w, k == 0 ? h << 4 | v : 0x11);
+    put_byte(&w, k == 0 ? 0 : 1);
+  }
+  put_dht(&w, 0x00, dcLumaBits, dcVals);
+  put_dht(&w, 0x10, acLumaBits, acLumaVals);
+  if(comps == 3) {
+    put_dht(&w, 0x01, dcChromaBits, dcVals);
+    put_dht(&w, 0x11, acChromaBits, acChromaVals);
+  }
+  if(c->restart) {
+    put_word(&w, 0xFFDD);
+    put_word(&w, 4);
+    put_word(&w, c->restart);
+  }
+  put_word(&w, 0xFFDA);
+  put_word(&w, 6 + 2 * comps);
+  put_byte(&w, comps);
+  for(int k = 0; k < comps; ++k) {
+    put_byte(&w, k + 1);
+    put_byte(&w, k == 0 ? 0x00 : 0x11);
+  }
+  put_byte(&w, 0);
+  put_byte(&w, 63);
+  put_byte(&w, 0);
+
+  int mcuW = 8 * h, mcuH = 8 * v, mcusX = (c->width + mcuW - 1) / mcuW, mcusY = (c->height + mcuH - 1) / mcuH;
+  int lastDC[3] = {0, 0, 0}, mcu = 0, restarts = 0;
+  float block[64];
+  for(int my = 0; my < mcusY; ++my) {
+    for(int mx = 0; mx < mcusX; ++mx, ++mcu) {
+      if(c->restart && mcu > 0 && mcu % c->restart == 0) {
+        flush_scan(&s);
+        put_word(&w, 0xFFD0 + (restarts++ & 7));
+        lastDC[0] = lastDC[1] = lastDC[2] = 0;
+      }
+      for(int by = 0; by < v; ++by) {
+        for(int bx = 0; bx < h; ++bx) {
+          for(int i = 0; i < 64; ++i)
+            block[i] = sample(img, 0, mx * mcuW + bx * 8 + i % 8, my * mcuH + by * 8 + i / 8, 1, 1);
+          put_block(&s, block, qLuma, &lastDC[0], &dcL, &acL);
+        }
+      }
+      for(int k = 1; k < comps; ++k) {
+        for(int i = 0; i < 64; ++i)
+          block[i] = sample(img, k, mx * mcuW + (i % 8) * h, my * mcuH + (i / 8) * v, h, v);
+        put_block(&s, block, qChroma, &lastDC[k], &dcC, &acC);
+      }
+    }
+  }
+  flush_scan(&s);
+  put_word(&w, 0xFFD9);
+  img->data = w.buf;
+  img->len = w.len;
+  return 0;
+}
+
+void jpeggen_free(jpegGenImage_t *img) {
+  free(img->data);
+  free(img->pixels);
+  memset(img, 0, sizeof(jpegGenImage_t));
+}
+
+#ifdef JPEGGEN_MAIN
+int main(int argc, char **argv) {
+  const char *dir = argc > 1 ? argv[1] : ".";
+  char path[512];
+  for(const jpegGenCase_t *c = jpegGenCorpus; c->name != NULL; ++c) {
+    jpegGenImage_t img;
+    if(jpeggen_image(c, &img) != 0) return 1;
+    snprintf(path, sizeof(path), "%s/%s.jpg", dir, c->name);
+    FILE *f = fopen(path, "wb");
+    if(f == NULL || fwrite(img.data, 1, img.len, f) != img.len) {
+      fprintf(stderr, "jpeggen: cannot write %s\n", path);
+      return 1;
+    }
+    fclose(f);
+    printf("%s %zu bytes\n", path, img.len);
+    jpeggen_free(&img);
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,27 @@
+#ifndef _JPEGGEN_H_
+#define _JPEGGEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  const char *name;
+  int width, height;
+  int h, v; //luma sampling factors, 0 for grayscale
+  int quality; //1-100 like libjpeg
+  int restart; //MCUs per restart interval, 0 for none
+} jpegGenCase_t;
+
+/* a baseline JPEG and the picture it was encoded from, rgb or gray */
+typedef struct {
+  uint8_t *data;
+  size_t len;
+  uint8_t *pixels;
+  int width, height, comps;
+} jpegGenImage_t;
+
+extern const jpegGenCase_t jpegGenCorpus[];
+
+int jpeggen_image(const jpegGenCase_t *c, jpegGenImage_t *img);
+void jpeggen_free(jpegGenImage_t *img);
+#endif
@@ -0,0 +1,84 @@
+/* mp3bench - decodes streams through the Helix decoder and reports speed,
+ * cycles per frame of each decoder stage and a checksum of the pcm output.
+ *
+ *   mp3bench [-s] [-n rounds] [file.mp3 ...]
+ *
+ * without files the synthetic corpus from mp3gen.c is decoded. a checksum
+ * that changes after touching components/helix means the output changed.
+ * -s decodes through the analysis/synthesis split of the dual core player */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mp3stream.h"
+#include "bench.h"
+#include "helix_profile.h"
+#include "mp3gen.h"
+#include "gen.h"
+
+static int split = 0;
+
+static int bench(const char *name, uint8_t *data, size_t len, int rounds) {
+  decodeResult_t res = {0};
+  double best = 1e30;
+  helix_profile_reset();
+  for(int r = 0; r < rounds; ++r) {
+    HMP3Decoder dec = MP3InitDecoder();
+    if(dec == NULL) {
+      fprintf(stderr, "mp3bench: decoder init failed\n");
+      return -1;
+    }
+    double t = bench_seconds();
+    mp3_decode_stream(dec, data, len, &res, NULL, NULL, split);
+    t = bench_seconds() - t;
+    if(t < best) best = t;
+    MP3FreeDecoder(dec);
+  }
+  uint32_t frames = res.frames ? res.frames : 1;
+  double audio = res.sampleRate ? (double)res.samples / res.channels / res.sampleRate : 0;
+  printf("%-24s %6u %4u %9.0f %7.1f", name, res.frames, res.errors, res.frames / best, audio / best);
+  for(int s = 0; s < PROFILE_STAGES; ++s)
+    printf(" %8.0f", (double)helixProfile[s] / rounds / frames);
+  printf("  %08x\n", res.crc);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  int opt, rounds = 5, ret = 0;
+  while((opt = getopt(argc, argv, "sn:")) != -1) {
+    if(opt == 'n') rounds = atoi(optarg) > 0 ? atoi(optarg) : 1;
+    else if(opt == 's') split = 1;
+    else {
+      fprintf(stderr, "usage: %s [-s] [-n rounds] [file.mp3 ...]\n", argv[0]);
+      return 2;
+    }
+  }
+  printf("%-24s %6s %4s %9s %7s", "stream", "frames", "errs", "frames/s", "xRT");
+  for(int s = 0; s < PROFILE_STAGES; ++s) printf(" %8s", helixProfileNames[s]);
+  printf("  %8s\n", "crc32");
+  if(optind == argc) {
+    for(const mp3GenCase_t *c = mp3GenCorpus; c->name != NULL; ++c) {
+      uint8_t *buf = malloc((size_t)c->frames * MP3GEN_MAX_FRAME);
+      size_t len = mp3gen_stream(c, buf);
+      ret |= bench(c->name, buf, len, rounds);
+      free(buf);
+    }
+    printf("cycles per frame by stage, %d rounds\n", rounds);
+    return ret != 0;
+  }
+  for(int i = optind; i < argc; ++i) {
+    size_t len;
+    uint8_t *buf = load_file(argv[i], &len);
+    if(buf == NULL) {
+      fprintf(stderr, "mp3bench: cannot read %s\n", argv[i]);
+      ret = 1;
+      continue;
+    }
+    ret |= bench(base_name(argv[i]), buf, len, rounds);
+    free(buf);
+  }
+  printf("cycles per frame by stage, %d rounds\n", rounds);
+  return ret != 0;
+}
@@ -0,0 +1,317 @@
+/* mp3gen - writes the synthetic layer 3 corpus used by mp3bench.
+ *
+ * there is no encoder on the build hosts, so the streams are made of valid
+ * frames with pseudo random content: header and side info with random field
+ * values, random scale factors and random spectral values coded with the
+ * Huffman tables of the decoder, read back from hufftabs.c. every decoder
+ * stage runs on them: long, short and mixed blocks, all Huffman tables,
+ * escapes, MS and intensity stereo, MPEG1/2/2.5, CBR and VBR. the output is
+ * noise, but it is the same noise on every run */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "coder.h"
+#include "gen.h"
+#include "mp3gen.h"
+
+/* index 0 = MPEG1, 1 = MPEG2, 2 = MPEG2.5 */
+static const int rates[3][3] = {
+  {44100, 48000, 32000}, {22050, 24000, 16000}, {11025, 12000, 8000}
+};
+static const int kbps[2][15] = {
+  {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320},
+  {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160}
+};
+
+const mp3GenCase_t mp3GenCorpus[] = {
+  {"mpeg1_cbr128_stereo", 0, 0, MODE_STEREO, -1, 9, 400},
+  {"mpeg1_vbr_joint", 0, 0, MODE_JOINT, -1, 0, 400},
+  {"mpeg1_cbr320_ms", 0, 1, MODE_JOINT, 2, 14, 300},
+  {"mpeg1_cbr96_intensity", 0, 2, MODE_JOINT, 1, 7, 300},
+  {"mpeg1_cbr64_mono", 0, 0, MODE_MONO, -1, 5, 400},
+  {"mpeg2_cbr64_joint", 1, 0, MODE_JOINT, -1, 8, 400},
+  {"mpeg2_vbr_mono", 1, 2, MODE_MONO, -1, 0, 400},
+  {"mpeg25_cbr32_stereo", 2, 0, MODE_STEREO, -1, 4, 400},
+  {"mpeg25_vbr_dual", 2, 2, MODE_DUAL, -1, 0, 400},
+  {NULL}
+};
+
+/* the Huffman codes of the decoder tables, for the encoding direction */
+typedef struct {
+  uint32_t code;
+  int len;
+} huffCode_t;
+
+static huffCode_t pairCode[HUFF_PAIRTABS][16][16];
+static huffCode_t quadCode[2][16];
+static int pairMax[HUFF_PAIRTABS];
+
+/* every code below t, prefix holds the bits matched on the way down */
+static void walk_pairs(int tab, const unsigned short *t, uint32_t prefix, int depth) {
+  int maxBits = t[0] & 0xf;
+  for(int i = 0; i < 1 << maxBits; ++i) {
+    unsigned short cw = t[i + 1];
+    int len = cw >> 12, x = (cw >> 4) & 0xf, y = (cw >> 8) & 0xf;
+    if(len == 0) {
+      walk_pairs(tab, t + cw, prefix << maxBits | i, depth + maxBits);
+    } else if(pairCode[tab][x][y].len == 0) {
+      pairCode[tab][x][y].code = prefix << len | i >> (maxBits - len);
+      pairCode[tab][x][y].len = depth + len;
+      if(x > pairMax[tab]) pairMax[tab] = x;
+    }
+  }
+}
+
+static void init_codes(void) {
+  static int done;
+  if(done) return;
+  done = 1;
+  for(int tab = 0; tab < HUFF_PAIRTABS; ++tab) {
+    HuffTabType type = huffTabLookup[tab].tabType;
+    if(type != noBits && type != invalidTab) walk_pairs(tab, huffTable + huffTabOffset[tab], 0, 0);
+  }
+  for(int tab = 0; tab < 2; ++tab) {
+    int maxBits = quadTabMaxBits[tab];
+    for(int i = 0; i < 1 << maxBits; ++i) {
+      int cw = quadTable[quadTabOffset[tab] + i], len = cw >> 4;
+      if(quadCode[tab][cw & 0xf].len) continue;
+      quadCode[tab][cw & 0xf].code = i >> (maxBits - len);
+      quadCode[tab][cw & 0xf].len = len;
+    }
+  }
+}
+
+/* MPEG1 scalefac_compress to slen1/slen2 */
+static const uint8_t sfLen[16][2] = {
+  {0, 0}, {0, 1}, {0, 2}, {0, 3}, {3, 0}, {1, 1}, {1, 2}, {1, 3},
+  {2, 1}, {2, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}, {4, 2}, {4, 3}
+};
+
+/* MPEG2 scale factors per slen: [slen table][long, short, mixed][partition] */
+static const uint8_t sfCount[6][3][4] = {
+  {{6, 5, 5, 5}, {9, 9, 9, 9}, {6, 9, 9, 9}},
+  {{6, 5, 7, 3}, {9, 9, 12, 6}, {6, 9, 12, 6}},
+  {{11, 10, 0, 0}, {18, 18, 0, 0}, {15, 18, 0, 0}},
+  {{7, 7, 7, 0}, {12, 12, 12, 0}, {6, 15, 12, 0}},
+  {{6, 6, 6, 3}, {12, 9, 9, 6}, {6, 12, 9, 6}},
+  {{8, 8, 5, 0}, {15, 12, 9, 0}, {6, 18, 9, 0}}
+};
+
+typedef struct {
+  int part23, big, gain, sfc, winSwitch, blockType, mixed;
+  int table[3], subGain[3], region0, region1, preflag, sfScale, count1Table;
+} granule_t;
+
+/* scale factor bits of one granule, the MPEG2 slen split follows scalfact.c */
+static int part2_bits(const granule_t *g, int mpeg1, int intensityRight, int gr, const int *scfsi) {
+  int slen[4] = {0}, idx, bt = g->blockType == 2 ? (g->mixed ? 2 : 1) : 0, n = 0;
+  if(mpeg1) {
+    int s0 = sfLen[g->sfc][0], s1 = sfLen[g->sfc][1];
+    if(g->blockType == 2) return (g->mixed ? 17 : 18) * s0 + 18 * s1;
+    static const int group[4] = {6, 5, 5, 5};
+    for(int i = 0; i < 4; ++i) if(gr == 0 || scfsi[i] == 0) n += group[i] * (i < 2 ? s0 : s1);
+    return n;
+  }
+  int sfc = g->sfc;
+  if(intensityRight) {
+    sfc >>= 1;
+    if(sfc < 180) {
+      slen[0] = sfc / 36; slen[1] = sfc % 36 / 6; slen[2] = sfc % 6; idx = 3;
+    } else if(sfc < 244) {
+      sfc -= 180; slen[0] = sfc >> 4; slen[1] = (sfc >> 2) & 3; slen[2] = sfc & 3; idx = 4;
+    } else {
+      sfc -= 244; slen[0] = sfc / 3; slen[1] = sfc % 3; idx = 5;
+    }
+  } else if(sfc < 400) {
+    slen[0] = (sfc >> 4) / 5; slen[1] = (sfc >> 4) % 5; slen[2] = (sfc >> 2) & 3; slen[3] = sfc & 3; idx = 0;
+  } else if(sfc < 500) {
+    sfc -= 400; slen[0] = (sfc >> 2) / 5; slen[1] = (sfc >> 2) % 5; slen[2] = sfc & 3; idx = 1;
+  } else {
+    sfc -= 500; slen[0] = sfc / 3; slen[1] = sfc % 3; idx = 2;
+  }
+  for(int i = 0; i < 4; ++i) n += sfCount[idx][bt][i] * slen[i];
+  return n;
+}
+
+/* mostly small values like a real spectrum, now and then the largest the table holds */
+static int gen_value(int tab) {
+  int max = pairMax[tab], lin = huffTabLookup[tab].linBits;
+  if(gen_rnd(16)) return gen_rnd((max < 3 ? max : 3) + 1);
+  int v = gen_rnd(max + 1);
+  if(lin && v == 15) v += gen_rnd(1 << (lin < 4 ? lin : 4));
+  return v;
+}
+
+static int pair_bits(int tab, int x, int y) {
+  int lin = huffTabLookup[tab].linBits;
+  int n = pairCode[tab][x < 15 ? x : 15][y < 15 ? y : 15].len + (x != 0) + (y != 0);
+  return n + (x >= 15 ? lin : 0) + (y >= 15 ? lin : 0);
+}
+
+static void put_pair(bitWriter_t *w, int tab, int x, int y) {
+  int lin = huffTabLookup[tab].linBits;
+  const huffCode_t *h = &pairCode[tab][x < 15 ? x : 15][y < 15 ? y : 15];
+  put_bits(w, h->code, h->len);
+  if(x >= 15 && lin) put_bits(w, x - 15, lin);
+  if(x) put_bits(w, gen_rnd(2), 1);
+  if(y >= 15 && lin) put_bits(w, y - 15, lin);
+  if(y) put_bits(w, gen_rnd(2), 1);
+}
+
+/* scale factors, big values and count1 quads of one granule within budget bits */
+static void gen_granule(granule_t *g, bitWriter_t *m, const mp3GenCase_t *c, int budget,
+                        int intensityRight, int gr, const int *scfsi) {
+  int mpeg1 = c->version == 0;
+  const SFBandTable *sfb = &sfBandTable[c->version][c->rateIndex];
+  size_t start = m->bit;
+  int r1, r2;
+  memset(g, 0, sizeof(*g));
+  g->gain = 150 + gen_rnd(30); //loud, but the peaks stay below full scale
+  g->sfc = gen_rnd(mpeg1 ? 16 : 512);
+  for(int i = 0; i < 3; ++i) {
+    do g->table[i] = gen_rnd(32); while(g->table[i] == 4 || g->table[i] == 14);
+  }
+  if(gen_rnd(3) == 0) {
+    g->winSwitch = 1;
+    g->blockType = 1 + gen_rnd(3);
+    g->mixed = g->blockType == 2 ? gen_rnd(2) : 0; //scalfact.c reads the flag on any block type
+    for(int i = 0; i < 3; ++i) g->subGain[i] = gen_rnd(4);
+    if(g->blockType == 2 && g->mixed == 0) r1 = sfb->s[3] * 3;
+    else if(g->blockType == 2 && mpeg1 == 0) r1 = sfb->l[6] + 2 * (sfb->s[4] - sfb->s[3]);
+    else r1 = sfb->l[8];
+    r2 = 576;
+  } else {
+    //regions end inside the 22 long bands
+    g->region0 = gen_rnd(16);
+    g->region1 = gen_rnd(g->region0 < 13 ? 8 : 21 - g->region0);
+    r1 = sfb->l[g->region0 + 1];
+    r2 = sfb->l[g->region0 + g->region1 + 2];
+  }
+  g->preflag = mpeg1 ? gen_rnd(2) : 0;
+  g->sfScale = gen_rnd(2);
+  g->count1Table = gen_rnd(2);
+
+  int part2 = part2_bits(g, mpeg1, intensityRight, gr, scfsi);
+  if(part2 > budget / 2) {
+    g->sfc = 0;
+    part2 = 0;
+  }
+  for(int n = part2; n > 0; n -= n < 8 ? n : 8) put_bits(m, gen_rnd(256), n < 8 ? n : 8);
+
+  int pairs = gen_rnd(289);
+  for(g->big = 0; g->big < pairs; ++g->big) {
+    int i = g->big * 2, tab = g->table[i < r1 ? 0 : (i < r2 ? 1 : 2)];
+    int x = tab ? gen_value(tab) : 0, y = tab ? gen_value(tab) : 0;
+    if((int)(m->bit - start) + pair_bits(tab, x, y) > budget) break;
+    if(tab) put_pair(m, tab, x, y);
+  }
+  int quads = gen_rnd((576 - 2 * g->big) / 4 + 1);
+  for(int i = 0; i < quads; ++i) {
+    int v = (gen_rnd(4) == 0) << 3 | (gen_rnd(4) == 0) << 2 | (gen_rnd(4) == 0) << 1 | (gen_rnd(4) == 0);
+    const huffCode_t *h = &quadCode[g->count1Table][v];
+    int signs = (v >> 3) + ((v >> 2) & 1) + ((v >> 1) & 1) + (v & 1);
+    if((int)(m->bit - start) + h->len + signs > budget) break;
+    put_bits(m, h->code, h->len);
+    put_bits(m, gen_rnd(1 << signs), signs);
+  }
+  g->part23 = m->bit - start;
+}
+
+/* one frame into out, returns its length */
+static int gen_frame(const mp3GenCase_t *c, uint8_t *out) {
+  bitWriter_t w = {out, 0};
+  int mpeg1 = c->version == 0, mono = c->mode == MODE_MONO;
+  int nch = mono ? 1 : 2, ngr = mpeg1 ? 2 : 1;
+  int brIdx = c->bitrateIndex ? c->bitrateIndex : 1 + gen_rnd(14);
+  int rate = rates[c->version][c->rateIndex];
+  int len = (mpeg1 ? 144000 : 72000) * kbps[!mpeg1][brIdx] / rate;
+  int side = mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17);
+  int modeExt = c->modeExt >= 0 ? c->modeExt : (int)gen_rnd(4);
+  int scfsi[2][4] = {{0}};
+  granule_t g[2][2];
+  memset(out, 0, len);
+
+  //main data first, the side info carries its lengths. no bit reservoir so
+  //every frame decodes on its own, the bytes left over are zero stuffing
+  bitWriter_t m = {out + 4 + side, 0};
+  int mainBits = (len - 4 - side) * 8;
+  if(mpeg1) for(int ch = 0; ch < nch; ++ch) for(int i = 0; i < 4; ++i) scfsi[ch][i] = gen_rnd(2);
+  for(int gr = 0; gr < ngr; ++gr) {
+    for(int ch = 0; ch < nch; ++ch) {
+      int budget = (mainBits - (int)m.bit) / (ngr * nch - gr * nch - ch);
+      int intensityRight = !mpeg1 && c->mode == MODE_JOINT && (modeExt & 1) && ch == 1;
+      gen_granule(&g[gr][ch], &m, c, budget < 4095 ? budget : 4095, intensityRight, gr, scfsi[ch]);
+    }
+  }
+
+  put_bits(&w, 0x7FF, 11);
+  put_bits(&w, c->version == 0 ? 3 : (c->version == 1 ? 2 : 0), 2);
+  put_bits(&w, 1, 2); //layer 3
+  put_bits(&w, 1, 1); //no crc
+  put_bits(&w, brIdx, 4);
+  put_bits(&w, c->rateIndex, 2);
+  put_bits(&w, 0, 2); //no padding, private
+  put_bits(&w, c->mode, 2);
+  put_bits(&w, c->mode == MODE_JOINT ? modeExt : 0, 2);
+  put_bits(&w, 0, 4);
+
+  put_bits(&w, 0, mpeg1 ? 9 : 8);
+  put_bits(&w, 0, mpeg1 ? (mono ? 5 : 3) : (mono ? 1 : 2));
+  if(mpeg1) for(int ch = 0; ch < nch; ++ch) for(int i = 0; i < 4; ++i) put_bits(&w, scfsi[ch][i], 1);
+  for(int gr = 0; gr < ngr; ++gr) {
+    for(int ch = 0; ch < nch; ++ch) {
+      const granule_t *s = &g[gr][ch];
+      put_bits(&w, s->part23, 12);
+      put_bits(&w, s->big, 9);
+      put_bits(&w, s->gain, 8);
+      put_bits(&w, s->sfc, mpeg1 ? 4 : 9);
+      put_bits(&w, s->winSwitch, 1);
+      if(s->winSwitch) {
+        put_bits(&w, s->blockType, 2);
+        put_bits(&w, s->mixed, 1);
+        for(int i = 0; i < 2; ++i) put_bits(&w, s->table[i], 5);
+        for(int i = 0; i < 3; ++i) put_bits(&w, s->subGain[i], 3);
+      } else {
+        for(int i = 0; i < 3; ++i) put_bits(&w, s->table[i], 5);
+        put_bits(&w, s->region0, 4);
+        put_bits(&w, s->region1, 3);
+      }
+      if(mpeg1) put_bits(&w, s->preflag, 1);
+      put_bits(&w, s->sfScale, 1);
+      put_bits(&w, s->count1Table, 1);
+    }
+  }
+  return len;
+}
+
+/* returns the stream length, buf must hold frames * MP3GEN_MAX_FRAME bytes */
+size_t mp3gen_stream(const mp3GenCase_t *c, uint8_t *buf) {
+  size_t n = 0;
+  init_codes();
+  gen_seed(c->name);
+  for(int i = 0; i < c->frames; ++i) n += gen_frame(c, buf + n);
+  return n;
+}
+
+#ifdef MP3GEN_MAIN
+int main(int argc, char **argv) {
+  const char *dir = argc > 1 ? argv[1] : ".";
+  char path[512];
+  for(const mp3GenCase_t *c = mp3GenCorpus; c->name != NULL; ++c) {
+    uint8_t *buf = malloc((size_t)c->frames * MP3GEN_MAX_FRAME);
+    size_t n = mp3gen_stream(c, buf);
+    snprintf(path, sizeof(path), "%s/%s.mp3", dir, c->name);
+    FILE *f = fopen(path, "wb");
+    if(f == NULL || fwrite(buf, 1, n, f) != n) {
+      fprintf(stderr, "mp3gen: cannot write %s\n", path);
+      return 1;
+    }
+    fclose(f);
+    free(buf);
+    printf("%s %zu bytes\n", path, n);
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,24 @@
+#ifndef _MP3GEN_H_
+#define _MP3GEN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MP3GEN_MAX_FRAME 1441
+
+enum { MODE_STEREO = 0, MODE_JOINT, MODE_DUAL, MODE_MONO };
+
+typedef struct {
+  const char *name;
+  int version; //0 = MPEG1, 1 = MPEG2, 2 = MPEG2.5
+  int rateIndex;
+  int mode;
+  int modeExt; //joint stereo: 1 = intensity, 2 = MS, -1 = random per frame
+  int bitrateIndex; //0 = VBR, random per frame
+  int frames;
+} mp3GenCase_t;
+
+extern const mp3GenCase_t mp3GenCorpus[];
+
+size_t mp3gen_stream(const mp3GenCase_t *c, uint8_t *buf);
+#endif
@@ -0,0 +1,86 @@
+#include <string.h>
+
+#include "mp3stream.h"
+
+static uint32_t crc_table[256];
+
+static void crc_init(void) {
+  for(uint32_t i = 0; i < 256; ++i) {
+    uint32_t c = i;
+    for(int k = 0; k < 8; ++k) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+    crc_table[i] = c;
+  }
+}
+
+/* crc32 over the little endian pcm, the same on every host */
+static uint32_t crc_pcm(uint32_t crc, const short *pcm, int samples) {
+  for(int i = 0; i < samples; ++i) {
+    uint16_t s = (uint16_t)pcm[i];
+    crc = crc_table[(crc ^ s) & 0xFF] ^ (crc >> 8);
+    crc = crc_table[(crc ^ (s >> 8)) & 0xFF] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+static void emit(decodeResult_t *res, const short *pcm, const MP3FrameInfo *info,
+                 frameFn_t fn, void *ctx) {
+  if(fn != NULL) fn(ctx, res->frames, pcm, info->outputSamps);
+  res->frames++;
+  res->samples += info->outputSamps;
+  res->sampleRate = info->samprate;
+  res->channels = info->nChans;
+  res->crc = crc_pcm(res->crc, pcm, info->outputSamps);
+}
+
+/* frames that fail to decode are counted and skipped, they produce no pcm.
+ * split decodes through MP3DecodeAnalysis()/MP3DecodeSynthesis() with the
+ * synthesis of a frame after the analysis of the next one, the order the
+ * dual core player runs them in */
+void mp3_decode_stream(HMP3Decoder dec, uint8_t *data, size_t len, decodeResult_t *res,
+                       frameFn_t fn, void *ctx, int split) {
+  static short pcm[MAX_NCHAN * MAX_NGRAN * MAX_NSAMP];
+  static MP3SynthJob jobs[2];
+  unsigned char *p = data;
+  int left = len, cur = 0, pending = 0;
+  MP3FrameInfo info, pendingInfo;
+  if(crc_table[1] == 0) crc_init();
+  memset(res, 0, sizeof(decodeResult_t));
+  res->crc = 0xFFFFFFFFu;
+  while(left > 0) {
+    int off = MP3FindSyncWord(p, left);
+    if(off < 0) break;
+    p += off;
+    left -= off;
+    unsigned char *start = p;
+    int err = split ? MP3DecodeAnalysis(dec, &p, &left, &jobs[cur]) : MP3Decode(dec, &p, &left, pcm, 0);
+    if(err == ERR_MP3_INDATA_UNDERFLOW) break;
+    if(err != ERR_MP3_NONE) {
+      res->errors++;
+      if(split && jobs[cur].nGrans > 0) {
+        //granules decoded before the error, MP3Decode() synthesized them too
+        if(pending && MP3DecodeSynthesis(dec, &jobs[cur ^ 1], pcm) == ERR_MP3_NONE)
+          emit(res, pcm, &pendingInfo, fn, ctx);
+        MP3DecodeSynthesis(dec, &jobs[cur], pcm);
+        pending = 0;
+      }
+      if(p == start) {
+        p++;
+        left--;
+      }
+      continue;
+    }
+    MP3GetLastFrameInfo(dec, &info);
+    if(split == 0) {
+      emit(res, pcm, &info, fn, ctx);
+      continue;
+    }
+    if(pending && MP3DecodeSynthesis(dec, &jobs[cur ^ 1], pcm) == ERR_MP3_NONE)
+      emit(res, pcm, &pendingInfo, fn, ctx);
+    pending = 1;
+    pendingInfo = info;
+    cur ^= 1;
+  }
+  if(pending && MP3DecodeSynthesis(dec, &jobs[cur ^ 1], pcm) == ERR_MP3_NONE)
+    emit(res, pcm, &pendingInfo, fn, ctx);
+  res->crc ^= 0xFFFFFFFFu;
+}
@@ -0,0 +1,20 @@
+#ifndef _MP3STREAM_H_
+#define _MP3STREAM_H_
+
+/* decode loop shared by mp3bench and mp3conform */
+#include <stddef.h>
+#include <stdint.h>
+#include "mp3dec.h"
+
+typedef struct {
+  uint32_t frames, errors, samples;
+  int sampleRate, channels;
+  uint32_t crc; //crc32 of the little endian pcm
+} decodeResult_t;
+
+/* called with the pcm of every decoded frame, samples counts all channels */
+typedef void (*frameFn_t)(void *ctx, uint32_t frame, const short *pcm, int samples);
+
+void mp3_decode_stream(HMP3Decoder dec, uint8_t *data, size_t len, decodeResult_t *res,
+                       frameFn_t fn, void *ctx, int split);
+#endif
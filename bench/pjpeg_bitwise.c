@@ -0,0 +1,7 @@
+/* main/picojpeg.c once more with the bit at a time Huffman decoder, under
+ * other names, so that jpegbench can run both in one binary */
+#define PJPG_HUFF_LOOKAHEAD 0
+#define pjpeg_decode_init pjpeg_bitwise_decode_init
+#define pjpeg_decode_mcu pjpeg_bitwise_decode_mcu
+#define gWinogradQuant pjpeg_bitwise_winograd_quant
+#include "picojpeg.c"
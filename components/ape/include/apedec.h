@@ -0,0 +1,101 @@
+#ifndef _APEDEC_H_
+#define _APEDEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Monkey's Audio decoder for files from version 3.99 on, Fast to Extra High.
+ *
+ * a frame holds 73728 blocks (sample pairs) at these levels, far too much to
+ * decode at once here, so it is decoded APE_CHUNK blocks at a time with the
+ * range coder, predictor and filter state carried over. the working set is
+ * the decoder struct, about 21 KB with the filter histories and one chunk of
+ * samples, plus the seek table at 4 bytes per frame.
+ *
+ * CPU budget, 44.1 kHz stereo on one 240 MHz core: 5442 cycles per block.
+ * Fast costs two range coded values and two 4+5 tap adaptive predictors per
+ * block, Normal adds two 16 tap NN filters. both are meant to stay under a
+ * third of the core so the UI keeps running next to them, High (64 taps)
+ * about half. Extra High (32 + 256 taps) is decoded but not real time.
+ * apePlay() logs the measured load, bench/apebench the host cycles per block */
+#define APE_CHUNK 1024
+#define APE_MIN_VERSION 3990
+#define APE_MAX_CHANNELS 2
+#define APE_FILTER_LEVELS 2
+#define APE_HISTORY_SIZE 512
+#define APE_PREDICTOR_SIZE 50
+#define APE_MAX_FILTER_ORDER 256
+
+/* ape_decode() results below zero */
+enum {
+  APE_ERR_DATA = -1, //corrupt frame, decoding goes on with the next one
+  APE_ERR_END = -2 //stream ended inside a frame
+};
+
+typedef struct {
+  uint16_t version;
+  uint16_t compression; //1000 Fast, 2000 Normal, 3000 High, 4000 Extra High
+  uint32_t blocksPerFrame, finalFrameBlocks, totalFrames;
+  int bitsPerSample, channels;
+  uint32_t sampleRate;
+  uint64_t totalBlocks;
+  uint32_t firstFrame; //stream offset of the first frame
+} apeInfo_t;
+
+/* hands the decoder the next piece of the stream and returns its length,
+ * 0 at the end. the stream starts at the "MAC " descriptor, after any ID3v2
+ * tag in front of it */
+typedef size_t (*apeFetch_t)(void *ctx, const uint8_t **data);
+
+typedef struct {
+  uint32_t k, ksum;
+} apeRice_t;
+
+typedef struct {
+  int16_t coeffs[APE_MAX_FILTER_ORDER];
+  int16_t history[APE_HISTORY_SIZE + 2 * APE_MAX_FILTER_ORDER];
+  int16_t *delay, *adapt;
+  uint32_t avg;
+} apeFilter_t;
+
+typedef struct {
+  int32_t history[APE_HISTORY_SIZE + APE_PREDICTOR_SIZE];
+  int32_t *buf;
+  int32_t lastA[2], filterA[2], filterB[2];
+  int32_t coeffsA[2][4], coeffsB[2][5];
+} apePredictor_t;
+
+typedef struct {
+  apeInfo_t info;
+  uint32_t *seekTable;
+  apeFetch_t fetch;
+  void *ctx;
+  const uint8_t *data;
+  size_t len, pos;
+  bool end;
+  //frame data is a stream of little endian 32-bit words read most
+  //significant byte first. word holds word number wordIdx counted from the
+  //first frame with its bytes swapped, prevWord the one before it
+  uint8_t word[4], prevWord[4];
+  int64_t wordIdx; //-1 = none loaded yet
+  uint64_t logPos; //next byte in that swapped order
+  //range coder
+  uint32_t low, range, help, buffer;
+  apeRice_t riceX, riceY;
+  apePredictor_t predictor;
+  apeFilter_t filters[APE_FILTER_LEVELS][APE_MAX_CHANNELS];
+  int fset;
+  uint32_t frame, frameFlags, blocksLeft;
+  uint64_t blockPos; //first block of the last ape_decode() output
+  bool error;
+  int32_t decoded[APE_MAX_CHANNELS][APE_CHUNK];
+} apeDecoder_t;
+
+apeDecoder_t *ape_open(apeFetch_t fetch, void *ctx);
+int ape_decode(apeDecoder_t *d);
+void ape_output_s16(apeDecoder_t *d, int16_t *out, int from, int count);
+uint32_t ape_frame_offset(apeDecoder_t *d, uint32_t frame);
+void ape_reset(apeDecoder_t *d, uint32_t frame);
+void ape_close(apeDecoder_t *d);
+#endif
@@ -0,0 +1,509 @@
+/* fixed-point streaming Monkey's Audio decoder, see apedec.h.
+ *
+ * covers the 3.99 format: range coded residuals with adaptive Rice style
+ * parameters, the NN filters of the compression level and the two stage
+ * adaptive predictor, stereo as a X/Y pair. the per frame crc is not
+ * checked. all arithmetic wraps like the reference decoder's 32-bit ints */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "apedec.h"
+
+#define DESCRIPTOR_BYTES 52
+#define HEADER_BYTES 24
+
+#define FRAME_MONO_SILENCE 1
+#define FRAME_STEREO_SILENCE 3
+#define FRAME_PSEUDO_STEREO 4
+
+#define CODE_BITS 32
+#define TOP_VALUE (1u << (CODE_BITS - 1))
+#define EXTRA_BITS ((CODE_BITS - 2) % 8 + 1)
+#define BOTTOM_VALUE (TOP_VALUE >> 8)
+#define MODEL_ELEMENTS 64
+
+#define PREDICTOR_ORDER 8
+#define YDELAYA (18 + PREDICTOR_ORDER * 4)
+#define YDELAYB (18 + PREDICTOR_ORDER * 3)
+#define XDELAYA (18 + PREDICTOR_ORDER * 2)
+#define XDELAYB (18 + PREDICTOR_ORDER)
+#define YADAPTCOEFFSA 18
+#define XADAPTCOEFFSA 14
+#define YADAPTCOEFFSB 10
+#define XADAPTCOEFFSB 5
+
+//-1, 0 or 1 with the opposite sign of x, the predictors adapt with it
+#define APESIGN(x) (((x) < 0) - ((x) > 0))
+
+//overflow model, cumulative frequencies out of 65536
+static const uint32_t counts[22] = {
+  0, 19578, 36160, 48417, 56323, 60899, 63265, 64435, 64971, 65232, 65351,
+  65416, 65447, 65466, 65476, 65482, 65485, 65488, 65490, 65491, 65492, 65493
+};
+static const uint32_t countsDiff[21] = {
+  19578, 16582, 12257, 7906, 4576, 2366, 1170, 536, 261, 119, 65,
+  31, 19, 10, 6, 3, 3, 2, 1, 1, 1
+};
+
+//NN filters per compression level / 1000 - 1, applied in this order
+static const uint16_t filterOrders[4][APE_FILTER_LEVELS] = {
+  {0, 0}, {16, 0}, {64, 0}, {32, 256}
+};
+static const uint8_t filterFracBits[4][APE_FILTER_LEVELS] = {
+  {0, 0}, {11, 0}, {11, 0}, {10, 13}
+};
+
+static const int32_t initialCoeffsA[4] = {360, 317, -109, 98};
+
+/* ---- stream ---- */
+
+static bool raw_byte(apeDecoder_t *d, uint8_t *b) {
+  if(d->pos == d->len) {
+    if(d->end) return false;
+    d->pos = 0;
+    d->len = d->fetch(d->ctx, &d->data);
+    if(d->len == 0) {
+      d->end = true;
+      return false;
+    }
+  }
+  *b = d->data[d->pos++];
+  return true;
+}
+
+static bool read_raw(apeDecoder_t *d, uint8_t *buf, uint32_t n) {
+  while(n--)
+    if(raw_byte(d, buf++) == false) return false;
+  return true;
+}
+
+static bool skip_raw(apeDecoder_t *d, uint32_t n) {
+  while(n > 0) {
+    if(d->pos == d->len) {
+      uint8_t b;
+      if(raw_byte(d, &b) == false) return false;
+      n--;
+    } else {
+      size_t step = d->len - d->pos < n ? d->len - d->pos : n;
+      d->pos += step;
+      n -= step;
+    }
+  }
+  return true;
+}
+
+/* past the end of the stream words read as zero */
+static void load_word(apeDecoder_t *d) {
+  memcpy(d->prevWord, d->word, 4);
+  for(int i = 3; i >= 0; --i)
+    if(raw_byte(d, &d->word[i]) == false) d->word[i] = 0;
+  d->wordIdx++;
+}
+
+static inline uint32_t get_byte(apeDecoder_t *d) {
+  int64_t w = d->logPos >> 2;
+  int at = d->logPos++ & 3;
+  while(w > d->wordIdx) load_word(d);
+  if(w == d->wordIdx) return d->word[at];
+  if(w == d->wordIdx - 1) return d->prevWord[at];
+  d->error = true; //frames overlap by more than a word
+  return 0;
+}
+
+static uint32_t get_be32(apeDecoder_t *d) {
+  uint32_t v = get_byte(d) << 24;
+  v |= get_byte(d) << 16;
+  v |= get_byte(d) << 8;
+  return v | get_byte(d);
+}
+
+static inline uint32_t le16(const uint8_t *p) {
+  return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t le32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* ---- range decoder ---- */
+
+static void range_start(apeDecoder_t *d) {
+  d->buffer = get_byte(d);
+  d->low = d->buffer >> (8 - EXTRA_BITS);
+  d->range = 1u << EXTRA_BITS;
+}
+
+static inline void range_normalize(apeDecoder_t *d) {
+  while(d->range <= BOTTOM_VALUE) {
+    d->buffer = (d->buffer << 8) | get_byte(d);
+    d->low = (d->low << 8) | ((d->buffer >> 1) & 0xFF);
+    d->range <<= 8;
+  }
+}
+
+static inline uint32_t range_culfreq(apeDecoder_t *d, uint32_t totFreq) {
+  range_normalize(d);
+  d->help = d->range / totFreq;
+  return d->low / d->help;
+}
+
+static inline uint32_t range_culshift(apeDecoder_t *d, int shift) {
+  range_normalize(d);
+  d->help = d->range >> shift;
+  return d->low / d->help;
+}
+
+static inline void range_update(apeDecoder_t *d, uint32_t freq, uint32_t cumFreq) {
+  d->low -= d->help * cumFreq;
+  d->range = d->help * freq;
+}
+
+static inline uint32_t range_bits(apeDecoder_t *d, int n) {
+  uint32_t sym = range_culshift(d, n);
+  range_update(d, 1, sym);
+  return sym;
+}
+
+static inline uint32_t range_symbol(apeDecoder_t *d) {
+  uint32_t cf = range_culshift(d, 16), sym;
+  if(cf > 65492) { //escape region, one count per symbol
+    range_update(d, 1, cf);
+    if(cf > 65535) d->error = true;
+    return cf - 65535 + 63;
+  }
+  for(sym = 0; counts[sym + 1] <= cf; ++sym);
+  range_update(d, countsDiff[sym], counts[sym]);
+  return sym;
+}
+
+static inline void update_rice(apeRice_t *r, uint32_t x) {
+  uint32_t lim = r->k ? 1u << (r->k + 4) : 0;
+  r->ksum += ((x + 1) / 2) - ((r->ksum + 16) >> 5);
+  if(r->ksum < lim) r->k--;
+  else if(r->ksum >= (1u << (r->k + 5)) && r->k < 24) r->k++;
+}
+
+static inline int32_t decode_value(apeDecoder_t *d, apeRice_t *r) {
+  uint32_t pivot = r->ksum >> 5, base, overflow;
+  if(pivot == 0) pivot = 1;
+  overflow = range_symbol(d);
+  if(overflow == MODEL_ELEMENTS - 1) {
+    overflow = range_bits(d, 16) << 16;
+    overflow |= range_bits(d, 16);
+  }
+  if(pivot < 0x10000) {
+    base = range_culfreq(d, pivot);
+    range_update(d, 1, base);
+  } else {
+    //too wide for one step, the top 16 bits and the rest separately
+    uint32_t hi = pivot, lo;
+    int bits = 0;
+    while(hi & ~0xFFFFu) {
+      hi >>= 1;
+      bits++;
+    }
+    hi = range_culfreq(d, hi + 1);
+    range_update(d, 1, hi);
+    lo = range_culfreq(d, 1u << bits);
+    range_update(d, 1, lo);
+    base = (hi << bits) + lo;
+  }
+  uint32_t x = base + overflow * pivot;
+  update_rice(r, x);
+  //odd values are positive, even ones zero or negative
+  return (x & 1) ? (int32_t)(x >> 1) + 1 : -(int32_t)(x >> 1);
+}
+
+/* ---- NN filters ---- */
+
+static void init_filter(apeFilter_t *f, int order) {
+  memset(f->coeffs, 0, order * sizeof(int16_t));
+  memset(f->history, 0, 2 * order * sizeof(int16_t));
+  f->adapt = f->history + order;
+  f->delay = f->history + 2 * order;
+  f->avg = 0;
+}
+
+static inline int16_t clip16(int32_t v) {
+  return v > 32767 ? 32767 : (v < -32768 ? -32768 : v);
+}
+
+/* history holds the adapt values of the last order samples followed by the
+ * clipped outputs of the last order samples, both windows move up by one per
+ * sample until the buffer is full and they are copied back to the start */
+static void apply_filter(apeFilter_t *f, int32_t *data, int count, int order, int fracbits) {
+  for(; count > 0; --count, ++data) {
+    const int16_t *hist = f->delay - order, *adapt = f->adapt - order;
+    int sign = APESIGN(*data);
+    uint32_t dot = 0;
+    for(int i = 0; i < order; ++i) {
+      dot += f->coeffs[i] * hist[i];
+      f->coeffs[i] += sign * adapt[i];
+    }
+    int32_t res = ((int64_t)(int32_t)dot + (1 << (fracbits - 1))) >> fracbits;
+    res = (uint32_t)res + (uint32_t)*data;
+    *data = res;
+    *f->delay++ = clip16(res);
+    uint32_t absres = res < 0 ? -(uint32_t)res : (uint32_t)res;
+    if(absres)
+      *f->adapt = APESIGN(res) * (8 << ((absres > f->avg * 3ULL) + (absres > f->avg + f->avg / 3)));
+    else
+      *f->adapt = 0;
+    f->avg += (int32_t)(absres - f->avg) / 16;
+    f->adapt[-1] >>= 1;
+    f->adapt[-2] >>= 1;
+    f->adapt[-8] >>= 1;
+    f->adapt++;
+    if(f->delay == f->history + APE_HISTORY_SIZE + 2 * order) {
+      memmove(f->history, f->delay - 2 * order, 2 * order * sizeof(int16_t));
+      f->adapt = f->history + order;
+      f->delay = f->history + 2 * order;
+    }
+  }
+}
+
+static void apply_filters(apeDecoder_t *d, int chans, int count) {
+  for(int i = 0; i < APE_FILTER_LEVELS && filterOrders[d->fset][i]; ++i)
+    for(int ch = 0; ch < chans; ++ch)
+      apply_filter(&d->filters[i][ch], d->decoded[ch], count, filterOrders[d->fset][i],
+                   filterFracBits[d->fset][i]);
+}
+
+/* ---- predictor ---- */
+
+static void init_predictor(apePredictor_t *p) {
+  memset(p, 0, sizeof(apePredictor_t));
+  p->buf = p->history;
+  memcpy(p->coeffsA[0], initialCoeffsA, sizeof(initialCoeffsA));
+  memcpy(p->coeffsA[1], initialCoeffsA, sizeof(initialCoeffsA));
+}
+
+static inline void predictor_advance(apePredictor_t *p) {
+  if(++p->buf == p->history + APE_HISTORY_SIZE) {
+    memmove(p->history, p->buf, APE_PREDICTOR_SIZE * sizeof(int32_t));
+    p->buf = p->history;
+  }
+}
+
+/* stage A predicts from the channel's own last outputs, stage B from the
+ * other channel's filtered value, which for X is the Y of the same block */
+static inline int32_t predictor_update(apePredictor_t *p, int32_t decoded, int filter,
+                                       int delayA, int delayB, int adaptA, int adaptB) {
+  int32_t *b = p->buf, *cA = p->coeffsA[filter], *cB = p->coeffsB[filter];
+  b[delayA] = p->lastA[filter];
+  b[adaptA] = APESIGN(b[delayA]);
+  b[delayA - 1] = (uint32_t)b[delayA] - (uint32_t)b[delayA - 1];
+  b[adaptA - 1] = APESIGN(b[delayA - 1]);
+  int32_t predA = (uint32_t)b[delayA] * cA[0] + (uint32_t)b[delayA - 1] * cA[1]
+                  + (uint32_t)b[delayA - 2] * cA[2] + (uint32_t)b[delayA - 3] * cA[3];
+
+  b[delayB] = (uint32_t)p->filterA[filter ^ 1] - ((int32_t)(p->filterB[filter] * 31u) >> 5);
+  b[adaptB] = APESIGN(b[delayB]);
+  b[delayB - 1] = (uint32_t)b[delayB] - (uint32_t)b[delayB - 1];
+  b[adaptB - 1] = APESIGN(b[delayB - 1]);
+  p->filterB[filter] = p->filterA[filter ^ 1];
+  int32_t predB = (uint32_t)b[delayB] * cB[0] + (uint32_t)b[delayB - 1] * cB[1]
+                  + (uint32_t)b[delayB - 2] * cB[2] + (uint32_t)b[delayB - 3] * cB[3]
+                  + (uint32_t)b[delayB - 4] * cB[4];
+
+  p->lastA[filter] = (uint32_t)decoded + ((int32_t)((uint32_t)predA + (predB >> 1)) >> 10);
+  p->filterA[filter] = (uint32_t)p->lastA[filter] + ((int32_t)(p->filterA[filter] * 31u) >> 5);
+
+  int sign = APESIGN(decoded);
+  for(int i = 0; i < 4; ++i) cA[i] += b[adaptA - i] * sign;
+  for(int i = 0; i < 5; ++i) cB[i] += b[adaptB - i] * sign;
+  return p->filterA[filter];
+}
+
+static void predict_stereo(apeDecoder_t *d, int count) {
+  apePredictor_t *p = &d->predictor;
+  int32_t *y = d->decoded[0], *x = d->decoded[1];
+  for(int i = 0; i < count; ++i) {
+    y[i] = predictor_update(p, y[i], 0, YDELAYA, YDELAYB, YADAPTCOEFFSA, YADAPTCOEFFSB);
+    x[i] = predictor_update(p, x[i], 1, XDELAYA, XDELAYB, XADAPTCOEFFSA, XADAPTCOEFFSB);
+    predictor_advance(p);
+  }
+}
+
+static void predict_mono(apeDecoder_t *d, int count) {
+  apePredictor_t *p = &d->predictor;
+  int32_t *s = d->decoded[0], *cA = p->coeffsA[0];
+  int32_t current = p->lastA[0];
+  for(int i = 0; i < count; ++i) {
+    int32_t *b = p->buf, a = s[i];
+    b[YDELAYA] = current;
+    b[YDELAYA - 1] = (uint32_t)b[YDELAYA] - (uint32_t)b[YDELAYA - 1];
+    int32_t predA = (uint32_t)b[YDELAYA] * cA[0] + (uint32_t)b[YDELAYA - 1] * cA[1]
+                    + (uint32_t)b[YDELAYA - 2] * cA[2] + (uint32_t)b[YDELAYA - 3] * cA[3];
+    current = (uint32_t)a + (uint32_t)(predA >> 10);
+    b[YADAPTCOEFFSA] = APESIGN(b[YDELAYA]);
+    b[YADAPTCOEFFSA - 1] = APESIGN(b[YDELAYA - 1]);
+    int sign = APESIGN(a);
+    for(int j = 0; j < 4; ++j) cA[j] += b[YADAPTCOEFFSA - j] * sign;
+    predictor_advance(p);
+    p->filterA[0] = (uint32_t)current + ((int32_t)(p->filterA[0] * 31u) >> 5);
+    s[i] = p->filterA[0];
+  }
+  p->lastA[0] = current;
+}
+
+/* ---- frames ---- */
+
+static uint32_t frame_blocks(apeDecoder_t *d, uint32_t frame) {
+  return frame + 1 == d->info.totalFrames ? d->info.finalFrameBlocks : d->info.blocksPerFrame;
+}
+
+static void start_frame(apeDecoder_t *d) {
+  d->logPos = d->seekTable[d->frame] - d->info.firstFrame;
+  d->frameFlags = 0;
+  uint32_t crc = get_be32(d);
+  if(crc & 0x80000000) d->frameFlags = get_be32(d);
+  d->riceX.k = d->riceY.k = 10;
+  d->riceX.ksum = d->riceY.ksum = (1 << 10) * 16;
+  get_byte(d); //the range coder's first byte carries no bits
+  range_start(d);
+  init_predictor(&d->predictor);
+  for(int i = 0; i < APE_FILTER_LEVELS && filterOrders[d->fset][i]; ++i)
+    for(int ch = 0; ch < APE_MAX_CHANNELS; ++ch)
+      init_filter(&d->filters[i][ch], filterOrders[d->fset][i]);
+  d->blocksLeft = frame_blocks(d, d->frame);
+  d->frame++;
+}
+
+static void unpack_mono(apeDecoder_t *d, int count) {
+  if(d->frameFlags & FRAME_STEREO_SILENCE) return;
+  for(int i = 0; i < count; ++i) d->decoded[0][i] = decode_value(d, &d->riceY);
+  apply_filters(d, 1, count);
+  predict_mono(d, count);
+  if(d->info.channels == 2) memcpy(d->decoded[1], d->decoded[0], count * sizeof(int32_t));
+}
+
+static void unpack_stereo(apeDecoder_t *d, int count) {
+  int32_t *y = d->decoded[0], *x = d->decoded[1];
+  if((d->frameFlags & FRAME_STEREO_SILENCE) == FRAME_STEREO_SILENCE) return;
+  for(int i = 0; i < count; ++i) {
+    y[i] = decode_value(d, &d->riceY);
+    x[i] = decode_value(d, &d->riceX);
+  }
+  apply_filters(d, 2, count);
+  predict_stereo(d, count);
+  //Y is right - left, X is left + Y / 2
+  for(int i = 0; i < count; ++i) {
+    uint32_t left = (uint32_t)x[i] - (uint32_t)(y[i] / 2);
+    x[i] = left + (uint32_t)y[i];
+    y[i] = left;
+  }
+}
+
+/* ---- api ---- */
+
+apeDecoder_t *ape_open(apeFetch_t fetch, void *ctx) {
+  apeDecoder_t *d = calloc(1, sizeof(apeDecoder_t));
+  uint8_t b[DESCRIPTOR_BYTES];
+  if(d == NULL) return NULL;
+  d->fetch = fetch;
+  d->ctx = ctx;
+  d->wordIdx = -1;
+  if(read_raw(d, b, DESCRIPTOR_BYTES) == false || memcmp(b, "MAC ", 4) != 0) goto fail;
+  apeInfo_t *in = &d->info;
+  in->version = le16(b + 4);
+  uint32_t descBytes = le32(b + 8), headerBytes = le32(b + 12);
+  uint32_t seekBytes = le32(b + 16), wavBytes = le32(b + 20);
+  if(in->version < APE_MIN_VERSION || descBytes < DESCRIPTOR_BYTES || headerBytes < HEADER_BYTES)
+    goto fail;
+  if(skip_raw(d, descBytes - DESCRIPTOR_BYTES) == false) goto fail;
+  if(read_raw(d, b, HEADER_BYTES) == false || skip_raw(d, headerBytes - HEADER_BYTES) == false)
+    goto fail;
+  in->compression = le16(b);
+  in->blocksPerFrame = le32(b + 4);
+  in->finalFrameBlocks = le32(b + 8);
+  in->totalFrames = le32(b + 12);
+  in->bitsPerSample = le16(b + 16);
+  in->channels = le16(b + 18);
+  in->sampleRate = le32(b + 20);
+  in->firstFrame = descBytes + headerBytes + seekBytes + wavBytes;
+  if(in->compression % 1000 != 0 || in->compression < 1000 || in->compression > 4000
+      || in->channels < 1 || in->channels > APE_MAX_CHANNELS || in->sampleRate == 0
+      || (in->bitsPerSample != 8 && in->bitsPerSample != 16 && in->bitsPerSample != 24)
+      || in->totalFrames == 0 || in->blocksPerFrame == 0
+      || in->finalFrameBlocks > in->blocksPerFrame || seekBytes / 4 < in->totalFrames)
+    goto fail;
+  in->totalBlocks = (uint64_t)(in->totalFrames - 1) * in->blocksPerFrame + in->finalFrameBlocks;
+  d->fset = in->compression / 1000 - 1;
+
+  d->seekTable = malloc(in->totalFrames * sizeof(uint32_t));
+  if(d->seekTable == NULL) goto fail;
+  for(uint32_t i = 0; i < in->totalFrames; ++i) {
+    if(read_raw(d, b, 4) == false) goto fail;
+    d->seekTable[i] = le32(b);
+    if(d->seekTable[i] < (i ? d->seekTable[i - 1] : in->firstFrame)) goto fail;
+  }
+  if(skip_raw(d, seekBytes - in->totalFrames * 4 + wavBytes) == false) goto fail;
+  return d;
+fail:
+  ape_close(d);
+  return NULL;
+}
+
+/* decodes up to APE_CHUNK blocks into decoded[], returns how many, 0 after
+ * the last frame or one of the APE_ERR codes. blockPos tells where they go */
+int ape_decode(apeDecoder_t *d) {
+  if(d->blocksLeft == 0) {
+    if(d->frame >= d->info.totalFrames) return 0;
+    if(d->end) return APE_ERR_END;
+    d->error = false;
+    start_frame(d);
+  }
+  uint32_t frame = d->frame - 1;
+  int n = d->blocksLeft < APE_CHUNK ? d->blocksLeft : APE_CHUNK;
+  d->blockPos = (uint64_t)frame * d->info.blocksPerFrame + frame_blocks(d, frame) - d->blocksLeft;
+  for(int ch = 0; ch < APE_MAX_CHANNELS; ++ch) memset(d->decoded[ch], 0, n * sizeof(int32_t));
+  if(d->info.channels == 1 || (d->frameFlags & FRAME_PSEUDO_STEREO)) unpack_mono(d, n);
+  else unpack_stereo(d, n);
+  d->blocksLeft -= n;
+  if(d->error) {
+    d->blocksLeft = 0;
+    return APE_ERR_DATA;
+  }
+  if(d->end && d->frame < d->info.totalFrames) return APE_ERR_END;
+  return n;
+}
+
+/* count blocks from block from on, 16-bit interleaved, wider samples keep
+ * their top 16 bits */
+void ape_output_s16(apeDecoder_t *d, int16_t *out, int from, int count) {
+  int chans = d->info.channels, shift = d->info.bitsPerSample - 16;
+  for(int ch = 0; ch < chans; ++ch) {
+    const int32_t *s = d->decoded[ch] + from;
+    int16_t *o = out + ch;
+    if(shift > 0)
+      for(int i = 0; i < count; ++i, o += chans) *o = s[i] >> shift;
+    else
+      for(int i = 0; i < count; ++i, o += chans) *o = s[i] * (1 << -shift);
+  }
+}
+
+/* stream offset to fetch from for ape_reset(d, frame), the start of the
+ * 32-bit word the frame begins in */
+uint32_t ape_frame_offset(apeDecoder_t *d, uint32_t frame) {
+  uint32_t first = d->info.firstFrame;
+  return first + ((d->seekTable[frame] - first) & ~3u);
+}
+
+/* forget buffered data, the next ape_decode() starts frame with the stream
+ * fetched from ape_frame_offset(d, frame) */
+void ape_reset(apeDecoder_t *d, uint32_t frame) {
+  d->data = NULL;
+  d->len = d->pos = 0;
+  d->end = false;
+  d->wordIdx = (int64_t)((d->seekTable[frame] - d->info.firstFrame) >> 2) - 1;
+  d->frame = frame;
+  d->blocksLeft = 0;
+}
+
+void ape_close(apeDecoder_t *d) {
+  if(d == NULL) return;
+  free(d->seekTable);
+  free(d);
+}
@@ -0,0 +1,67 @@
+#ifndef _FLACDEC_H_
+#define _FLACDEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FLAC_MAX_CHANNELS 2
+#define FLAC_MAX_BLOCK 16384 //streamable subset limit, 4608 up to 48kHz
+#define FLAC_MAX_ORDER 32
+
+/* flac_decode_frame() results below zero */
+enum {
+  FLAC_ERR_END = -1, //no more frames
+  FLAC_ERR_HEADER = -2, //frame header failed its crc or is invalid
+  FLAC_ERR_FORMAT = -3, //frame does not fit STREAMINFO or the limits above
+  FLAC_ERR_DATA = -4 //corrupt subframe
+};
+
+typedef struct {
+  uint32_t sampleRate;
+  int channels;
+  int bitsPerSample;
+  uint64_t totalSamples; //0 = unknown
+  uint16_t minBlock, maxBlock;
+  uint32_t minFrame, maxFrame; //bytes, 0 = unknown
+} flacStreamInfo_t;
+
+typedef struct {
+  uint64_t firstSample;
+  int blockSize;
+  uint32_t sampleRate;
+  int channels;
+  int assignment; //0-7 independent, 8 left/side, 9 side/right, 10 mid/side
+  int bitsPerSample;
+} flacFrame_t;
+
+/* hands the decoder the next piece of the stream and returns its length,
+ * 0 at the end. the previous piece is not touched again once it is called */
+typedef size_t (*flacFetch_t)(void *ctx, const uint8_t **data);
+
+/* streaming decoder, compressed data goes through a 64-bit bit cache straight
+ * from the fetched pieces so nothing but one block of decoded samples per
+ * channel is buffered. that block is allocated once in flac_open(), sized
+ * from STREAMINFO */
+typedef struct {
+  flacStreamInfo_t info;
+  flacFrame_t frame;
+  flacFetch_t fetch;
+  void *ctx;
+  const uint8_t *data;
+  size_t len, pos;
+  uint64_t cache; //the low bits hold the next cacheBits bits of the stream
+  int cacheBits;
+  uint64_t consumed; //bytes fetched before data
+  uint64_t audioStart; //offset of the first frame in the stream
+  bool end;
+  int32_t *samples[FLAC_MAX_CHANNELS];
+} flacDecoder_t;
+
+flacDecoder_t *flac_open(flacFetch_t fetch, void *ctx);
+int flac_decode_frame(flacDecoder_t *d);
+void flac_output_s16(flacDecoder_t *d, int16_t *out, int from, int count);
+uint64_t flac_tell(flacDecoder_t *d);
+void flac_reset(flacDecoder_t *d, uint64_t pos);
+void flac_close(flacDecoder_t *d);
+#endif
@@ -0,0 +1,447 @@
+/* fixed-point streaming FLAC decoder, see flacdec.h.
+ *
+ * handles every frame the reference encoder writes: CONSTANT, VERBATIM,
+ * FIXED and LPC subframes, wasted bits, all stereo decorrelation modes and
+ * both Rice parameter widths, up to FLAC_MAX_CHANNELS channels of 4 to 24
+ * bits. header crc8 is checked to find frames, the frame crc16 is not */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "flacdec.h"
+
+#define META_STREAMINFO 0
+#define META_LAST 0x80
+
+static const uint8_t crc8Table[256] = {
+  0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+  0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+  0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+  0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+  0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+  0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+  0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+  0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+  0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+  0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+  0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+  0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+  0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+  0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+  0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+  0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+
+static const uint32_t frameRates[12] = {
+  0, 88200, 176400, 192000, 8000, 16000, 22050, 24000, 32000, 44100, 48000, 96000
+};
+static const int frameBits[8] = {0, 8, 12, 0, 16, 20, 24, 32};
+
+/* ---- bit reader ---- */
+
+/* tops the cache up to at least 57 bits, less only at the end of the stream */
+static void refill(flacDecoder_t *d) {
+  while(d->cacheBits <= 56) {
+    if(d->pos == d->len) {
+      if(d->end) return;
+      d->consumed += d->len;
+      d->pos = 0;
+      d->len = d->fetch(d->ctx, &d->data);
+      if(d->len == 0) {
+        d->end = true;
+        return;
+      }
+    }
+    d->cache = (d->cache << 8) | d->data[d->pos++];
+    d->cacheBits += 8;
+  }
+}
+
+/* n = 0..32, false past the end of the stream */
+static inline bool get_bits(flacDecoder_t *d, int n, uint32_t *v) {
+  if(d->cacheBits < n) {
+    refill(d);
+    if(d->cacheBits < n) return false;
+  }
+  d->cacheBits -= n;
+  *v = n ? (uint32_t)(d->cache >> d->cacheBits) & (0xFFFFFFFFu >> (32 - n)) : 0;
+  return true;
+}
+
+static inline bool get_signed(flacDecoder_t *d, int n, int32_t *v) {
+  uint32_t u;
+  if(get_bits(d, n, &u) == false) return false;
+  *v = n ? (int32_t)(u << (32 - n)) >> (32 - n) : 0;
+  return true;
+}
+
+/* counts zero bits up to the next one bit and drops that one too */
+static inline bool get_unary(flacDecoder_t *d, uint32_t *v) {
+  uint32_t zeros = 0;
+  while(1) {
+    if(d->cacheBits == 0) {
+      refill(d);
+      if(d->cacheBits == 0) return false;
+    }
+    uint64_t left = d->cache << (64 - d->cacheBits);
+    if(left != 0) {
+      int lz = __builtin_clzll(left);
+      d->cacheBits -= lz + 1;
+      *v = zeros + lz;
+      return true;
+    }
+    zeros += d->cacheBits;
+    d->cacheBits = 0;
+  }
+}
+
+static inline void byte_align(flacDecoder_t *d) {
+  d->cacheBits &= ~7;
+}
+
+/* ---- metadata ---- */
+
+static bool skip_bytes(flacDecoder_t *d, uint32_t n) {
+  byte_align(d);
+  while(n > 0) {
+    if(d->cacheBits > 0) {
+      d->cacheBits -= 8;
+      n--;
+    } else if(d->pos == d->len) {
+      refill(d);
+      if(d->cacheBits == 0) return false;
+    } else {
+      size_t step = d->len - d->pos < n ? d->len - d->pos : n;
+      d->pos += step;
+      n -= step;
+    }
+  }
+  return true;
+}
+
+static bool read_streaminfo(flacDecoder_t *d) {
+  flacStreamInfo_t *si = &d->info;
+  uint32_t v, hi;
+  if(get_bits(d, 16, &v) == false) return false;
+  si->minBlock = v;
+  if(get_bits(d, 16, &v) == false) return false;
+  si->maxBlock = v;
+  if(get_bits(d, 24, &si->minFrame) == false || get_bits(d, 24, &si->maxFrame) == false)
+    return false;
+  if(get_bits(d, 20, &si->sampleRate) == false) return false;
+  if(get_bits(d, 3, &v) == false) return false;
+  si->channels = v + 1;
+  if(get_bits(d, 5, &v) == false) return false;
+  si->bitsPerSample = v + 1;
+  if(get_bits(d, 4, &hi) == false || get_bits(d, 32, &v) == false) return false;
+  si->totalSamples = ((uint64_t)hi << 32) | v;
+  return skip_bytes(d, 16); //md5
+}
+
+/* ---- frames ---- */
+
+/* frame number or first sample, the UTF-8 like coding of the frame header */
+static bool read_coded_number(flacDecoder_t *d, uint64_t *v, uint8_t *crc) {
+  uint32_t b;
+  int extra;
+  if(get_bits(d, 8, &b) == false) return false;
+  *crc = crc8Table[*crc ^ b];
+  if((b & 0x80) == 0) {
+    *v = b;
+    return true;
+  }
+  if((b & 0xC0) == 0x80 || b == 0xFF) return false;
+  for(extra = 1; b & (0x40 >> extra); ++extra);
+  if(extra > 6) return false;
+  *v = b & (0x3F >> extra);
+  while(extra-- > 0) {
+    if(get_bits(d, 8, &b) == false || (b & 0xC0) != 0x80) return false;
+    *crc = crc8Table[*crc ^ b];
+    *v = (*v << 6) | (b & 0x3F);
+  }
+  return true;
+}
+
+static bool header_bits(flacDecoder_t *d, int n, uint32_t *v, uint8_t *crc) {
+  if(get_bits(d, n, v) == false) return false;
+  for(int i = n - 8; i >= 0; i -= 8) *crc = crc8Table[*crc ^ ((*v >> i) & 0xFF)];
+  return true;
+}
+
+/* returns 0, FLAC_ERR_END or FLAC_ERR_HEADER. on a header error the stream
+ * is left just after the false sync code so the next call keeps looking */
+static int read_frame_header(flacDecoder_t *d) {
+  flacFrame_t *f = &d->frame;
+  uint32_t v, blockCode, rateCode, chanCode, bitsCode, variable;
+  uint64_t number;
+  uint8_t crc = 0;
+  byte_align(d);
+  //sync code, 0xFFF8 fixed or 0xFFF9 variable block size
+  if(get_bits(d, 8, &v) == false) return FLAC_ERR_END;
+  while(1) {
+    if(v == 0xFF) {
+      if(get_bits(d, 8, &v) == false) return FLAC_ERR_END;
+      if((v & 0xFE) == 0xF8) break;
+    } else if(get_bits(d, 8, &v) == false) {
+      return FLAC_ERR_END;
+    }
+  }
+  variable = v & 1;
+  crc = crc8Table[crc8Table[0xFF] ^ v];
+  if(header_bits(d, 8, &v, &crc) == false) return FLAC_ERR_END;
+  blockCode = v >> 4;
+  rateCode = v & 0xF;
+  if(header_bits(d, 8, &v, &crc) == false) return FLAC_ERR_END;
+  chanCode = v >> 4;
+  bitsCode = (v >> 1) & 7;
+  if(blockCode == 0 || rateCode == 15 || chanCode > 10 || bitsCode == 3 || (v & 1))
+    return FLAC_ERR_HEADER;
+  if(read_coded_number(d, &number, &crc) == false) return FLAC_ERR_HEADER;
+
+  if(blockCode == 1) f->blockSize = 192;
+  else if(blockCode <= 5) f->blockSize = 576 << (blockCode - 2);
+  else if(blockCode <= 7) {
+    if(header_bits(d, blockCode == 6 ? 8 : 16, &v, &crc) == false) return FLAC_ERR_END;
+    f->blockSize = v + 1;
+  } else f->blockSize = 256 << (blockCode - 8);
+
+  if(rateCode == 0) f->sampleRate = d->info.sampleRate;
+  else if(rateCode < 12) f->sampleRate = frameRates[rateCode];
+  else {
+    if(header_bits(d, rateCode == 12 ? 8 : 16, &v, &crc) == false) return FLAC_ERR_END;
+    f->sampleRate = rateCode == 12 ? v * 1000 : (rateCode == 13 ? v : v * 10);
+  }
+  if(get_bits(d, 8, &v) == false) return FLAC_ERR_END;
+  if(v != crc) return FLAC_ERR_HEADER;
+
+  f->assignment = chanCode;
+  f->channels = chanCode < 8 ? chanCode + 1 : 2;
+  f->bitsPerSample = bitsCode ? frameBits[bitsCode] : d->info.bitsPerSample;
+  f->firstSample = variable ? number : number * d->info.maxBlock;
+  if(f->channels != d->info.channels || f->blockSize > d->info.maxBlock || f->sampleRate == 0
+      || f->bitsPerSample > 24)
+    return FLAC_ERR_FORMAT;
+  return 0;
+}
+
+/* partitioned Rice coded residual for samples order..blockSize-1 */
+static int read_residual(flacDecoder_t *d, int32_t *out, int order) {
+  uint32_t method, partOrder, param, q, r, escBits;
+  int n = d->frame.blockSize;
+  if(get_bits(d, 2, &method) == false || method > 1) return FLAC_ERR_DATA;
+  if(get_bits(d, 4, &partOrder) == false) return FLAC_ERR_DATA;
+  int parts = 1 << partOrder, partSize = n >> partOrder;
+  int paramBits = method ? 5 : 4, escape = method ? 31 : 15;
+  if((partSize << partOrder) != n || partSize < order) return FLAC_ERR_DATA;
+  int i = order;
+  for(int p = 0; p < parts; ++p) {
+    int end = (p + 1) * partSize;
+    if(get_bits(d, paramBits, &param) == false) return FLAC_ERR_DATA;
+    if(param == escape) {
+      if(get_bits(d, 5, &escBits) == false) return FLAC_ERR_DATA;
+      for(; i < end; ++i)
+        if(get_signed(d, escBits, &out[i]) == false) return FLAC_ERR_DATA;
+      continue;
+    }
+    for(; i < end; ++i) {
+      if(get_unary(d, &q) == false || get_bits(d, param, &r) == false) return FLAC_ERR_DATA;
+      uint32_t u = (q << param) | r;
+      out[i] = (int32_t)(u >> 1) ^ -(int32_t)(u & 1);
+    }
+  }
+  return 0;
+}
+
+static void predict_fixed(int32_t *s, int n, int order) {
+  switch(order) {
+    case 1:
+      for(int i = 1; i < n; ++i) s[i] += s[i - 1];
+      break;
+    case 2:
+      for(int i = 2; i < n; ++i) s[i] += 2 * s[i - 1] - s[i - 2];
+      break;
+    case 3:
+      for(int i = 3; i < n; ++i) s[i] += 3 * (s[i - 1] - s[i - 2]) + s[i - 3];
+      break;
+    case 4:
+      for(int i = 4; i < n; ++i) s[i] += 4 * (s[i - 1] + s[i - 3]) - 6 * s[i - 2] - s[i - 4];
+      break;
+  }
+}
+
+/* 32-bit sums are enough while bits + precision + log2(order) stays below 32,
+ * which covers 16-bit audio from every encoder setting */
+static void predict_lpc(int32_t *s, int n, const int32_t *coef, int order, int shift, bool wide) {
+  if(wide == false) {
+    for(int i = order; i < n; ++i) {
+      int32_t sum = 0;
+      const int32_t *x = s + i;
+      for(int j = 0; j < order; ++j) sum += coef[j] * x[-1 - j];
+      s[i] += sum >> shift;
+    }
+  } else {
+    for(int i = order; i < n; ++i) {
+      int64_t sum = 0;
+      const int32_t *x = s + i;
+      for(int j = 0; j < order; ++j) sum += (int64_t)coef[j] * x[-1 - j];
+      s[i] += (int32_t)(sum >> shift);
+    }
+  }
+}
+
+static int read_subframe(flacDecoder_t *d, int32_t *s, int bits) {
+  uint32_t v, type, wasted = 0;
+  int n = d->frame.blockSize, err;
+  if(get_bits(d, 8, &v) == false || (v & 0x80)) return FLAC_ERR_DATA;
+  type = (v >> 1) & 0x3F;
+  if(v & 1) {
+    if(get_unary(d, &wasted) == false) return FLAC_ERR_DATA;
+    wasted++;
+    if((int)wasted >= bits) return FLAC_ERR_DATA;
+    bits -= wasted;
+  }
+  if(type == 0) {
+    int32_t c;
+    if(get_signed(d, bits, &c) == false) return FLAC_ERR_DATA;
+    for(int i = 0; i < n; ++i) s[i] = c;
+  } else if(type == 1) {
+    for(int i = 0; i < n; ++i)
+      if(get_signed(d, bits, &s[i]) == false) return FLAC_ERR_DATA;
+  } else if(type >= 8 && type <= 12) {
+    int order = type - 8;
+    if(order > n) return FLAC_ERR_DATA;
+    for(int i = 0; i < order; ++i)
+      if(get_signed(d, bits, &s[i]) == false) return FLAC_ERR_DATA;
+    if((err = read_residual(d, s, order)) < 0) return err;
+    predict_fixed(s, n, order);
+  } else if(type >= 32) {
+    int32_t coef[FLAC_MAX_ORDER], shift;
+    uint32_t precision;
+    int order = type - 31;
+    if(order > n) return FLAC_ERR_DATA;
+    for(int i = 0; i < order; ++i)
+      if(get_signed(d, bits, &s[i]) == false) return FLAC_ERR_DATA;
+    if(get_bits(d, 4, &precision) == false || precision == 15) return FLAC_ERR_DATA;
+    precision++;
+    if(get_signed(d, 5, &shift) == false || shift < 0) return FLAC_ERR_DATA;
+    for(int i = 0; i < order; ++i)
+      if(get_signed(d, precision, &coef[i]) == false) return FLAC_ERR_DATA;
+    if((err = read_residual(d, s, order)) < 0) return err;
+    int log2Order = 32 - __builtin_clz(order);
+    predict_lpc(s, n, coef, order, shift, bits + (int)precision + log2Order > 32);
+  } else {
+    return FLAC_ERR_DATA;
+  }
+  if(wasted)
+    for(int i = 0; i < n; ++i) s[i] = (int32_t)((uint32_t)s[i] << wasted);
+  return 0;
+}
+
+static void decorrelate(flacDecoder_t *d) {
+  int32_t *a = d->samples[0], *b = d->samples[1];
+  int n = d->frame.blockSize;
+  switch(d->frame.assignment) {
+    case 8: //left, side
+      for(int i = 0; i < n; ++i) b[i] = a[i] - b[i];
+      break;
+    case 9: //side, right
+      for(int i = 0; i < n; ++i) a[i] += b[i];
+      break;
+    case 10: //mid, side
+      for(int i = 0; i < n; ++i) {
+        int32_t mid = (int32_t)((uint32_t)a[i] << 1) | (b[i] & 1);
+        a[i] = (mid + b[i]) >> 1;
+        b[i] = (mid - b[i]) >> 1;
+      }
+      break;
+  }
+}
+
+/* ---- api ---- */
+
+flacDecoder_t *flac_open(flacFetch_t fetch, void *ctx) {
+  flacDecoder_t *d = calloc(1, sizeof(flacDecoder_t));
+  uint32_t v, type, len;
+  if(d == NULL) return NULL;
+  d->fetch = fetch;
+  d->ctx = ctx;
+  if(get_bits(d, 32, &v) == false || v != 0x664C6143) goto fail; //fLaC
+  do {
+    if(get_bits(d, 8, &type) == false || get_bits(d, 24, &len) == false) goto fail;
+    if((type & 0x7F) == META_STREAMINFO) {
+      if(len != 34 || read_streaminfo(d) == false) goto fail;
+    } else if(skip_bytes(d, len) == false) {
+      goto fail;
+    }
+  } while((type & META_LAST) == 0);
+  flacStreamInfo_t *si = &d->info;
+  if(si->channels > FLAC_MAX_CHANNELS || si->maxBlock > FLAC_MAX_BLOCK || si->maxBlock < 16
+      || si->bitsPerSample < 4 || si->bitsPerSample > 24 || si->sampleRate == 0)
+    goto fail;
+  d->audioStart = flac_tell(d);
+  for(int ch = 0; ch < si->channels; ++ch) {
+    d->samples[ch] = malloc(si->maxBlock * sizeof(int32_t));
+    if(d->samples[ch] == NULL) goto fail;
+  }
+  return d;
+fail:
+  flac_close(d);
+  return NULL;
+}
+
+/* decodes the next frame into samples[], returns its block size or one of
+ * the FLAC_ERR codes. after an error the next call resyncs on its own */
+int flac_decode_frame(flacDecoder_t *d) {
+  int err;
+  while((err = read_frame_header(d)) == FLAC_ERR_HEADER);
+  if(err < 0) return err;
+  flacFrame_t *f = &d->frame;
+  for(int ch = 0; ch < f->channels; ++ch) {
+    int bits = f->bitsPerSample;
+    //the side channel needs one bit more
+    if((ch == 1 && (f->assignment == 8 || f->assignment == 10)) || (ch == 0 && f->assignment == 9))
+      bits++;
+    if((err = read_subframe(d, d->samples[ch], bits)) < 0) return err;
+  }
+  byte_align(d);
+  uint32_t crc;
+  if(get_bits(d, 16, &crc) == false) return FLAC_ERR_END;
+  if(f->channels == 2) decorrelate(d);
+  return f->blockSize;
+}
+
+/* count samples per channel from sample from on, 16-bit interleaved. wider
+ * samples keep their top 16 bits like the wav path does */
+void flac_output_s16(flacDecoder_t *d, int16_t *out, int from, int count) {
+  int chans = d->frame.channels, shift = d->frame.bitsPerSample - 16;
+  for(int ch = 0; ch < chans; ++ch) {
+    const int32_t *s = d->samples[ch] + from;
+    int16_t *o = out + ch;
+    if(shift > 0)
+      for(int i = 0; i < count; ++i, o += chans) *o = s[i] >> shift;
+    else
+      for(int i = 0; i < count; ++i, o += chans) *o = s[i] * (1 << -shift);
+  }
+}
+
+/* bytes of the stream consumed so far */
+uint64_t flac_tell(flacDecoder_t *d) {
+  return d->consumed + d->pos - d->cacheBits / 8;
+}
+
+/* forget buffered data, fetch continues at byte pos of the stream, e.g.
+ * after a seek. the next frame is found by its sync code */
+void flac_reset(flacDecoder_t *d, uint64_t pos) {
+  d->data = NULL;
+  d->len = d->pos = 0;
+  d->cache = 0;
+  d->cacheBits = 0;
+  d->consumed = pos;
+  d->end = false;
+}
+
+void flac_close(flacDecoder_t *d) {
+  if(d == NULL) return;
+  for(int ch = 0; ch < FLAC_MAX_CHANNELS; ++ch) free(d->samples[ch]);
+  free(d);
+}
@@ -1,5 +1,26 @@
 
-CFLAGS += -DARM -DCONFIG_AUDIO_HELIX
+CFLAGS += -DCONFIG_AUDIO_HELIX
+# arithmetic primitives: Xtensa assembly in include/assembly.h unless the
+# portable C versions are asked for, e.g. to compare them
+ifdef CONFIG_HELIX_PORTABLE_PRIMITIVES
+CFLAGS += -DHELIX_PORTABLE
+endif
+# memory placement profile, see mp3common.h
+ifdef CONFIG_HELIX_IRAM_SYNTH
+CFLAGS += -DHELIX_PLACE_IRAM_SYNTH
+endif
+ifdef CONFIG_HELIX_IRAM_HUFFMAN
+CFLAGS += -DHELIX_PLACE_IRAM_HUFFMAN
+endif
+ifdef CONFIG_HELIX_DRAM_SYNTH
+CFLAGS += -DHELIX_PLACE_DRAM_SYNTH
+endif
+ifdef CONFIG_HELIX_DRAM_HUFFMAN
+CFLAGS += -DHELIX_PLACE_DRAM_HUFFMAN
+endif
+ifdef CONFIG_HELIX_STALL_PROFILE
+CFLAGS += -DHELIX_PROFILE
+endif
 COMPONENT_ADD_INCLUDEDIRS := include
 COMPONENT_SRCDIRS:=src
 ./src/subband.o ./src/scalfact.o ./src/dqchan.o ./src/huffman.o: CFLAGS += -Wno-unused-but-set-variable
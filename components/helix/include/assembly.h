@@ -267,7 +267,83 @@ static __inline int CLZ(int x)
 	return numZeros;
 }
 
-#elif defined(__GNUC__) && defined(ARM)
+#elif defined(__GNUC__) && defined(__XTENSA__) && !defined(HELIX_PORTABLE)
+
+/* Xtensa LX6 (ESP32): mulsh/mull need the MUL32 and MUL32_HIGH options,
+ * nsau the NSA option, all of which the ESP32 has */
+typedef long long Word64;
+
+typedef union _U64 {
+	Word64 w64;
+	struct {
+		/* ESP32 is little endian */
+		unsigned int lo32;
+		signed int   hi32;
+	} r;
+} U64;
+
+static __inline int MULSHIFT32(int x, int y)
+{
+	int z;
+
+	__asm__ ("mulsh %0, %1, %2" : "=r" (z) : "r" (x), "r" (y));
+	return z;
+}
+
+static __inline Word64 MADD64(Word64 sum64, int x, int y)
+{
+	U64 u;
+	unsigned int lo;
+	int hi;
+
+	__asm__ (
+		"mull  %0, %2, %3\n\t"
+		"mulsh %1, %2, %3"
+		: "=&r" (lo), "=&r" (hi)
+		: "r" (x), "r" (y)
+	);
+	u.w64 = sum64;
+	u.r.lo32 += lo;
+	/* no carry flag, the carry out of the low word is lo32 < lo */
+	u.r.hi32 = (int)((unsigned int)u.r.hi32 + (unsigned int)hi + (u.r.lo32 < lo));
+	return u.w64;
+}
+
+/* n must be in [0, 31], which is all the decoder ever asks for */
+static __inline Word64 SAR64(Word64 x, int n)
+{
+	U64 u;
+
+	u.w64 = x;
+	__asm__ (
+		"ssr %2\n\t"
+		"src %0, %1, %0\n\t"
+		"sra %1, %1"
+		: "+r" (u.r.lo32), "+r" (u.r.hi32)
+		: "r" (n)
+		: "sar"
+	);
+	return u.w64;
+}
+
+static __inline int FASTABS(int x)
+{
+	int t;
+
+	__asm__ ("abs %0, %1" : "=r" (t) : "r" (x));
+	return t;
+}
+
+/* nsau returns 32 for 0, as the generic CLZ does */
+static __inline int CLZ(int x)
+{
+	int t;
+
+	__asm__ ("nsau %0, %1" : "=r" (t) : "r" (x));
+	return t;
+}
+
+#elif defined(__GNUC__) && (defined(ARM) || defined(HELIX_PORTABLE))
 
 //added by yongjian.ma
 typedef long long Word64;
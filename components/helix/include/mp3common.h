@@ -110,6 +110,7 @@ int Dequantize(MP3DecInfo *mp3DecInfo, int gr);
 int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch);
 int UnpackScaleFactors(MP3DecInfo *mp3DecInfo, unsigned char *buf, int *bitOffset, int bitsAvail, int gr, int ch);
 int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf);
+int SubbandGranule(MP3DecInfo *mp3DecInfo, int outBuf[MAX_NCHAN][MAX_NSAMP], int *gb, int nChans, short *pcmBuf);
 
 /* mp3tabs.c - global ROM tables */
 extern const int samplerateTab[3][3];
@@ -120,4 +121,55 @@ extern const short sideBytesTab[3][2];
 extern const short slotTab[3][3][15];
 extern const SFBandTable sfBandTable[3][3];
 
+/* optional per stage timing, defined by the host benchmark in bench/ and by
+ * CONFIG_HELIX_STALL_PROFILE. time since the previous mark is charged to stage */
+enum {
+	PROFILE_BEGIN = -1,
+	PROFILE_FRAME,		/* header, side info, main data */
+	PROFILE_HUFFMAN,	/* scale factors and Huffman */
+	PROFILE_DEQUANT,	/* dequantize, stereo processing, reorder */
+	PROFILE_IMDCT,		/* alias reduction, IMDCT, overlap-add */
+	PROFILE_SUBBAND,	/* DCT32 and polyphase synthesis */
+	PROFILE_STAGES
+};
+
+#ifdef HELIX_PROFILE
+void HelixProfileMark(int stage);
+#define PROFILE_MARK(stage)	HelixProfileMark(stage)
+#else
+#define PROFILE_MARK(stage)
+#endif
+
+/* memory placement profile, component.mk turns the Kconfig choice into these
+ * flags. kernels in IRAM are kept out of line, a static one inlined into its
+ * caller would otherwise end up back in flash with it */
+#if defined(HELIX_PLACE_IRAM_SYNTH) || defined(HELIX_PLACE_IRAM_HUFFMAN) || \
+	defined(HELIX_PLACE_DRAM_SYNTH) || defined(HELIX_PLACE_DRAM_HUFFMAN)
+#include "esp_attr.h"
+#endif
+
+#ifdef HELIX_PLACE_IRAM_SYNTH
+#define IRAM_SYNTH		IRAM_ATTR __attribute__((noinline))
+#else
+#define IRAM_SYNTH
+#endif
+
+#ifdef HELIX_PLACE_IRAM_HUFFMAN
+#define IRAM_HUFFMAN	IRAM_ATTR __attribute__((noinline))
+#else
+#define IRAM_HUFFMAN
+#endif
+
+#ifdef HELIX_PLACE_DRAM_SYNTH
+#define DRAM_SYNTH		DRAM_ATTR
+#else
+#define DRAM_SYNTH
+#endif
+
+#ifdef HELIX_PLACE_DRAM_HUFFMAN
+#define DRAM_HUFFMAN	DRAM_ATTR
+#else
+#define DRAM_HUFFMAN
+#endif
+
 #endif	/* _MP3COMMON_H */
@@ -121,10 +121,22 @@ typedef struct _MP3FrameInfo {
 	int version;
 } MP3FrameInfo;
 
+/* IMDCT output of one frame, handed from MP3DecodeAnalysis() to
+ * MP3DecodeSynthesis() so that the two halves can run on different cores */
+typedef struct _MP3SynthJob {
+	int outBuf[MAX_NGRAN][MAX_NCHAN][MAX_NSAMP];
+	int gb[MAX_NGRAN][MAX_NCHAN];
+	int nGrans;
+	int nChans;
+	int nGranSamps;
+} MP3SynthJob;
+
 /* public API */
 HMP3Decoder MP3InitDecoder(void);
 void MP3FreeDecoder(HMP3Decoder hMP3Decoder);
 int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize);
+int MP3DecodeAnalysis(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, MP3SynthJob *job);
+int MP3DecodeSynthesis(HMP3Decoder hMP3Decoder, MP3SynthJob *job, short *outbuf);
 
 void MP3GetLastFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo);
 int MP3GetNextFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo, unsigned char *buf);
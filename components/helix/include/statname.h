@@ -70,6 +70,7 @@
 #define	IMDCT				STATNAME(IMDCT)
 #define	UnpackScaleFactors	STATNAME(UnpackScaleFactors)
 #define	Subband				STATNAME(Subband)
+#define	SubbandGranule		STATNAME(SubbandGranule)
 
 #define	samplerateTab		STATNAME(samplerateTab)
 #define	bitrateTab			STATNAME(bitrateTab)
@@ -253,7 +253,7 @@ static const int c9_4 = 0x7e0e2e32;
 /* format = Q31
  * cos(((0:8) + 0.5) * (pi/18)) 
  */
-static const int c18[9] = {
+static DRAM_SYNTH const int c18[9] = {
 	0x7f834ed0, 0x7ba3751d, 0x7401e4c1, 0x68d9f964, 0x5a82799a, 0x496af3e2, 0x36185aee, 0x2120fb83, 0x0b27eb5c, 
 };
 
@@ -328,7 +328,7 @@ static __inline void idct9(int *x)
  *      fastWin[2*j+1] = c(j)*(s(j) - c(j))
  * format = Q30
  */
-static const int fastWin36[18] = {
+static DRAM_SYNTH const int fastWin36[18] = {
 	0x42aace8b, 0xc2e92724, 0x47311c28, 0xc95f619a, 0x4a868feb, 0xd0859d8c,
 	0x4c913b51, 0xd8243ea0, 0x4d413ccc, 0xe0000000, 0x4c913b51, 0xe7dbc161,
 	0x4a868feb, 0xef7a6275, 0x47311c28, 0xf6a09e67, 0x42aace8b, 0xfd16d8dd,
@@ -366,7 +366,7 @@ static const int fastWin36[18] = {
  * TODO:        optimize for ARM (reorder window coefs, ARM-style pointers in C, 
  *                inline asm may or may not be helpful)
  **************************************************************************************/
-static int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx, int gb)
+static IRAM_SYNTH int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx, int gb)
 {
 	int i, es, xBuf[18], xPrevWin[18];
 	int acc1, acc2, s, d, t, mOut;
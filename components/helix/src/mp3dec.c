@@ -44,6 +44,7 @@
 
 #include "string.h"		/* for memmove, memcpy (can replace with different implementations if desired) */
 #include "mp3common.h"	/* includes mp3dec.h (public API) and internal, platform-independent API */
+#include "coder.h"		/* IMDCTInfo, for handing granules to MP3DecodeSynthesis() */
 //#include "hxthreadyield.h"
 
 /**************************************************************************************
@@ -251,43 +252,26 @@ static void MP3ClearBadFrame(MP3DecInfo *mp3DecInfo, short *outbuf)
 {
 	int i;
 
-	if (!mp3DecInfo)
+	if (!mp3DecInfo || !outbuf)
 		return;
 
 	for (i = 0; i < mp3DecInfo->nGrans * mp3DecInfo->nGranSamps * mp3DecInfo->nChans; i++)
 		outbuf[i] = 0;
 }
 
-/**************************************************************************************
- * Function:    MP3Decode
- *
- * Description: decode one frame of MP3 data
- *
- * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
- *              double pointer to buffer of MP3 data (containing headers + mainData)
- *              number of valid bytes remaining in inbuf
- *              pointer to outbuf, big enough to hold one frame of decoded PCM samples
- *              flag indicating whether MP3 data is normal MPEG format (useSize = 0)
- *                or reformatted as "self-contained" frames (useSize = 1)
- *
- * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
- *                number of output samples = nGrans * nGranSamps * nChans
- *              updated inbuf pointer, updated bytesLeft
- *
- * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
- *
- * Notes:       switching useSize on and off between frames in the same stream 
- *                is not supported (bit reservoir is not maintained if useSize on)
- **************************************************************************************/
-int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize)
+/* MP3Decode() when job is 0, else MP3DecodeAnalysis() */
+static int DecodeFrame(MP3DecInfo *mp3DecInfo, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize, MP3SynthJob *job)
 {
 	int offset, bitOffset, mainBits, gr, ch, fhBytes, siBytes, freeFrameBytes;
 	int prevBitOffset, sfBlockBits, huffBlockBits;
 	unsigned char *mainPtr;
-	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
 	 
 	if (!mp3DecInfo)
 		return ERR_MP3_NULL_POINTER;
+	if (job)
+		job->nGrans = 0;
+
+	PROFILE_MARK(PROFILE_BEGIN);
 
 	/* unpack frame header */
 	fhBytes = UnpackFrameHeader(mp3DecInfo, *inbuf);
@@ -367,6 +351,7 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 	}
 	bitOffset = 0;
 	mainBits = mp3DecInfo->mainDataBytes * 8;
+	PROFILE_MARK(PROFILE_FRAME);
 
 	/* decode one complete frame */
 	for (gr = 0; gr < mp3DecInfo->nGrans; gr++) {
@@ -396,12 +381,14 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 			mainPtr += offset;
 			mainBits -= (8*offset - prevBitOffset + bitOffset);
 		}
+		PROFILE_MARK(PROFILE_HUFFMAN);
 	
 		/* dequantize coefficients, decode stereo, reorder short blocks */
 		if (Dequantize(mp3DecInfo, gr) < 0) {
 			MP3ClearBadFrame(mp3DecInfo, outbuf);
 			return ERR_MP3_INVALID_DEQUANTIZE;			
 		}
+		PROFILE_MARK(PROFILE_DEQUANT);
 
 		/* alias reduction, inverse MDCT, overlap-add, frequency inversion */
 		for (ch = 0; ch < mp3DecInfo->nChans; ch++)
@@ -409,12 +396,109 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 				MP3ClearBadFrame(mp3DecInfo, outbuf);
 				return ERR_MP3_INVALID_IMDCT;			
 			}
+		PROFILE_MARK(PROFILE_IMDCT);
+
+		if (job) {
+			/* keep the granule for MP3DecodeSynthesis(), IMDCTInfo is reused by the next one */
+			IMDCTInfo *mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
+			memcpy(job->outBuf[gr], mi->outBuf, mp3DecInfo->nChans * sizeof(mi->outBuf[0]));
+			for (ch = 0; ch < mp3DecInfo->nChans; ch++)
+				job->gb[gr][ch] = mi->gb[ch];
+			job->nGrans = gr + 1;
+			job->nChans = mp3DecInfo->nChans;
+			job->nGranSamps = mp3DecInfo->nGranSamps;
+			continue;
+		}
 
 		/* subband transform - if stereo, interleaves pcm LRLRLR */
 		if (Subband(mp3DecInfo, outbuf + gr*mp3DecInfo->nGranSamps*mp3DecInfo->nChans) < 0) {
 			MP3ClearBadFrame(mp3DecInfo, outbuf);
 			return ERR_MP3_INVALID_SUBBAND;			
 		}
+		PROFILE_MARK(PROFILE_SUBBAND);
+	}
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3Decode
+ *
+ * Description: decode one frame of MP3 data
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              double pointer to buffer of MP3 data (containing headers + mainData)
+ *              number of valid bytes remaining in inbuf
+ *              pointer to outbuf, big enough to hold one frame of decoded PCM samples
+ *              flag indicating whether MP3 data is normal MPEG format (useSize = 0)
+ *                or reformatted as "self-contained" frames (useSize = 1)
+ *
+ * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
+ *                number of output samples = nGrans * nGranSamps * nChans
+ *              updated inbuf pointer, updated bytesLeft
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       switching useSize on and off between frames in the same stream 
+ *                is not supported (bit reservoir is not maintained if useSize on)
+ **************************************************************************************/
+int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize)
+{
+	return DecodeFrame((MP3DecInfo *)hMP3Decoder, inbuf, bytesLeft, outbuf, useSize, 0);
+}
+
+/**************************************************************************************
+ * Function:    MP3DecodeAnalysis
+ *
+ * Description: first half of MP3Decode(), everything up to and including IMDCT
+ *
+ * Inputs:      as MP3Decode(), normal MPEG format only
+ *              job to receive the IMDCT output of the frame
+ *
+ * Outputs:     filled job, to be passed to MP3DecodeSynthesis() in stream order
+ *              updated inbuf pointer, updated bytesLeft
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       may run concurrently with MP3DecodeSynthesis() of the previous frame
+ *                on the same decoder instance, the two halves share no state
+ *              on error, job->nGrans granules were still decoded (MP3Decode() would
+ *                have synthesized them), pass the job on to keep the subband state
+ *                in step and drop its output
+ **************************************************************************************/
+int MP3DecodeAnalysis(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, MP3SynthJob *job)
+{
+	if (!job)
+		return ERR_MP3_NULL_POINTER;
+
+	return DecodeFrame((MP3DecInfo *)hMP3Decoder, inbuf, bytesLeft, 0, 0, job);
+}
+
+/**************************************************************************************
+ * Function:    MP3DecodeSynthesis
+ *
+ * Description: second half of MP3Decode(), subband transform of a frame
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              job filled by MP3DecodeAnalysis()
+ *              pointer to outbuf, big enough to hold one frame of decoded PCM samples
+ *
+ * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ **************************************************************************************/
+int MP3DecodeSynthesis(HMP3Decoder hMP3Decoder, MP3SynthJob *job, short *outbuf)
+{
+	int gr;
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo || !job || !outbuf)
+		return ERR_MP3_NULL_POINTER;
+
+	PROFILE_MARK(PROFILE_BEGIN);
+	for (gr = 0; gr < job->nGrans; gr++) {
+		if (SubbandGranule(mp3DecInfo, job->outBuf[gr], job->gb[gr], job->nChans, outbuf + gr*job->nGranSamps*job->nChans) < 0)
+			return ERR_MP3_INVALID_SUBBAND;
+		PROFILE_MARK(PROFILE_SUBBAND);
 	}
 	return ERR_MP3_NONE;
 }
@@ -61,24 +61,46 @@
  **************************************************************************************/
 int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf)
 {
-	int b;
-	HuffmanInfo *hi;
 	IMDCTInfo *mi;
-	SubbandInfo *sbi;
 
 	/* validate pointers */
-	if (!mp3DecInfo || !mp3DecInfo->HuffmanInfoPS || !mp3DecInfo->IMDCTInfoPS || !mp3DecInfo->SubbandInfoPS)
+	if (!mp3DecInfo || !mp3DecInfo->IMDCTInfoPS)
 		return -1;
 
-	hi = (HuffmanInfo *)mp3DecInfo->HuffmanInfoPS;
 	mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
+	return SubbandGranule(mp3DecInfo, (int (*)[MAX_NSAMP])mi->outBuf, mi->gb, mp3DecInfo->nChans, pcmBuf);
+}
+
+/**************************************************************************************
+ * Function:    SubbandGranule
+ *
+ * Description: subband transform of one granule held outside of IMDCTInfo
+ *
+ * Inputs:      IMDCT output and guard bits for each channel, number of channels
+ *              only SubbandInfo of mp3DecInfo is used, so the rest of the decoder
+ *                may already work on the next frame
+ *
+ * Outputs:     decoded PCM data, interleaved LRLRLR... if stereo
+ *
+ * Return:      0 on success,  -1 if null input pointers
+ **************************************************************************************/
+int SubbandGranule(MP3DecInfo *mp3DecInfo, int outBuf[MAX_NCHAN][MAX_NSAMP], int *gb, int nChans, short *pcmBuf)
+{
+	int b;
+	int (*blocks)[BLOCK_SIZE][NBANDS] = (int (*)[BLOCK_SIZE][NBANDS])outBuf;
+	SubbandInfo *sbi;
+
+	/* validate pointers */
+	if (!mp3DecInfo || !mp3DecInfo->SubbandInfoPS)
+		return -1;
+
 	sbi = (SubbandInfo*)(mp3DecInfo->SubbandInfoPS);
 
-	if (mp3DecInfo->nChans == 2) {
+	if (nChans == 2) {
 		/* stereo */
 		for (b = 0; b < BLOCK_SIZE; b++) {
-			FDCT32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
-			FDCT32(mi->outBuf[1][b], sbi->vbuf + 1*32, sbi->vindex, (b & 0x01), mi->gb[1]);
+			FDCT32(blocks[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), gb[0]);
+			FDCT32(blocks[1][b], sbi->vbuf + 1*32, sbi->vindex, (b & 0x01), gb[1]);
 			PolyphaseStereo(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
 			sbi->vindex = (sbi->vindex - (b & 0x01)) & 7;
 			pcmBuf += (2 * NBANDS);
@@ -86,7 +108,7 @@ int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf)
 	} else {
 		/* mono */
 		for (b = 0; b < BLOCK_SIZE; b++) {
-			FDCT32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
+			FDCT32(blocks[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), gb[0]);
 			PolyphaseMono(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
 			sbi->vindex = (sbi->vindex - (b & 0x01)) & 7;
 			pcmBuf += NBANDS;
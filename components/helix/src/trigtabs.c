@@ -97,7 +97,7 @@
  *		for (j = 0; j < 36; j++)
  * 			win[i][j] *= 1.0 / sqrt(2);
  */
-const int imdctWin[4][36] = {
+DRAM_SYNTH const int imdctWin[4][36] = {
 	{
 	0x02aace8b, 0x07311c28, 0x0a868fec, 0x0c913b52, 0x0d413ccd, 0x0c913b52, 0x0a868fec, 0x07311c28, 
 	0x02aace8b, 0xfd16d8dd, 0xf6a09e66, 0xef7a6275, 0xe7dbc161, 0xe0000000, 0xd8243e9f, 0xd0859d8b, 
@@ -219,7 +219,7 @@ const unsigned char uniqueIDTab[8] = {0x5f, 0x4b, 0x43, 0x5f, 0x5f, 0x4a, 0x52,
  *   csa[0][i] = CSi, csa[1][i] = CAi
  * format = Q31
  */
-const int csa[8][2] = {
+DRAM_SYNTH const int csa[8][2] = {
 	{0x6dc253f0, 0xbe2500aa}, 
 	{0x70dcebe4, 0xc39e4949},
 	{0x798d6e73, 0xd7e33f4a},
@@ -242,7 +242,7 @@ const int csa[8][2] = {
  * }
  * coef32[30] *= 0.5;	/ *** for initial back butterfly (i.e. two-point DCT) *** /
  */
-const int coef32[31] = {
+DRAM_SYNTH const int coef32[31] = {
 	0x7fd8878d, 0x7e9d55fc, 0x7c29fbee, 0x78848413, 0x73b5ebd0, 0x6dca0d14, 0x66cf811f, 0x5ed77c89, 
 	0x55f5a4d2, 0x4c3fdff3, 0x41ce1e64, 0x36ba2013, 0x2b1f34eb, 0x1f19f97b, 0x12c8106e, 0x0647d97c, 
 	0x7f62368f, 0x7a7d055b, 0x70e2cbc6, 0x62f201ac, 0x5133cc94, 0x3c56ba70, 0x25280c5d, 0x0c8bd35e, 
@@ -272,7 +272,7 @@ const int coef32[31] = {
  * polyCoef[256, 257, ... 263] are for special case of sample 16 (out of 0)
  *   see PolyphaseStereo() and PolyphaseMono()
  */
-const int polyCoef[264] = {
+DRAM_SYNTH const int polyCoef[264] = {
 	/* shuffled vs. original from 0, 1, ... 15 to 0, 15, 2, 13, ... 14, 1 */
 	0x00000000, 0x00000074, 0x00000354, 0x0000072c, 0x00001fd4, 0x00005084, 0x000066b8, 0x000249c4,
 	0x00049478, 0xfffdb63c, 0x000066b8, 0xffffaf7c, 0x00001fd4, 0xfffff8d4, 0x00000354, 0xffffff8c,
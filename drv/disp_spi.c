@@ -10,6 +10,8 @@
 #include "esp_system.h"
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
+#include "soc/gpio_struct.h"
+#include "esp_attr.h"
 #include <string.h>
 
 /*********************
@@ -19,16 +21,29 @@
 /**********************
  *      TYPEDEFS
  **********************/
-
+/*A queued transaction. 't.user' points back here so the callbacks find the DC level*/
+typedef struct {
+	spi_transaction_t t;
+	uint8_t dc;
+	disp_spi_done_cb_t done;
+} disp_spi_slot_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static spi_device_handle_t spi;
+static void IRAM_ATTR spi_pre_cb(spi_transaction_t * t);
+static void IRAM_ATTR spi_post_cb(spi_transaction_t * t);
+static void spi_reclaim(void);
+static void spi_reclaim_done(void);
+static void spi_poll(const uint8_t * data, uint8_t length, uint8_t dc);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static spi_device_handle_t spi;
+static disp_spi_slot_t slots[DISP_SPI_QUEUE_SIZE];
+static uint8_t slot_next;
+static uint8_t slot_pending;
 
 /**********************
  *      MACROS
@@ -47,18 +62,21 @@ void disp_spi_init(void)
 		.mosi_io_num=DISP_SPI_MOSI,
 		.sclk_io_num=DISP_SPI_CLK,
 		.quadwp_io_num=-1,
-		.quadhd_io_num=-1
+		.quadhd_io_num=-1,
+		.max_transfer_sz=DISP_SPI_MAX_TRANSFER
 	};
 
 	spi_device_interface_config_t devcfg={
 		.clock_speed_hz = 60*1000*1000,           //Clock out at 80 MHz
 		.mode=0,                                //SPI mode 0
 	//	.spics_io_num=DISP_SPI_CS,              //CS pin
-		.queue_size=16,
-		.pre_cb=NULL,
-		.post_cb=NULL,
+		.queue_size=DISP_SPI_QUEUE_SIZE,
+		.pre_cb=spi_pre_cb,                     //Sets the DC line
+		.post_cb=spi_post_cb,                   //Reports finished flushes
 	};
 
+	gpio_set_direction(DISP_SPI_DC, GPIO_MODE_OUTPUT);
+
 	//Initialize the SPI bus
 	ret=spi_bus_initialize(VSPI_HOST, &buscfg, 1);
 	assert(ret==ESP_OK);
@@ -68,26 +86,135 @@ void disp_spi_init(void)
 	assert(ret==ESP_OK);
 }
 
-void disp_spi_send(uint8_t * data, uint16_t length)
+/**
+ * Send data and wait until it (and everything queued before) is on the wire
+ * @param data the bytes to send
+ * @param length number of bytes
+ * @param dc DISP_SPI_CMD or DISP_SPI_DATA
+ */
+void disp_spi_send(const uint8_t * data, uint16_t length, uint8_t dc)
 {
-	if (length == 0) return;           //no need to send anything
+	disp_spi_queue(data, length, dc, NULL);
+	disp_spi_wait();
+}
 
-	spi_transaction_t t;
-    memset(&t, 0, sizeof(t));       	//Zero out the transaction
-	t.length = length * 8;              //Length is in bytes, transaction length is in bits.
-	t.tx_buffer = data;               	//Data
+/**
+ * Queue data for sending and return at once. Up to 4 bytes are copied,
+ * longer 'data' has to stay valid (and in DMA capable memory) until 'done' is called.
+ * @param data the bytes to send
+ * @param length number of bytes
+ * @param dc DISP_SPI_CMD or DISP_SPI_DATA
+ * @param done called from the SPI interrupt when the transaction is finished, or NULL
+ */
+void disp_spi_queue(const uint8_t * data, uint16_t length, uint8_t dc, disp_spi_done_cb_t done)
+{
+	if (length == 0) {                  //no need to send anything
+		if(done) done();
+		return;
+	}
+
+	if(slot_pending == DISP_SPI_QUEUE_SIZE) spi_reclaim();
+
+	disp_spi_slot_t * s = &slots[slot_next];
+	slot_next = (slot_next + 1) % DISP_SPI_QUEUE_SIZE;
+	slot_pending++;
+
+	memset(&s->t, 0, sizeof(s->t));     //Zero out the transaction
+	s->t.length = length * 8;           //Length is in bytes, transaction length is in bits.
+	if(length <= sizeof(s->t.tx_data)) {
+		s->t.flags = SPI_TRANS_USE_TXDATA;
+		memcpy(s->t.tx_data, data, length);
+	} else {
+		s->t.tx_buffer = data;
+	}
+	s->t.user = s;
+	s->dc = dc;
+	s->done = done;
+
+	esp_err_t ret = spi_device_queue_trans(spi, &s->t, portMAX_DELAY);
+	assert(ret==ESP_OK);
+}
 
-	esp_err_t ret;
-//	ret=spi_device_transmit(spi, &t);  //Transmit!
-//	assert(ret==ESP_OK);            	 //Should have had no issues.
+/**
+ * Wait until all the queued transactions are finished
+ */
+void disp_spi_wait(void)
+{
+	while(slot_pending) spi_reclaim();
+}
 
-	spi_device_queue_trans(spi, &t, portMAX_DELAY);
+/**
+ * Send a few commands with their arguments, e.g. a window setup, without waiting.
+ * When the bus is idle they go out as polling transactions: for a byte or four
+ * the interrupt and task switch of a queued transaction take longer than the transfer.
+ * Otherwise they are queued after the pending ones.
+ * @param cmds the commands
+ * @param cnt number of commands
+ */
+void disp_spi_send_cmds(const disp_spi_cmd_t * cmds, uint8_t cnt)
+{
+	uint8_t i;
+
+	spi_reclaim_done();
+	bool poll = slot_pending == 0;      /*Polling can't overtake queued transactions*/
+
+	for(i = 0; i < cnt; i++) {
+		if(poll) {
+			spi_poll(&cmds[i].cmd, 1, DISP_SPI_CMD);
+			spi_poll(cmds[i].data, cmds[i].len, DISP_SPI_DATA);
+		} else {
+			disp_spi_queue(&cmds[i].cmd, 1, DISP_SPI_CMD, NULL);
+			disp_spi_queue(cmds[i].data, cmds[i].len, DISP_SPI_DATA, NULL);
+		}
+	}
+}
 
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*The SPI driver runs these from its interrupt, in IRAM, so no gpio_set_level() here*/
+static void IRAM_ATTR spi_pre_cb(spi_transaction_t * t)
+{
+	disp_spi_slot_t * s = t->user;
+	if(s->dc) GPIO.out_w1ts = 1 << DISP_SPI_DC;
+	else GPIO.out_w1tc = 1 << DISP_SPI_DC;
+}
+
+static void IRAM_ATTR spi_post_cb(spi_transaction_t * t)
+{
+	disp_spi_slot_t * s = t->user;
+	if(s->done) s->done();
+}
+
+/*Free the oldest slot. The results come back in queue order*/
+static void spi_reclaim(void)
+{
 	spi_transaction_t * rt;
 	spi_device_get_trans_result(spi, &rt, portMAX_DELAY);
+	slot_pending--;
 }
 
+/*Free the slots of the finished transactions, without waiting for the others*/
+static void spi_reclaim_done(void)
+{
+	spi_transaction_t * rt;
+	while(slot_pending && spi_device_get_trans_result(spi, &rt, 0) == ESP_OK) slot_pending--;
+}
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/*Send up to 4 bytes busy waiting. The callbacks run here too, so 's' needs the DC level*/
+static void spi_poll(const uint8_t * data, uint8_t length, uint8_t dc)
+{
+	if(length == 0) return;
+
+	disp_spi_slot_t s;
+	memset(&s, 0, sizeof(s));
+	s.t.length = length * 8;
+	s.t.flags = SPI_TRANS_USE_TXDATA;
+	memcpy(s.t.tx_data, data, length);
+	s.t.user = &s;
+	s.dc = dc;
+
+	esp_err_t ret = spi_device_polling_transmit(spi, &s.t);
+	assert(ret==ESP_OK);
+}
@@ -14,6 +14,8 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include <stdint.h>
+#include <stdbool.h>
+#include "../lv_conf.h"
 
 /*********************
  *      DEFINES
@@ -22,17 +24,37 @@ extern "C" {
 #define DISP_SPI_MOSI 23
 #define DISP_SPI_CLK  18
 #define DISP_SPI_CS   17
+#define DISP_SPI_DC   5
+
+#define DISP_SPI_QUEUE_SIZE   16
+#define DISP_SPI_MAX_TRANSFER (LV_VDB_SIZE * 2)   /*A whole VDB band in one DMA transaction*/
+
+/*Level of the DC line during a transaction*/
+#define DISP_SPI_CMD  0
+#define DISP_SPI_DATA 1
 
 
 /**********************
  *      TYPEDEFS
  **********************/
+/*Called from the SPI interrupt, so it has to be in IRAM*/
+typedef void (*disp_spi_done_cb_t)(void);
+
+/*A command and its arguments, for 'disp_spi_send_cmds()'*/
+typedef struct {
+	uint8_t cmd;
+	uint8_t len;        /*Number of argument bytes*/
+	uint8_t data[4];
+} disp_spi_cmd_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 void disp_spi_init(void);
-void disp_spi_send(uint8_t * data, uint16_t length);
+void disp_spi_send(const uint8_t * data, uint16_t length, uint8_t dc);
+void disp_spi_queue(const uint8_t * data, uint16_t length, uint8_t dc, disp_spi_done_cb_t done);
+void disp_spi_wait(void);
+void disp_spi_send_cmds(const disp_spi_cmd_t * cmds, uint8_t cnt);
 
 /**********************
  *      MACROS
@@ -31,10 +31,14 @@ typedef struct {
  **********************/
 static void ili9441_send_cmd(uint8_t cmd);
 static void ili9341_send_data(void * data, uint16_t length);
+static void ili9341_set_window(int32_t x1, int32_t y1, int32_t x2, int32_t y2);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+/*The column and page address window last sent, -1: unknown*/
+static int32_t win_x1 = -1, win_x2 = -1;
+static int32_t win_y1 = -1, win_y2 = -1;
 
 /**********************
  *      MACROS
@@ -75,7 +79,7 @@ void ili9431_init(void)
 	};
 
 	//Initialize non-SPI GPIOs
-	gpio_set_direction(ILI9341_DC, GPIO_MODE_OUTPUT);
+	//DC is set up and driven by disp_spi
 	gpio_set_direction(ILI9341_RST, GPIO_MODE_OUTPUT);
 	//gpio_set_direction(ILI9341_BCKL, GPIO_MODE_OUTPUT);
 
@@ -100,6 +104,9 @@ void ili9431_init(void)
 		cmd++;
 	}
 
+	/*The init commands set a window too*/
+	win_x1 = win_x2 = win_y1 = win_y2 = -1;
+
 	///Enable backlight
 	// printf("Enable backlight.\n");
 	// gpio_set_level(ILI9341_BCKL, 1);
@@ -107,29 +114,14 @@ void ili9431_init(void)
 
 void ili9431_fill(int32_t x1, int32_t y1, int32_t x2, int32_t y2, lv_color_t color)
 {
-	uint8_t data[4];
-
-	/*Column addresses*/
-	ili9441_send_cmd(0x2A);
-	data[0] = (x1 >> 8) & 0xFF;
-	data[1] = x1 & 0xFF;
-	data[2] = (x2 >> 8) & 0xFF;
-	data[3] = x2 & 0xFF;
-	ili9341_send_data(data, 4);
-
-	/*Page addresses*/
-	ili9441_send_cmd(0x2B);
-	data[0] = (y1 >> 8) & 0xFF;
-	data[1] = y1 & 0xFF;
-	data[2] = (y2 >> 8) & 0xFF;
-	data[3] = y2 & 0xFF;
-	ili9341_send_data(data, 4);
-
-	/*Memory write*/
-	ili9441_send_cmd(0x2C);
+	ili9341_set_window(x1, y1, x2, y2);
 
 	uint32_t size = (x2 - x1 + 1) * (y2 - y1 + 1);
+#if LV_COLOR_16_SWAP == 0
 	uint16_t color_swap = ((color.full >> 8) & 0xFF) | ((color.full & 0xFF) << 8);	/*It's a 8 bit SPI bytes need to be swapped*/
+#else
+	uint16_t color_swap = color.full;	/*Already in the display's byte order*/
+#endif
 	uint16_t buf[ILI9341_HOR_RES];
 
 	uint32_t i;
@@ -151,67 +143,81 @@ void ili9431_fill(int32_t x1, int32_t y1, int32_t x2, int32_t y2, lv_color_t col
 
 void ili9431_flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2, const lv_color_t * color_map)
 {
-	uint8_t data[4];
-
-	/*Column addresses*/
-	ili9441_send_cmd(0x2A);
-	data[0] = (x1 >> 8) & 0xFF;
-	data[1] = x1 & 0xFF;
-	data[2] = (x2 >> 8) & 0xFF;
-	data[3] = x2 & 0xFF;
-	ili9341_send_data(data, 4);
-
-	/*Page addresses*/
-	ili9441_send_cmd(0x2B);
-	data[0] = (y1 >> 8) & 0xFF;
-	data[1] = y1 & 0xFF;
-	data[2] = (y2 >> 8) & 0xFF;
-	data[3] = y2 & 0xFF;
-	ili9341_send_data(data, 4);
-
-	/*Memory write*/
-	ili9441_send_cmd(0x2C);
-
+	/*Nothing is waited for here, the SPI driver sends the pixels in the background
+	 *and calls 'lv_flush_ready()' from its interrupt after the last one.
+	 *Meanwhile LVGL renders into the other VDB.*/
+	ili9341_set_window(x1, y1, x2, y2);
 
 	uint32_t size = (x2 - x1 + 1) * (y2 - y1 + 1);
 
+	uint8_t * color_u8 = (uint8_t *) color_map;
+
+#if LV_COLOR_16_SWAP == 0
 	/*Byte swapping is required*/
 	uint32_t i;
-	uint8_t * color_u8 = (uint8_t *) color_map;
 	uint8_t color_tmp;
 	for(i = 0; i < size * 2; i += 2) {
 		color_tmp = color_u8[i + 1];
 		color_u8[i + 1] = color_u8[i];
 		color_u8[i] = color_tmp;
 	}
-
-
-	while(size > ILI9341_HOR_RES) {
-
-		ili9341_send_data((void*)color_map, ILI9341_HOR_RES * 2);
-		//vTaskDelay(10 / portTICK_PERIOD_MS);
-		size -= ILI9341_HOR_RES;
-		color_map += ILI9341_HOR_RES;
+#endif
+
+	/*A whole VDB fits in one DMA transaction, larger areas are split*/
+	uint32_t len = size * 2;
+	while(len > DISP_SPI_MAX_TRANSFER) {
+		disp_spi_queue(color_u8, DISP_SPI_MAX_TRANSFER, DISP_SPI_DATA, NULL);
+		len -= DISP_SPI_MAX_TRANSFER;
+		color_u8 += DISP_SPI_MAX_TRANSFER;
 	}
 
-	ili9341_send_data((void*)color_map, size * 2);	/*Send the remaining data*/
-
-	lv_flush_ready();
-
+	disp_spi_queue(color_u8, len, DISP_SPI_DATA, lv_flush_ready);	/*The VDB is free when this is sent*/
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/*The DC line is set by the SPI driver right before the transaction goes out*/
 static void ili9441_send_cmd(uint8_t cmd)
 {
-	gpio_set_level(ILI9341_DC, 0);	 /*Command mode*/
-	disp_spi_send(&cmd, 1);
+	disp_spi_send(&cmd, 1, DISP_SPI_CMD);
 }
 
 static void ili9341_send_data(void * data, uint16_t length)
 {
-	gpio_set_level(ILI9341_DC, 1);	 /*Data mode*/
-	disp_spi_send(data, length);
+	disp_spi_send(data, length, DISP_SPI_DATA);
+}
+
+/**
+ * Set the address window and start a memory write, without waiting.
+ * The column or page addresses are sent only if they changed:
+ * memory write puts the pointer back to the start of the window anyway.
+ */
+static void ili9341_set_window(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+	disp_spi_cmd_t cmds[3];
+	uint8_t cnt = 0;
+
+	/*Column addresses*/
+	if(x1 != win_x1 || x2 != win_x2) {
+		cmds[cnt] = (disp_spi_cmd_t){0x2A, 4, {(x1 >> 8) & 0xFF, x1 & 0xFF, (x2 >> 8) & 0xFF, x2 & 0xFF}};
+		cnt++;
+		win_x1 = x1;
+		win_x2 = x2;
+	}
+
+	/*Page addresses*/
+	if(y1 != win_y1 || y2 != win_y2) {
+		cmds[cnt] = (disp_spi_cmd_t){0x2B, 4, {(y1 >> 8) & 0xFF, y1 & 0xFF, (y2 >> 8) & 0xFF, y2 & 0xFF}};
+		cnt++;
+		win_y1 = y1;
+		win_y2 = y2;
+	}
+
+	/*Memory write*/
+	cmds[cnt] = (disp_spi_cmd_t){0x2C, 0, {0}};
+	cnt++;
+
+	disp_spi_send_cmds(cmds, cnt);
 }
@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "../lvgl/lvgl.h"
+#include "disp_spi.h"
 
 /*********************
  *      DEFINES
@@ -21,7 +22,7 @@ extern "C" {
 #define ILI9341_HOR_RES	320
 #define ILI9341_VER_RES	320
 
-#define ILI9341_DC   5
+#define ILI9341_DC   DISP_SPI_DC
 #define ILI9341_RST  33
 #define ILI9341_BCKL 21
 
@@ -65,6 +65,9 @@
 
 /*Color settings*/
 #define LV_COLOR_DEPTH     16                     /*Color depth: 1/8/16/24*/
+#ifndef LV_COLOR_16_SWAP                          /*The host benchmarks build both ways*/
+#define LV_COLOR_16_SWAP   1                      /*1: Keep RGB565 in the ILI9341's byte order, so flushing needs no swap*/
+#endif
 #define LV_COLOR_TRANSP    LV_COLOR_LIME          /*Images pixels with this color will not be drawn (with chroma keying)*/
 
 /*Text settings*/
@@ -82,6 +85,7 @@
 /*Compiler attributes*/
 #define LV_ATTRIBUTE_TICK_INC                 /* Define a custom attribute to tick increment function */
 #define LV_ATTRIBUTE_TASK_HANDLER
+#define LV_ATTRIBUTE_FLUSH_READY    __attribute__((section(".iram1")))  /* Called from the SPI interrupt, which runs from IRAM */
 
 /*================
  *  THEME USAGE
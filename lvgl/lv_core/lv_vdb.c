@@ -127,7 +127,7 @@ void lv_vdb_flush(void)
 /**
  * Call in the display driver's  'disp_flush' function when the flushing is finished
  */
-void lv_flush_ready(void)
+LV_ATTRIBUTE_FLUSH_READY void lv_flush_ready(void)
 {
 #if LV_VDB_DOUBLE == 0
     vdb_state = LV_VDB_STATE_ACTIVE;
@@ -146,7 +146,7 @@ void lv_flush_ready(void)
 /**
  * Just for compatibility
  */
-void lv_flush_ready(void)
+LV_ATTRIBUTE_FLUSH_READY void lv_flush_ready(void)
 {
     /*Do nothing. It is used only for VDB*/
 }
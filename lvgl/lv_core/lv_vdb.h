@@ -15,15 +15,18 @@ extern "C" {
  *********************/
 #include "../../lv_conf.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef LV_ATTRIBUTE_FLUSH_READY
+#define LV_ATTRIBUTE_FLUSH_READY
+#endif
+
 #if LV_VDB_SIZE != 0
 
 #include "../lv_misc/lv_color.h"
 #include "../lv_misc/lv_area.h"
 
-/*********************
- *      DEFINES
- *********************/
-
 /**********************
  *      TYPEDEFS
  **********************/
@@ -53,8 +56,9 @@ void lv_vdb_flush(void);
 /**
  * In 'LV_VDB_DOUBLE' mode  has to be called when 'disp_map()'
  * is ready with copying the map to a frame buffer.
+ * It may be called from an interrupt (see LV_ATTRIBUTE_FLUSH_READY).
  */
-void lv_flush_ready(void);
+LV_ATTRIBUTE_FLUSH_READY void lv_flush_ready(void);
 
 /**********************
  *      MACROS
@@ -63,7 +67,7 @@ void lv_flush_ready(void);
 #else /*LV_VDB_SIZE != 0*/
 
 /*Just for compatibility*/
-void lv_flush_ready(void);
+LV_ATTRIBUTE_FLUSH_READY void lv_flush_ready(void);
 #endif
 
 #ifdef __cplusplus
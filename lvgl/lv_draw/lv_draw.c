@@ -423,6 +423,7 @@ void lv_draw_img(const lv_area_t * coords, const lv_area_t * mask,
             switch(img_data.header.format) {
                 case LV_IMG_FORMAT_FILE_RAW_RGB332: px_size = 1; break;
                 case LV_IMG_FORMAT_FILE_RAW_RGB565: px_size = 2; break;
+                case LV_IMG_FORMAT_FILE_RAW_RGB565_SWAP: px_size = 2; break;
                 case LV_IMG_FORMAT_FILE_RAW_RGB888: px_size = 4; break;
                 default: return;
             }
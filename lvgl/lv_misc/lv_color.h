@@ -20,6 +20,10 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#ifndef LV_COLOR_16_SWAP
+#define LV_COLOR_16_SWAP    0
+#endif
+
 #define LV_COLOR_BLACK   LV_COLOR_MAKE(0x00,0x00,0x00)
 #define LV_COLOR_WHITE   LV_COLOR_MAKE(0xFF,0xFF,0xFF)
 #define LV_COLOR_RED     LV_COLOR_MAKE(0xFF,0x00,0x00)
@@ -77,13 +81,21 @@ typedef union
     uint8_t full;
 }lv_color8_t;
 
+/*With LV_COLOR_16_SWAP the two bytes are in the order the display takes them (red first)*/
 typedef union
 {
     struct
     {
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
+        uint16_t green_h :3;
+        uint16_t red     :5;
+        uint16_t blue    :5;
+        uint16_t green_l :3;
+#else
         uint16_t blue  :5;
         uint16_t green :6;
         uint16_t red   :5;
+#endif
     };
     uint16_t full;
 }lv_color16_t;
@@ -116,8 +128,21 @@ typedef lv_color24_t lv_color_t;
 #error "Invalid LV_COLOR_DEPTH in misc_conf.h! Set it to 1, 8, 16 or 24!"
 #endif
 
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0 && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "LV_COLOR_16_SWAP is only needed (and supported) on little endian machines"
+#endif
+
 typedef uint8_t lv_opa_t;
 
+/*The 6 bit green of a 16 bit color, which is split in LV_COLOR_16_SWAP mode*/
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
+#define LV_COLOR_GET_G16(c)     (((c).green_h << 3) | (c).green_l)
+#define LV_COLOR_SET_G16(c, g)  do {(c).green_h = (g) >> 3; (c).green_l = (g) & 0x7;} while(0)
+#else
+#define LV_COLOR_GET_G16(c)     ((c).green)
+#define LV_COLOR_SET_G16(c, g)  ((c).green = (g))
+#endif
+
 typedef struct
 {
     uint16_t h;
@@ -157,7 +182,7 @@ static inline uint8_t lv_color_to1(lv_color_t color)
     }
 #elif LV_COLOR_DEPTH == 16
     if((color.red   & 0x10) ||
-       (color.green & 0x20) ||
+       (LV_COLOR_GET_G16(color) & 0x20) ||
 	   (color.blue  & 0x10)) {
     	return 1;
     } else {
@@ -184,7 +209,7 @@ static inline uint8_t lv_color_to8(lv_color_t color)
 #elif LV_COLOR_DEPTH == 16
     lv_color8_t ret;
     ret.red = color.red >> 2;       /* 5 - 3  = 2*/
-    ret.green = color.green >> 3;   /* 6 - 3  = 3*/
+    ret.green = LV_COLOR_GET_G16(color) >> 3;   /* 6 - 3  = 3*/
     ret.blue = color.blue >> 3;     /* 5 - 2  = 3*/
     return ret.full;
 #elif LV_COLOR_DEPTH == 24
@@ -207,8 +232,10 @@ static inline uint16_t lv_color_to16(lv_color_t color)
     ret.green = color.green * 9;   /*(2^6 - 1)/(2^3 - 1) = 63/7 = 9*/
     ret.blue = color.blue * 10;    /*(2^5 - 1)/(2^2 - 1) = 31/3 = 10*/
     return ret.full;
-#elif LV_COLOR_DEPTH == 16
+#elif LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
     return color.full;
+#elif LV_COLOR_DEPTH == 16
+    return (uint16_t)(color.full >> 8 | color.full << 8);   /*Back to plain RGB565*/
 #elif LV_COLOR_DEPTH == 24
     lv_color16_t ret;
     ret.red = color.red >> 3;       /* 8 - 5  = 3*/
@@ -233,7 +260,7 @@ static inline uint32_t lv_color_to24(lv_color_t color)
 #elif LV_COLOR_DEPTH == 16
     lv_color24_t ret;
     ret.red = color.red * 8;       /*(2^8 - 1)/(2^5 - 1) = 255/31 = 8*/
-    ret.green = color.green * 4;   /*(2^8 - 1)/(2^6 - 1) = 255/63 = 4*/
+    ret.green = LV_COLOR_GET_G16(color) * 4;   /*(2^8 - 1)/(2^6 - 1) = 255/63 = 4*/
     ret.blue = color.blue * 8;     /*(2^8 - 1)/(2^5 - 1) = 255/31 = 8*/
     ret.alpha = 0xFF;
     return ret.full;
@@ -245,7 +272,11 @@ static inline uint32_t lv_color_to24(lv_color_t color)
 static inline lv_color_t lv_color_mix(lv_color_t c1, lv_color_t c2, uint8_t mix)
 {
     lv_color_t ret;
-#if LV_COLOR_DEPTH != 1
+#if LV_COLOR_DEPTH == 16
+    ret.red =   (uint16_t)((uint16_t) c1.red * mix + (c2.red * (255 - mix))) >> 8;
+    LV_COLOR_SET_G16(ret, (uint16_t)((uint16_t) LV_COLOR_GET_G16(c1) * mix + (LV_COLOR_GET_G16(c2) * (255 - mix))) >> 8);
+    ret.blue =  (uint16_t)((uint16_t) c1.blue * mix + (c2.blue * (255 - mix))) >> 8;
+#elif LV_COLOR_DEPTH != 1
     ret.red =   (uint16_t)((uint16_t) c1.red * mix + (c2.red * (255 - mix))) >> 8;
     ret.green = (uint16_t)((uint16_t) c1.green * mix + (c2.green * (255 - mix))) >> 8;
     ret.blue =  (uint16_t)((uint16_t) c1.blue * mix + (c2.blue * (255 - mix))) >> 8;
@@ -276,23 +307,25 @@ static inline uint8_t lv_color_brightness(lv_color_t color)
  * The order of bit field is different on Big-endian and Little-endian machines*/
 #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 #if LV_COLOR_DEPTH == 1
-#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){(b8 >> 7 | g8 >> 7 | r8 >> 7)})
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){((b8) >> 7 | (g8) >> 7 | (r8) >> 7)})
 #elif LV_COLOR_DEPTH == 8
-#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{b8 >> 6, g8 >> 5, r8 >> 5}})
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{(b8) >> 6, (g8) >> 5, (r8) >> 5}})
+#elif LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{(b8) >> 3, (g8) >> 2, (r8) >> 3}})
 #elif LV_COLOR_DEPTH == 16
-#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{b8 >> 3, g8 >> 2, r8 >> 3}})
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{(g8) >> 5, (r8) >> 3, (b8) >> 3, ((g8) >> 2) & 0x7}})
 #elif LV_COLOR_DEPTH == 24
-#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{b8, g8, r8, 0xff}})            /*Fix 0xff alpha*/
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{(b8), (g8), (r8), 0xff}})            /*Fix 0xff alpha*/
 #endif
 #else
 #if LV_COLOR_DEPTH == 1
-#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){(r8 >> 7 | g8 >> 7 | b8 >> 7)})
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){((r8) >> 7 | (g8) >> 7 | (b8) >> 7)})
 #elif LV_COLOR_DEPTH == 8
-#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{r8 >> 6, g8 >> 5, b8 >> 5}})
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{(r8) >> 6, (g8) >> 5, (b8) >> 5}})
 #elif LV_COLOR_DEPTH == 16
-#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{r8 >> 3, g8 >> 2, b8 >> 3}})
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{(r8) >> 3, (g8) >> 2, (b8) >> 3}})
 #elif LV_COLOR_DEPTH == 24
-#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{0xff, r8, g8, b8}})            /*Fix 0xff alpha*/
+#define LV_COLOR_MAKE(r8, g8, b8) ((lv_color_t){{0xff, (r8), (g8), (b8)}})            /*Fix 0xff alpha*/
 #endif
 #endif
 
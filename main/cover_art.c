@@ -0,0 +1,360 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys/stat.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "i2s_dac.h"
+#include "id3_tag.h"
+#include "picojpeg.h"
+#include "jpeg_blit.h"
+#include "cover_art.h"
+#include "ui_event.h"
+#include "fnv1a.h"
+
+//thumbnails are the pixels as they are in memory
+#if LV_COLOR_16_SWAP
+  #define COVER_FORMAT LV_IMG_FORMAT_FILE_RAW_RGB565_SWAP
+#else
+  #define COVER_FORMAT LV_IMG_FORMAT_FILE_RAW_RGB565
+#endif
+
+#ifndef min
+  #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+  #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/* the picture's bytes from the file, unsynchronisation undone */
+typedef struct {
+  FILE *file;
+  uint32_t left; //not read from the file yet
+  bool unsync, ff;
+  int pos, len;
+  uint8_t buf[COVER_READ_BYTES];
+} coverStream_t;
+
+/* sums of the source pixels that fall into each cover pixel. the source is
+ * cut to its centred square of side pixels starting at x0, y0. first and
+ * last are the cover rows or columns a source row or column adds to, more
+ * than one only when the source is smaller than the cover */
+typedef struct {
+  uint32_t *acc; //r, g, b
+  int x0, y0, side;
+  uint8_t *first, *last;
+} coverFilter_t;
+
+static const char *TAG = "COVER";
+
+static SemaphoreHandle_t coverLock;
+static TaskHandle_t coverTask = NULL;
+static char pending[MUSICDB_FN_LEN];
+//two buffers so that the one on screen is never written
+static lv_color_t *pixels[2];
+static lv_img_t images[2];
+static int shown = -1;
+static bool handover;
+static const lv_img_t *readyImg;
+
+static unsigned char stream_read(unsigned char *pBuf, unsigned char size,
+                                 unsigned char *pBytes_actually_read, void *pCallback_data) {
+  coverStream_t *s = pCallback_data;
+  int n = 0;
+  while(n < size) {
+    if(s->pos == s->len) {
+      if(s->left == 0) break;
+      s->len = fread(s->buf, 1, min(s->left, sizeof(s->buf)), s->file);
+      s->pos = 0;
+      if(s->len <= 0) {
+        s->len = s->left = 0;
+        break;
+      }
+      s->left -= s->len;
+    }
+    uint8_t c = s->buf[s->pos++];
+    if(s->unsync == true && s->ff == true && c == 0) {
+      s->ff = false;
+      continue;
+    }
+    s->ff = c == 0xFF;
+    pBuf[n++] = c;
+  }
+  *pBytes_actually_read = n;
+  return 0;
+}
+
+static esp_err_t filter_init(coverFilter_t *f, int width, int height) {
+  f->side = min(width, height);
+  f->x0 = (width - f->side) / 2;
+  f->y0 = (height - f->side) / 2;
+  f->acc = heap_caps_calloc(COVER_PIXELS * 3, sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+  f->first = heap_caps_malloc(f->side * 2, MALLOC_CAP_SPIRAM);
+  if(f->acc == NULL || f->first == NULL) {
+    free(f->acc);
+    free(f->first);
+    return ESP_ERR_NO_MEM;
+  }
+  f->last = f->first + f->side;
+  memset(f->first, COVER_SIZE - 1, f->side);
+  memset(f->last, 0, f->side);
+  for(int o = 0; o < COVER_SIZE; ++o) {
+    int lo = o * f->side / COVER_SIZE, hi = max((o + 1) * f->side / COVER_SIZE, lo + 1);
+    for(int s = lo; s < hi && s < f->side; ++s) {
+      f->first[s] = min(f->first[s], o);
+      f->last[s] = max(f->last[s], o);
+    }
+  }
+  return ESP_OK;
+}
+
+static inline void filter_add(coverFilter_t *f, int x, int y, uint8_t r, uint8_t g, uint8_t b) {
+  x -= f->x0;
+  y -= f->y0;
+  if(x < 0 || y < 0 || x >= f->side || y >= f->side) return;
+  for(int oy = f->first[y]; oy <= f->last[y]; ++oy) {
+    for(int ox = f->first[x]; ox <= f->last[x]; ++ox) {
+      uint32_t *a = f->acc + (oy * COVER_SIZE + ox) * 3;
+      a[0] += r;
+      a[1] += g;
+      a[2] += b;
+    }
+  }
+}
+
+static void filter_finish(coverFilter_t *f, lv_color_t *dst) {
+  for(int oy = 0; oy < COVER_SIZE; ++oy) {
+    int lo = oy * f->side / COVER_SIZE, hy = max((oy + 1) * f->side / COVER_SIZE, lo + 1) - lo;
+    for(int ox = 0; ox < COVER_SIZE; ++ox) {
+      int lx = ox * f->side / COVER_SIZE, hx = max((ox + 1) * f->side / COVER_SIZE, lx + 1) - lx;
+      uint32_t n = hx * hy, *a = f->acc + (oy * COVER_SIZE + ox) * 3;
+      dst[oy * COVER_SIZE + ox] = LV_COLOR_MAKE(a[0] / n, a[1] / n, a[2] / n);
+    }
+  }
+  free(f->acc);
+  free(f->first);
+}
+
+/* picojpeg's reduce mode only decodes the DC coefficient, one pixel per
+ * 8x8 block, so it is used whenever that still leaves COVER_SIZE pixels */
+static esp_err_t decode_jpeg(FILE *file, const id3Info_t *tags, lv_color_t *dst) {
+  static coverStream_t s;
+  pjpeg_image_info_t info;
+  coverFilter_t f;
+  memset(&s, 0, sizeof(s));
+  s.file = file;
+  s.left = tags->pictureBytes;
+  s.unsync = tags->pictureUnsync;
+  fseek(file, tags->pictureOffset, SEEK_SET);
+  unsigned char status = pjpeg_decode_init(&info, stream_read, &s, 0);
+  if(status != 0) {
+    ESP_LOGE(TAG, "Not a baseline JPEG (%d)", status);
+    return ESP_ERR_NOT_SUPPORTED;
+  }
+  bool reduce = min(info.m_width, info.m_height) >= COVER_SIZE * 8;
+  if(reduce == true) { //again from the start
+    memset(&s, 0, sizeof(s));
+    s.file = file;
+    s.left = tags->pictureBytes;
+    s.unsync = tags->pictureUnsync;
+    fseek(file, tags->pictureOffset, SEEK_SET);
+    if(pjpeg_decode_init(&info, stream_read, &s, 1) != 0) return ESP_ERR_NOT_SUPPORTED;
+  }
+  int scale = reduce ? 8 : 1;
+  int width = (info.m_width + scale - 1) / scale, height = (info.m_height + scale - 1) / scale;
+  //a square that already has the cover's size goes straight into it
+  bool direct = min(width, height) == COVER_SIZE;
+  jpegBlit_t blit = {(uint16_t *)dst, COVER_SIZE, COVER_SIZE, COVER_SIZE, (width - COVER_SIZE) / 2,
+                     (height - COVER_SIZE) / 2, JPEG_BLIT_DITHER | (reduce ? JPEG_BLIT_REDUCED : 0)
+                     | (LV_COLOR_16_SWAP ? JPEG_BLIT_SWAP : 0)};
+  if(direct == false && filter_init(&f, width, height) != ESP_OK) return ESP_ERR_NO_MEM;
+  //blocks are 64 bytes each, side by side at +64 and one below the other at +128
+  int bw = info.m_MCUWidth / 8, bh = info.m_MCUHeight / 8;
+  uint8_t *cg = info.m_scanType == PJPG_GRAYSCALE ? info.m_pMCUBufR : info.m_pMCUBufG;
+  uint8_t *cb = info.m_scanType == PJPG_GRAYSCALE ? info.m_pMCUBufR : info.m_pMCUBufB;
+  for(int my = 0; my < info.m_MCUSPerCol && status == 0; ++my) {
+    for(int mx = 0; mx < info.m_MCUSPerRow; ++mx) {
+      status = pjpeg_decode_mcu();
+      if(status != 0) break;
+      if(direct == true) {
+        jpeg_blit_mcu(&info, mx, my, &blit);
+        continue;
+      }
+      if(reduce == true) {
+        for(int by = 0; by < bh; ++by) {
+          for(int bx = 0; bx < bw; ++bx) {
+            int i = by * 128 + bx * 64;
+            filter_add(&f, mx * bw + bx, my * bh + by, info.m_pMCUBufR[i], cg[i], cb[i]);
+          }
+        }
+        continue;
+      }
+      int x = mx * info.m_MCUWidth, y = my * info.m_MCUHeight;
+      int w = min(info.m_MCUWidth, width - x), h = min(info.m_MCUHeight, height - y);
+      for(int py = 0; py < h; ++py) {
+        for(int px = 0; px < w; ++px) {
+          int i = (py >> 3) * 128 + (px >> 3) * 64 + (py & 7) * 8 + (px & 7);
+          filter_add(&f, x + px, y + py, info.m_pMCUBufR[i], cg[i], cb[i]);
+        }
+      }
+    }
+  }
+  if(direct == false) filter_finish(&f, dst);
+  if(status != 0 && status != PJPG_NO_MORE_BLOCKS) {
+    ESP_LOGE(TAG, "JPEG decode error %d", status);
+    return ESP_FAIL;
+  }
+  ESP_LOGI(TAG, "%dx%d cover%s", info.m_width, info.m_height, reduce ? ", reduced" : "");
+  return ESP_OK;
+}
+
+/* pictures are named after their size and first bytes, so the tracks of an
+ * album share one thumbnail */
+static uint32_t cover_key(FILE *file, const id3Info_t *tags) {
+  uint8_t buf[COVER_KEY_BYTES];
+  fseek(file, tags->pictureOffset, SEEK_SET);
+  size_t n = fread(buf, 1, min(tags->pictureBytes, sizeof(buf)), file);
+  return fnv1a(FNV1A_INIT ^ tags->pictureBytes, buf, n);
+}
+
+static esp_err_t cache_read(const char *path, lv_color_t *dst) {
+  lv_img_t hdr;
+  FILE *f = fopen(path, "rb");
+  if(f == NULL) return ESP_ERR_NOT_FOUND;
+  esp_err_t ret = ESP_FAIL;
+  if(fread(&hdr.header, sizeof(hdr.header), 1, f) == 1) {
+    if(hdr.header.w == 0) ret = ESP_ERR_NOT_SUPPORTED;
+    else if(hdr.header.format == COVER_FORMAT && hdr.header.w == COVER_SIZE
+        && hdr.header.h == COVER_SIZE && fread(dst, sizeof(lv_color_t), COVER_PIXELS, f) == COVER_PIXELS)
+      ret = ESP_OK;
+  }
+  fclose(f);
+  if(ret == ESP_FAIL) {
+    ESP_LOGE(TAG, "Bad thumbnail %s", path);
+    remove(path);
+    ret = ESP_ERR_NOT_FOUND;
+  }
+  return ret;
+}
+
+/* pixels NULL writes the marker of a cover that can't be decoded */
+static void cache_write(const char *path, const lv_color_t *pixels) {
+  lv_img_t hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.header.format = COVER_FORMAT;
+  hdr.header.w = pixels != NULL ? COVER_SIZE : 0;
+  hdr.header.h = pixels != NULL ? COVER_SIZE : 0;
+  FILE *f = fopen(COVER_TMP_PATH, "wb");
+  if(f == NULL) {
+    ESP_LOGE(TAG, "Unable to write %s", COVER_TMP_PATH);
+    return;
+  }
+  bool ok = fwrite(&hdr.header, sizeof(hdr.header), 1, f) == 1
+    && (pixels == NULL || fwrite(pixels, sizeof(lv_color_t), COVER_PIXELS, f) == COVER_PIXELS);
+  ok &= fclose(f) == 0;
+  //FAT doesn't rename over an existing file
+  remove(path);
+  if(ok == false || rename(COVER_TMP_PATH, path) != 0) {
+    ESP_LOGE(TAG, "Unable to save %s", path);
+    remove(COVER_TMP_PATH);
+  }
+}
+
+/* the thumbnail of the picture in fileName's tag, decoded once and then
+ * read from COVER_DIR */
+static esp_err_t cover_load(const char *fileName, lv_color_t *dst) {
+  static id3Info_t tags; //only the cover task gets here
+  char path[sizeof(COVER_DIR) + 16];
+  FILE *file = fopen(fileName, "rb");
+  if(file == NULL) return ESP_ERR_NOT_FOUND;
+  if(id3_parse_file(file, &tags) != 0 || tags.pictureOffset == 0) {
+    fclose(file);
+    return ESP_ERR_NOT_FOUND;
+  }
+  sprintf(path, COVER_DIR "/%08x.img", cover_key(file, &tags));
+  esp_err_t ret = cache_read(path, dst);
+  if(ret == ESP_ERR_NOT_FOUND) {
+    if(strstr(tags.pictureMime, "png") != NULL || strstr(tags.pictureMime, "PNG") != NULL) {
+      ret = ESP_ERR_NOT_SUPPORTED;
+    } else {
+      int64_t start = esp_timer_get_time();
+      ret = decode_jpeg(file, &tags, dst);
+      ESP_LOGI(TAG, "%s decoded in %d ms", path, (int)((esp_timer_get_time() - start) / 1000));
+      if(ret != ESP_ERR_NO_MEM) cache_write(path, ret == ESP_OK ? dst : NULL);
+    }
+  }
+  fclose(file);
+  return ret;
+}
+
+esp_err_t cover_init(void) {
+  for(int i = 0; i < 2; ++i) {
+    pixels[i] = heap_caps_malloc(COVER_PIXELS * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+    if(pixels[i] == NULL) return ESP_ERR_NO_MEM;
+    images[i].header.format = LV_IMG_FORMAT_INTERNAL_RAW;
+    images[i].header.w = COVER_SIZE;
+    images[i].header.h = COVER_SIZE;
+    images[i].pixel_map = (const uint8_t *)pixels[i];
+  }
+  coverLock = xSemaphoreCreateMutex();
+  if(coverLock == NULL) return ESP_ERR_NO_MEM;
+  mkdir(COVER_DIR, 0775);
+  if(xTaskCreatePinnedToCore(taskCover,"COVER",4000,NULL,(portPRIVILEGE_BIT | 1),&coverTask,0) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create cover task.");
+    coverTask = NULL;
+    return ESP_FAIL;
+  }
+  return ESP_OK;
+}
+
+/* the cover of fileName turns up in cover_poll(), a newer request replaces
+ * one that wasn't started yet */
+void cover_request(const char *fileName) {
+  if(coverTask == NULL) return;
+  xSemaphoreTake(coverLock, portMAX_DELAY);
+  strncpy(pending, fileName, MUSICDB_FN_LEN - 1);
+  handover = false;
+  xSemaphoreGive(coverLock);
+  xTaskNotifyGive(coverTask);
+}
+
+/* true once per request with the cover to show, NULL for the default one */
+bool cover_poll(const lv_img_t **img) {
+  bool ret = false;
+  if(coverTask == NULL) return false;
+  xSemaphoreTake(coverLock, portMAX_DELAY);
+  if(handover == true) {
+    *img = readyImg;
+    shown = readyImg == NULL ? -1 : readyImg - images;
+    handover = false;
+    ret = true;
+  }
+  xSemaphoreGive(coverLock);
+  return ret;
+}
+
+void taskCover(void *parameter) {
+  char fileName[MUSICDB_FN_LEN];
+  while(1) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    xSemaphoreTake(coverLock, portMAX_DELAY);
+    strcpy(fileName, pending);
+    int target = shown == 0 ? 1 : 0;
+    xSemaphoreGive(coverLock);
+    esp_err_t ret = cover_load(fileName, pixels[target]);
+    xSemaphoreTake(coverLock, portMAX_DELAY);
+    //a request that came in meanwhile is worked on next
+    bool ready = strcmp(fileName, pending) == 0;
+    if(ready) {
+      readyImg = ret == ESP_OK ? &images[target] : NULL;
+      handover = true;
+    }
+    xSemaphoreGive(coverLock);
+    if(ready) ui_post(UI_EVENT_COVER, ret == ESP_OK);
+  }
+}
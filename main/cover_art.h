@@ -0,0 +1,22 @@
+#ifndef _COVER_ART_H_
+#define _COVER_ART_H_
+
+#include "esp_err.h"
+#include "../lvgl/lvgl.h"
+
+#define COVER_DIR "/sdcard/.covers"
+#define COVER_TMP_PATH COVER_DIR "/cover.tmp"
+#define COVER_SIZE 128
+#define COVER_PIXELS (COVER_SIZE * COVER_SIZE)
+#define COVER_KEY_BYTES 512 //of the image hashed into its cache name
+#define COVER_READ_BYTES 512
+
+/* covers are cut to the centred square, box filtered to COVER_SIZE and
+ * cached in COVER_DIR as LVGL raw RGB565 image files in lv_color_t's byte
+ * order: the lv_img_t header word, then the pixels. a header with no size
+ * marks a picture that can't be decoded, so that it isn't tried again */
+esp_err_t cover_init(void);
+void cover_request(const char *fileName);
+bool cover_poll(const lv_img_t **img);
+void taskCover(void *parameter);
+#endif
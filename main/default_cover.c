@@ -136,7 +136,7 @@ static const uint8_t default_cover_pixel_map[] = {
   0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 
   0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 
 
-#elif LV_COLOR_DEPTH == 16
+#elif LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
 /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
 
   0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 
@@ -268,6 +268,138 @@ static const uint8_t default_cover_pixel_map[] = {
   0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 
   0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 
 
+#elif LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
+/*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
+
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x4a, 0x28, 0x52, 0x49, 0x52, 0x69, 0x5a, 0x8a, 0x62, 0xaa, 0x6a, 0xca, 0x72, 0xeb, 0x7b, 0x0b, 0x7b, 0x2c, 0x83, 0x4c, 0x83, 0x4c, 0x7b, 0x4c, 0x7b, 0x2b, 0x73, 0x0b, 0x6a, 0xca, 0x62, 0xaa, 0x5a, 0x8a, 0x52, 0x69, 0x52, 0x49, 0x4a, 0x48, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x4a, 0x08, 0x4a, 0x08, 0x5a, 0x28, 0x62, 0x69, 0x62, 0x89, 0x6a, 0x89, 0x6a, 0xaa, 0x72, 0xca, 0x72, 0xea, 0x72, 0xeb, 0x7b, 0x0b, 0x7b, 0x0b, 0x7b, 0x0b, 0x7b, 0x2c, 0x7b, 0x2c, 0x7b, 0x2b, 0x73, 0x0b, 0x73, 0x0b, 0x72, 0xeb, 0x6a, 0xca, 0x6a, 0xca, 0x62, 0xaa, 0x62, 0x89, 0x5a, 0x69, 0x52, 0x48, 0x52, 0x28, 0x42, 0x08, 0x41, 0xe7, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x41, 0xc7, 0x41, 0xc7, 0x51, 0xe7, 0x5a, 0x08, 0x5a, 0x08, 0x5a, 0x28, 0x62, 0x48, 0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 0x62, 0x89, 0x62, 0x89, 0x6a, 0xaa, 0x6a, 0xaa, 0x6a, 0xaa, 0x6a, 0xca, 0x6a, 0xca, 0x6a, 0xcb, 0x6a, 0xca, 0x6a, 0xaa, 0x62, 0xaa, 0x62, 0xaa, 0x62, 0x89, 0x62, 0x69, 0x5a, 0x69, 0x5a, 0x49, 0x52, 0x48, 0x52, 0x28, 0x52, 0x28, 0x4a, 0x07, 0x49, 0xe7, 0x41, 0xc7, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xc7, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x39, 0xa6, 0x39, 0x65, 0x49, 0x86, 0x49, 0xa6, 0x49, 0xc6, 0x49, 0xc7, 0x51, 0xe7, 0x51, 0xe7, 0x52, 0x07, 0x52, 0x07, 0x52, 0x08, 0x52, 0x28, 0x5a, 0x28, 0x5a, 0x48, 0x5a, 0x48, 0x5a, 0x69, 0x62, 0x69, 0x62, 0x89, 0x62, 0xa9, 0x62, 0xaa, 0x6a, 0xaa, 0x62, 0xaa, 0x62, 0x89, 0x5a, 0x69, 0x5a, 0x69, 0x5a, 0x48, 0x52, 0x28, 0x52, 0x28, 0x52, 0x08, 0x4a, 0x07, 0x49, 0xe7, 0x49, 0xe7, 0x41, 0xc7, 0x41, 0xc7, 0x41, 0xa6, 0x39, 0xa6, 0x39, 0x85, 0x39, 0x65, 0x31, 0x45, 0x29, 0x45, 0x31, 0x86, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x31, 0x45, 0x39, 0x44, 0x39, 0x45, 0x41, 0x65, 0x41, 0x85, 0x41, 0x86, 0x41, 0x86, 0x41, 0xa6, 0x49, 0xa6, 0x49, 0xa6, 0x49, 0xc6, 0x49, 0xe7, 0x51, 0xe7, 0x52, 0x08, 0x5a, 0x28, 0x5a, 0x48, 0x5a, 0x48, 0x5a, 0x69, 0x62, 0x69, 0x62, 0x89, 0x62, 0x89, 0x62, 0xaa, 0x62, 0xaa, 0x62, 0x8a, 0x62, 0x89, 0x62, 0x69, 0x5a, 0x49, 0x5a, 0x48, 0x52, 0x28, 0x52, 0x28, 0x4a, 0x07, 0x49, 0xe7, 0x41, 0xc7, 0x41, 0xa6, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x45, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0x25, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xa6, 0x31, 0x04, 0x31, 0x04, 0x31, 0x04, 0x39, 0x24, 0x39, 0x24, 0x39, 0x45, 0x39, 0x45, 0x39, 0x65, 0x39, 0x65, 0x41, 0x85, 0x41, 0xa6, 0x49, 0xa6, 0x49, 0xc6, 0x49, 0xe7, 0x51, 0xe7, 0x52, 0x07, 0x52, 0x28, 0x5a, 0x48, 0x5a, 0x49, 0x5a, 0x69, 0x62, 0x69, 0x62, 0x69, 0x62, 0x89, 0x62, 0x8a, 0x62, 0xaa, 0x62, 0x89, 0x5a, 0x89, 0x5a, 0x69, 0x5a, 0x69, 0x52, 0x48, 0x52, 0x28, 0x52, 0x08, 0x4a, 0x07, 0x49, 0xe7, 0x41, 0xc7, 0x41, 0xa6, 0x39, 0x86, 0x39, 0x65, 0x31, 0x65, 0x31, 0x45, 0x29, 0x45, 0x29, 0x25, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x04, 0x21, 0x04, 0x20, 0xe3, 0x21, 0x04, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x31, 0x66, 0x28, 0xc3, 0x28, 0xc3, 0x30, 0xe3, 0x30, 0xe3, 0x30, 0xe4, 0x31, 0x04, 0x31, 0x04, 0x31, 0x24, 0x39, 0x24, 0x39, 0x45, 0x39, 0x65, 0x41, 0x65, 0x41, 0x86, 0x41, 0xa6, 0x49, 0xa6, 0x49, 0xc7, 0x49, 0xe7, 0x52, 0x07, 0x52, 0x28, 0x5a, 0x48, 0x5a, 0x69, 0x5a, 0x69, 0x62, 0x89, 0x62, 0x89, 0x62, 0xa9, 0x62, 0xaa, 0x62, 0xca, 0x62, 0xaa, 0x62, 0x89, 0x5a, 0x89, 0x5a, 0x69, 0x52, 0x48, 0x52, 0x48, 0x4a, 0x28, 0x4a, 0x07, 0x41, 0xe7, 0x41, 0xc7, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x65, 0x31, 0x65, 0x31, 0x45, 0x29, 0x24, 0x29, 0x24, 0x29, 0x04, 0x21, 0x04, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x20, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xa6, 0x20, 0xa2, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa3, 0x28, 0xc3, 0x28, 0xc3, 0x28, 0xe3, 0x28, 0xe3, 0x31, 0x04, 0x31, 0x04, 0x31, 0x24, 0x39, 0x45, 0x39, 0x65, 0x39, 0x65, 0x41, 0x86, 0x49, 0xa6, 0x49, 0xc6, 0x49, 0xe7, 0x4a, 0x07, 0x52, 0x08, 0x52, 0x28, 0x52, 0x48, 0x5a, 0x48, 0x5a, 0x69, 0x5a, 0x69, 0x5a, 0x69, 0x62, 0x89, 0x62, 0xaa, 0x62, 0xaa, 0x62, 0x89, 0x5a, 0x89, 0x5a, 0x69, 0x5a, 0x68, 0x52, 0x48, 0x52, 0x28, 0x4a, 0x28, 0x4a, 0x07, 0x41, 0xe7, 0x41, 0xc7, 0x41, 0xa6, 0x39, 0x86, 0x39, 0x85, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x29, 0x24, 0x29, 0x04, 0x21, 0x04, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x20, 0xe3, 0x20, 0x82, 0x20, 0x82, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xa2, 0x28, 0xa3, 0x28, 0xc3, 0x28, 0xe3, 0x31, 0x04, 0x31, 0x04, 0x31, 0x24, 0x31, 0x24, 0x39, 0x65, 0x39, 0x85, 0x41, 0x86, 0x41, 0xa6, 0x49, 0xc6, 0x49, 0xc7, 0x49, 0xe7, 0x4a, 0x07, 0x52, 0x07, 0x52, 0x28, 0x52, 0x28, 0x5a, 0x48, 0x5a, 0x48, 0x5a, 0x69, 0x5a, 0x69, 0x62, 0x89, 0x62, 0x89, 0x5a, 0x69, 0x5a, 0x69, 0x5a, 0x49, 0x52, 0x48, 0x52, 0x28, 0x4a, 0x28, 0x4a, 0x07, 0x49, 0xe7, 0x41, 0xc7, 0x41, 0xa6, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x85, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x29, 0x24, 0x21, 0x04, 0x21, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x21, 0x24, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x29, 0x24, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x20, 0x82, 0x20, 0x82, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xa3, 0x28, 0xc3, 0x28, 0xc3, 0x28, 0xe3, 0x31, 0x04, 0x31, 0x24, 0x39, 0x24, 0x39, 0x45, 0x39, 0x65, 0x39, 0x85, 0x41, 0x86, 0x41, 0xa6, 0x41, 0xc6, 0x49, 0xe7, 0x49, 0xe7, 0x52, 0x07, 0x52, 0x08, 0x5a, 0x28, 0x5a, 0x48, 0x5a, 0x68, 0x5a, 0x69, 0x62, 0x89, 0x62, 0x89, 0x62, 0x89, 0x62, 0x89, 0x5a, 0x89, 0x5a, 0x69, 0x52, 0x48, 0x52, 0x28, 0x4a, 0x07, 0x4a, 0x07, 0x41, 0xe7, 0x41, 0xc6, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x85, 0x31, 0x65, 0x31, 0x45, 0x29, 0x44, 0x29, 0x24, 0x29, 0x24, 0x21, 0x24, 0x21, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xc3, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x18, 0x82, 0x18, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x20, 0x82, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x28, 0xc3, 0x28, 0xc3, 0x28, 0xe3, 0x31, 0x04, 0x31, 0x04, 0x31, 0x24, 0x31, 0x24, 0x39, 0x45, 0x39, 0x65, 0x41, 0x85, 0x41, 0xa6, 0x49, 0xa6, 0x49, 0xc6, 0x51, 0xe7, 0x52, 0x07, 0x52, 0x28, 0x5a, 0x48, 0x5a, 0x69, 0x62, 0x89, 0x62, 0xa9, 0x62, 0xa9, 0x6a, 0xca, 0x6a, 0xca, 0x62, 0xa9, 0x62, 0xa9, 0x5a, 0x89, 0x5a, 0x69, 0x52, 0x48, 0x52, 0x28, 0x4a, 0x07, 0x49, 0xe7, 0x41, 0xc6, 0x39, 0xa6, 0x39, 0x86, 0x31, 0x65, 0x31, 0x65, 0x29, 0x44, 0x29, 0x44, 0x29, 0x24, 0x29, 0x04, 0x21, 0x04, 0x21, 0x03, 0x20, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xc3, 0x19, 0x04, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x45, 0x10, 0x41, 0x10, 0x21, 0x10, 0x41, 0x18, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xc3, 0x28, 0xc3, 0x28, 0xe3, 0x28, 0xe3, 0x31, 0x04, 0x31, 0x24, 0x31, 0x24, 0x39, 0x44, 0x39, 0x65, 0x41, 0x86, 0x41, 0xa6, 0x49, 0xc6, 0x49, 0xe7, 0x52, 0x07, 0x5a, 0x28, 0x5a, 0x48, 0x5a, 0x68, 0x5a, 0x69, 0x62, 0x89, 0x62, 0x89, 0x62, 0xa9, 0x62, 0xca, 0x6a, 0xca, 0x62, 0xa9, 0x62, 0x89, 0x5a, 0x89, 0x5a, 0x69, 0x5a, 0x68, 0x52, 0x48, 0x52, 0x28, 0x4a, 0x07, 0x41, 0xe7, 0x41, 0xc6, 0x39, 0xa6, 0x39, 0x85, 0x31, 0x65, 0x29, 0x44, 0x29, 0x24, 0x29, 0x24, 0x21, 0x04, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x10, 0xa2, 0x18, 0xa3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x20, 0xe3, 0x18, 0xe3, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x20, 0xe3, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xc2, 0x28, 0xc3, 0x28, 0xc3, 0x28, 0xe3, 0x31, 0x04, 0x31, 0x24, 0x31, 0x44, 0x39, 0x45, 0x41, 0x65, 0x41, 0xa6, 0x49, 0xc6, 0x49, 0xc6, 0x49, 0xe7, 0x52, 0x07, 0x52, 0x07, 0x52, 0x27, 0x52, 0x48, 0x52, 0x48, 0x5a, 0x68, 0x5a, 0x88, 0x5a, 0x89, 0x5a, 0xa9, 0x62, 0xa9, 0x5a, 0x89, 0x5a, 0x89, 0x52, 0x68, 0x52, 0x48, 0x52, 0x48, 0x4a, 0x27, 0x4a, 0x07, 0x49, 0xe7, 0x41, 0xe6, 0x41, 0xc6, 0x39, 0xa6, 0x39, 0x85, 0x31, 0x65, 0x29, 0x44, 0x29, 0x44, 0x29, 0x24, 0x21, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa3, 0x18, 0xa3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x20, 0xe4, 0x18, 0xe4, 0x29, 0x65, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x10, 0x61, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xc3, 0x28, 0xc3, 0x28, 0xe3, 0x31, 0x03, 0x31, 0x24, 0x39, 0x44, 0x39, 0x65, 0x41, 0x65, 0x41, 0x85, 0x41, 0xa5, 0x41, 0xc6, 0x49, 0xc6, 0x49, 0xe6, 0x4a, 0x07, 0x4a, 0x07, 0x52, 0x28, 0x52, 0x48, 0x52, 0x68, 0x52, 0x68, 0x5a, 0x89, 0x5a, 0xa9, 0x5a, 0xa9, 0x5a, 0x89, 0x52, 0x69, 0x52, 0x68, 0x52, 0x48, 0x4a, 0x28, 0x4a, 0x07, 0x42, 0x07, 0x41, 0xe6, 0x39, 0xc6, 0x39, 0xa6, 0x39, 0x85, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x29, 0x44, 0x29, 0x24, 0x21, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa3, 0x18, 0xc3, 0x10, 0xa2, 0x18, 0xc3, 0x18, 0xa3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x20, 0xe4, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x10, 0x41, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x20, 0x82, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xc2, 0x28, 0xc3, 0x28, 0xe3, 0x31, 0x03, 0x31, 0x24, 0x31, 0x24, 0x39, 0x44, 0x39, 0x65, 0x39, 0x65, 0x39, 0x85, 0x41, 0xa6, 0x41, 0xc6, 0x41, 0xe6, 0x49, 0xe7, 0x4a, 0x07, 0x52, 0x27, 0x52, 0x28, 0x52, 0x48, 0x52, 0x68, 0x5a, 0x69, 0x5a, 0x89, 0x5a, 0x89, 0x5a, 0x89, 0x52, 0x68, 0x52, 0x48, 0x4a, 0x48, 0x4a, 0x27, 0x4a, 0x07, 0x42, 0x06, 0x41, 0xe7, 0x39, 0xc6, 0x39, 0xa5, 0x31, 0x85, 0x31, 0x65, 0x29, 0x65, 0x29, 0x44, 0x29, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa3, 0x18, 0xa3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x20, 0xe3, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x21, 0x45, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xc2, 0x28, 0xe3, 0x28, 0xe3, 0x28, 0xe3, 0x31, 0x03, 0x31, 0x24, 0x31, 0x44, 0x31, 0x65, 0x39, 0x65, 0x39, 0x85, 0x39, 0xa6, 0x41, 0xc6, 0x41, 0xc6, 0x49, 0xe7, 0x49, 0xe7, 0x4a, 0x07, 0x4a, 0x28, 0x52, 0x48, 0x52, 0x68, 0x52, 0x68, 0x52, 0x89, 0x5a, 0x89, 0x52, 0x68, 0x52, 0x68, 0x52, 0x48, 0x4a, 0x48, 0x4a, 0x07, 0x42, 0x07, 0x41, 0xe6, 0x39, 0xc6, 0x39, 0xa6, 0x31, 0x85, 0x31, 0x85, 0x29, 0x65, 0x29, 0x44, 0x29, 0x24, 0x21, 0x24, 0x21, 0x03, 0x21, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x20, 0xe4, 0x21, 0x04, 0x29, 0x24, 0x29, 0x45, 0x29, 0x45, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x18, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xc2, 0x28, 0xc3, 0x28, 0xe3, 0x28, 0xe3, 0x31, 0x03, 0x31, 0x24, 0x31, 0x44, 0x31, 0x65, 0x39, 0x65, 0x39, 0x85, 0x41, 0xa6, 0x41, 0xc6, 0x41, 0xc6, 0x41, 0xe7, 0x4a, 0x07, 0x4a, 0x07, 0x4a, 0x27, 0x4a, 0x27, 0x4a, 0x48, 0x4a, 0x48, 0x4a, 0x68, 0x4a, 0x48, 0x4a, 0x27, 0x4a, 0x27, 0x42, 0x07, 0x42, 0x07, 0x41, 0xe6, 0x39, 0xc6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0x85, 0x31, 0x65, 0x29, 0x65, 0x29, 0x44, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa3, 0x18, 0xa3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x20, 0xe3, 0x20, 0xe4, 0x20, 0xe4, 0x21, 0x04, 0x21, 0x24, 0x29, 0x45, 0x29, 0x65, 0x29, 0x65, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x40, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x20, 0x81, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x28, 0xe3, 0x29, 0x03, 0x31, 0x04, 0x31, 0x24, 0x31, 0x44, 0x31, 0x65, 0x39, 0x85, 0x39, 0x85, 0x39, 0xa5, 0x39, 0xa6, 0x41, 0xc6, 0x41, 0xc6, 0x41, 0xe6, 0x41, 0xe6, 0x41, 0xe7, 0x4a, 0x07, 0x4a, 0x27, 0x4a, 0x27, 0x4a, 0x07, 0x41, 0xe7, 0x41, 0xe7, 0x41, 0xe6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xa6, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x29, 0x65, 0x29, 0x44, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x20, 0xe3, 0x20, 0xe4, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x29, 0x45, 0x29, 0x66, 0x31, 0x66, 0x29, 0x66, 0x41, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x40, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x81, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xc2, 0x20, 0xc3, 0x28, 0xe3, 0x29, 0x03, 0x29, 0x04, 0x29, 0x24, 0x31, 0x24, 0x31, 0x44, 0x31, 0x44, 0x31, 0x65, 0x39, 0x85, 0x39, 0xa5, 0x39, 0xc6, 0x41, 0xc6, 0x41, 0xe7, 0x4a, 0x07, 0x4a, 0x07, 0x4a, 0x27, 0x4a, 0x28, 0x4a, 0x28, 0x4a, 0x27, 0x42, 0x27, 0x42, 0x07, 0x41, 0xe7, 0x39, 0xe6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0x65, 0x29, 0x65, 0x29, 0x44, 0x29, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x20, 0xe3, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x29, 0x25, 0x29, 0x65, 0x31, 0x66, 0x31, 0x86, 0x31, 0x86, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x18, 0x20, 0x18, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xc2, 0x20, 0xc3, 0x28, 0xe3, 0x28, 0xe3, 0x29, 0x03, 0x29, 0x04, 0x29, 0x24, 0x31, 0x44, 0x31, 0x65, 0x39, 0x85, 0x39, 0xa5, 0x39, 0xc6, 0x41, 0xe6, 0x41, 0xe7, 0x42, 0x07, 0x42, 0x07, 0x4a, 0x27, 0x4a, 0x48, 0x4a, 0x48, 0x4a, 0x27, 0x42, 0x27, 0x42, 0x07, 0x41, 0xe7, 0x39, 0xe6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0x85, 0x29, 0x65, 0x29, 0x44, 0x21, 0x24, 0x21, 0x03, 0x21, 0x03, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x20, 0xe3, 0x20, 0xe4, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x29, 0x25, 0x29, 0x45, 0x29, 0x45, 0x31, 0x66, 0x31, 0x86, 0x31, 0xa7, 0x31, 0xa7, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x40, 0x10, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xe3, 0x28, 0xe3, 0x29, 0x04, 0x31, 0x24, 0x31, 0x44, 0x31, 0x65, 0x39, 0x85, 0x39, 0xa5, 0x39, 0xa5, 0x39, 0xc6, 0x41, 0xe6, 0x42, 0x06, 0x42, 0x07, 0x4a, 0x27, 0x4a, 0x47, 0x4a, 0x47, 0x4a, 0x27, 0x42, 0x07, 0x41, 0xe6, 0x41, 0xe6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0x85, 0x31, 0x85, 0x29, 0x65, 0x29, 0x44, 0x21, 0x24, 0x21, 0x23, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x40, 0x18, 0x41, 0x18, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc2, 0x20, 0xe3, 0x29, 0x03, 0x29, 0x04, 0x29, 0x24, 0x31, 0x44, 0x31, 0x44, 0x31, 0x65, 0x39, 0x85, 0x39, 0xa5, 0x41, 0xe6, 0x41, 0xe6, 0x41, 0xe6, 0x42, 0x07, 0x4a, 0x27, 0x4a, 0x27, 0x4a, 0x27, 0x42, 0x27, 0x42, 0x07, 0x42, 0x06, 0x41, 0xe6, 0x39, 0xc6, 0x31, 0xc5, 0x31, 0x85, 0x31, 0x65, 0x29, 0x64, 0x29, 0x44, 0x21, 0x24, 0x21, 0x03, 0x19, 0x03, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa2, 0x10, 0xa2, 0x18, 0xa2, 0x10, 0xc2, 0x18, 0xa2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x03, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x29, 0x24, 0x29, 0x45, 0x29, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x66, 0x29, 0x65, 0x31, 0x66, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x18, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x03, 0x29, 0x23, 0x31, 0x44, 0x31, 0x64, 0x31, 0x65, 0x39, 0x85, 0x39, 0xa5, 0x39, 0xc6, 0x41, 0xc6, 0x41, 0xe6, 0x42, 0x07, 0x4a, 0x27, 0x4a, 0x27, 0x4a, 0x47, 0x4a, 0x27, 0x42, 0x07, 0x41, 0xe6, 0x39, 0xc6, 0x39, 0xc6, 0x31, 0xa5, 0x31, 0x85, 0x29, 0x65, 0x29, 0x64, 0x29, 0x44, 0x21, 0x24, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x20, 0xe3, 0x21, 0x03, 0x21, 0x04, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x31, 0x66, 0x31, 0x66, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe8, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x21, 0x10, 0x40, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x03, 0x29, 0x03, 0x29, 0x24, 0x31, 0x44, 0x31, 0x65, 0x39, 0x85, 0x39, 0xa5, 0x41, 0xc6, 0x41, 0xe7, 0x4a, 0x07, 0x4a, 0x27, 0x52, 0x48, 0x52, 0x68, 0x52, 0x68, 0x52, 0x68, 0x4a, 0x47, 0x4a, 0x27, 0x42, 0x07, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0x85, 0x29, 0x65, 0x29, 0x44, 0x21, 0x24, 0x21, 0x03, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc2, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x20, 0xe4, 0x21, 0x04, 0x21, 0x04, 0x29, 0x24, 0x29, 0x44, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0x31, 0x65, 0x31, 0x86, 0x31, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xe8, 0x41, 0xe8, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x03, 0x31, 0x24, 0x31, 0x44, 0x39, 0x85, 0x39, 0xa5, 0x41, 0xc6, 0x49, 0xe6, 0x4a, 0x07, 0x4a, 0x27, 0x52, 0x48, 0x52, 0x48, 0x52, 0x69, 0x5a, 0x69, 0x52, 0x68, 0x52, 0x48, 0x4a, 0x27, 0x4a, 0x27, 0x41, 0xe6, 0x39, 0xc6, 0x39, 0xa5, 0x31, 0x85, 0x29, 0x64, 0x21, 0x24, 0x21, 0x03, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x20, 0xe4, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x29, 0x24, 0x29, 0x44, 0x31, 0x65, 0x31, 0x85, 0x29, 0x65, 0x29, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xe8, 0x39, 0xe8, 0x42, 0x08, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x40, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xa2, 0x20, 0xc2, 0x28, 0xe3, 0x29, 0x04, 0x31, 0x44, 0x39, 0x65, 0x39, 0x85, 0x41, 0xa6, 0x41, 0xc6, 0x49, 0xe7, 0x4a, 0x07, 0x4a, 0x28, 0x52, 0x48, 0x52, 0x48, 0x52, 0x69, 0x52, 0x69, 0x52, 0x68, 0x52, 0x48, 0x4a, 0x28, 0x42, 0x07, 0x41, 0xe7, 0x39, 0xc6, 0x39, 0xa6, 0x31, 0x85, 0x29, 0x65, 0x29, 0x44, 0x21, 0x24, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x29, 0x44, 0x29, 0x65, 0x29, 0x65, 0x31, 0x85, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xc7, 0x41, 0xe8, 0x41, 0xe8, 0x3a, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x21, 0x24, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x40, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x28, 0xe3, 0x31, 0x04, 0x31, 0x44, 0x31, 0x65, 0x39, 0x85, 0x39, 0xa6, 0x41, 0xa6, 0x41, 0xc7, 0x41, 0xe7, 0x4a, 0x07, 0x4a, 0x27, 0x52, 0x48, 0x52, 0x68, 0x52, 0x68, 0x52, 0x48, 0x4a, 0x28, 0x4a, 0x07, 0x41, 0xe7, 0x41, 0xc6, 0x39, 0xc6, 0x31, 0x86, 0x31, 0x65, 0x29, 0x65, 0x29, 0x44, 0x21, 0x24, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe4, 0x21, 0x24, 0x21, 0x24, 0x29, 0x44, 0x29, 0x45, 0x29, 0x65, 0x31, 0x65, 0x31, 0x85, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xa7, 0x31, 0xa6, 0x39, 0xa7, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xc8, 0x39, 0xe8, 0x3a, 0x08, 0x39, 0xe8, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x00, 0x21, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x40, 0x10, 0x40, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x20, 0x82, 0x20, 0xa2, 0x28, 0xc3, 0x28, 0xe3, 0x29, 0x04, 0x31, 0x24, 0x31, 0x44, 0x39, 0x65, 0x39, 0x85, 0x39, 0xa5, 0x41, 0xc6, 0x41, 0xc6, 0x49, 0xe7, 0x4a, 0x07, 0x4a, 0x28, 0x52, 0x48, 0x52, 0x48, 0x4a, 0x28, 0x4a, 0x07, 0x49, 0xe7, 0x41, 0xc7, 0x39, 0xc6, 0x39, 0xa6, 0x31, 0x85, 0x29, 0x65, 0x29, 0x44, 0x29, 0x24, 0x21, 0x04, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x04, 0x21, 0x24, 0x29, 0x45, 0x29, 0x65, 0x29, 0x65, 0x31, 0x85, 0x31, 0x86, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xe8, 0x39, 0xe8, 0x3a, 0x08, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x10, 0xa2, 0x08, 0x41, 0x00, 0x21, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x40, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x28, 0xc3, 0x28, 0xe3, 0x29, 0x04, 0x31, 0x24, 0x31, 0x45, 0x39, 0x65, 0x39, 0x85, 0x39, 0xa6, 0x41, 0xc6, 0x41, 0xe7, 0x49, 0xe7, 0x4a, 0x07, 0x4a, 0x28, 0x52, 0x28, 0x4a, 0x08, 0x4a, 0x07, 0x41, 0xe7, 0x41, 0xc6, 0x39, 0xa6, 0x31, 0x85, 0x31, 0x65, 0x29, 0x44, 0x29, 0x24, 0x21, 0x04, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x29, 0x65, 0x29, 0x65, 0x31, 0x85, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0xa7, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x39, 0xc7, 0x39, 0xe8, 0x3a, 0x08, 0x39, 0xe8, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x28, 0xe3, 0x29, 0x03, 0x29, 0x24, 0x31, 0x24, 0x31, 0x45, 0x39, 0x65, 0x39, 0x85, 0x39, 0x86, 0x39, 0x85, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xc6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0x86, 0x31, 0xa6, 0x31, 0x85, 0x31, 0x65, 0x31, 0x45, 0x29, 0x24, 0x21, 0x04, 0x21, 0x04, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x21, 0x03, 0x21, 0x03, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x29, 0x45, 0x29, 0x65, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xc8, 0x41, 0xe8, 0x3a, 0x08, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x10, 0x82, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x40, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x28, 0xe3, 0x29, 0x03, 0x29, 0x04, 0x29, 0x04, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x44, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x03, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x03, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0x31, 0x86, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xe8, 0x39, 0xe8, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x65, 0x10, 0x82, 0x08, 0x62, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x18, 0x81, 0x20, 0x82, 0x20, 0xa2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc3, 0x20, 0xe3, 0x21, 0x04, 0x29, 0x24, 0x29, 0x24, 0x29, 0x45, 0x29, 0x65, 0x31, 0x65, 0x31, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x44, 0x21, 0x24, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc2, 0x10, 0xa2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x03, 0x21, 0x23, 0x21, 0x24, 0x21, 0x04, 0x21, 0x24, 0x29, 0x44, 0x29, 0x64, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x31, 0x85, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xe7, 0x42, 0x07, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xc7, 0x39, 0xc8, 0x39, 0xe8, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x10, 0xc3, 0x10, 0x82, 0x10, 0x82, 0x08, 0x62, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0x81, 0x10, 0x82, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x19, 0x24, 0x09, 0x25, 0x11, 0x45, 0x11, 0x45, 0x09, 0x25, 0x11, 0x24, 0x19, 0x24, 0x21, 0x24, 0x21, 0x04, 0x20, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x04, 0x21, 0x24, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x31, 0x86, 0x31, 0x85, 0x31, 0x85, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x42, 0x07, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x10, 0xa3, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x08, 0x62, 0x08, 0x62, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x81, 0x18, 0xa2, 0x18, 0xa2, 0x10, 0xc3, 0x00, 0xa3, 0x00, 0xa2, 0x08, 0xc3, 0x21, 0x24, 0x41, 0x65, 0x61, 0x85, 0x61, 0xc6, 0x61, 0xe6, 0x61, 0xa6, 0x49, 0x85, 0x29, 0x24, 0x08, 0xe3, 0x00, 0xa2, 0x00, 0xa2, 0x08, 0xc3, 0x10, 0xa3, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x08, 0x61, 0x10, 0x81, 0x10, 0x82, 0x10, 0xa2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xe3, 0x21, 0x03, 0x21, 0x24, 0x29, 0x24, 0x29, 0x45, 0x31, 0x65, 0x29, 0x85, 0x29, 0x65, 0x29, 0x65, 0x31, 0x85, 0x31, 0x85, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x39, 0xc6, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x41, 0xe7, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xc7, 0x31, 0xc7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x18, 0xe4, 0x18, 0xc3, 0x10, 0xa3, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x08, 0x82, 0x10, 0x82, 0x08, 0x62, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x00, 0x40, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x08, 0x20, 0x10, 0x21, 0x10, 0x41, 0x10, 0x61, 0x18, 0x81, 0x00, 0x41, 0x00, 0x41, 0x10, 0xa2, 0x39, 0x03, 0x79, 0xc5, 0xba, 0x47, 0xe2, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xe8, 0xfa, 0xe8, 0xfa, 0xa8, 0xea, 0xa8, 0xc2, 0x67, 0x89, 0xe6, 0x49, 0x24, 0x10, 0xa2, 0x00, 0x41, 0x00, 0x41, 0x08, 0x82, 0x10, 0x81, 0x10, 0x81, 0x08, 0x61, 0x08, 0x61, 0x10, 0x82, 0x18, 0xc2, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x04, 0x21, 0x24, 0x29, 0x44, 0x29, 0x65, 0x31, 0x85, 0x31, 0xa5, 0x31, 0xa6, 0x31, 0x85, 0x31, 0x85, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x42, 0x08, 0x39, 0xe7, 0x39, 0xc7, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xc7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xa7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x08, 0x82, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x21, 0x10, 0x41, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa2, 0x99, 0xe6, 0xd2, 0x67, 0xfa, 0xc8, 0xfb, 0x09, 0xfb, 0x09, 0xfb, 0x09, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa7, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfb, 0x49, 0xfb, 0x29, 0xfa, 0xe9, 0xe2, 0x87, 0xaa, 0x26, 0x40, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x08, 0x81, 0x10, 0x61, 0x10, 0x61, 0x10, 0x81, 0x10, 0x82, 0x18, 0xc3, 0x21, 0x03, 0x21, 0x24, 0x29, 0x44, 0x29, 0x65, 0x31, 0x85, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xc6, 0x31, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0xc6, 0x31, 0xc6, 0x31, 0xa6, 0x31, 0xc6, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa7, 0x39, 0xc7, 0x31, 0xc7, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x21, 0x45, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa3, 0x10, 0xa3, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0xa2, 0xa2, 0x06, 0xfa, 0xc8, 0xfb, 0x6a, 0xfa, 0xe8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x46, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa7, 0xfa, 0x87, 0xfa, 0x46, 0xfa, 0xa7, 0xfb, 0x09, 0xfb, 0x4a, 0xfb, 0x09, 0xb2, 0x46, 0x49, 0x03, 0x00, 0x00, 0x00, 0x41, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0xa2, 0x18, 0xe3, 0x21, 0x24, 0x29, 0x45, 0x31, 0x65, 0x31, 0x85, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0xc6, 0x31, 0xc6, 0x31, 0xc6, 0x39, 0xc7, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xc7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x29, 0x66, 0x31, 0x86, 0x31, 0xa7, 0x31, 0xc7, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe4, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x08, 0x81, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x44, 0xfa, 0xe9, 0xfb, 0x4a, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0xa8, 0xfb, 0x4a, 0xfb, 0x29, 0x99, 0xc5, 0x10, 0x41, 0x00, 0x20, 0x10, 0xa2, 0x18, 0xa2, 0x18, 0xc2, 0x18, 0xc2, 0x21, 0x03, 0x29, 0x65, 0x31, 0x85, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xc7, 0x39, 0xe7, 0x41, 0xe7, 0x42, 0x07, 0x39, 0xc6, 0x31, 0xc6, 0x39, 0xc6, 0x31, 0xc6, 0x31, 0xc6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x29, 0x66, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0x87, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x21, 0x25, 0x21, 0x24, 0x21, 0x04, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x08, 0x81, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x41, 0xd2, 0x67, 0xfb, 0x4a, 0xfa, 0xe8, 0xfa, 0x87, 0xfa, 0x46, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x66, 0xfa, 0x67, 0xfa, 0xc8, 0xfb, 0x4a, 0xea, 0xa8, 0x40, 0xe3, 0x00, 0x21, 0x10, 0xa2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x21, 0x24, 0x31, 0x85, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xe7, 0x42, 0x07, 0x42, 0x07, 0x39, 0xe7, 0x31, 0xc6, 0x31, 0xc6, 0x39, 0xc6, 0x31, 0xa6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x29, 0x66, 0x29, 0x65, 0x29, 0x66, 0x31, 0x86, 0x31, 0x87, 0x31, 0x87, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x66, 0x29, 0x25, 0x21, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe4, 0x21, 0x04, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x00, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xc2, 0xf2, 0xe8, 0xfb, 0x4a, 0xfa, 0xa8, 0xfa, 0x46, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x66, 0xfa, 0x67, 0xfb, 0x09, 0xfb, 0x29, 0x81, 0x84, 0x00, 0x41, 0x10, 0xc3, 0x21, 0x03, 0x21, 0x03, 0x20, 0xe3, 0x29, 0x65, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xe7, 0x39, 0xe7, 0x42, 0x08, 0x42, 0x07, 0x42, 0x07, 0x39, 0xe6, 0x31, 0xc6, 0x39, 0xc6, 0x31, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc7, 0x31, 0x86, 0x31, 0x86, 0x29, 0x86, 0x31, 0x86, 0x29, 0x66, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x66, 0x31, 0x86, 0x29, 0x86, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x29, 0x66, 0x29, 0x45, 0x21, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x08, 0x81, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xc2, 0xfb, 0x09, 0xfb, 0x09, 0xfa, 0x67, 0xfa, 0x46, 0xfa, 0xa8, 0xfa, 0xe8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa7, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xe8, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x67, 0xfb, 0x09, 0xfb, 0x29, 0x81, 0x85, 0x00, 0x82, 0x18, 0xe3, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x31, 0x86, 0x39, 0xc6, 0x39, 0xe7, 0x41, 0xe7, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x85, 0x31, 0xa6, 0x31, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x29, 0x66, 0x29, 0x66, 0x31, 0x66, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x46, 0x29, 0x66, 0x29, 0x86, 0x29, 0x66, 0x41, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa7, 0x31, 0x66, 0x29, 0x66, 0x29, 0x25, 0x21, 0x25, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x08, 0x81, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x81, 0xfb, 0x29, 0xfb, 0x09, 0xfa, 0x67, 0xfa, 0x46, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xe9, 0xfb, 0x4a, 0x71, 0x85, 0x00, 0xa3, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x29, 0x44, 0x39, 0xc6, 0x39, 0xe7, 0x41, 0xe7, 0x41, 0xe7, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x39, 0xe6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x29, 0x65, 0x31, 0x85, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x66, 0x29, 0x66, 0x29, 0x66, 0x29, 0x66, 0x29, 0x65, 0x29, 0x46, 0x29, 0x45, 0x29, 0x45, 0x29, 0x66, 0x29, 0x66, 0x29, 0x66, 0x39, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa7, 0x31, 0x86, 0x29, 0x66, 0x29, 0x45, 0x29, 0x25, 0x29, 0x25, 0x29, 0x25, 0x29, 0x45, 0x21, 0x25, 0x21, 0x25, 0x21, 0x24, 0x21, 0x24, 0x29, 0x44, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x61, 0xfa, 0xe8, 0xfb, 0x2a, 0xfa, 0x67, 0xfa, 0x46, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa7, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x46, 0xfa, 0xe8, 0xfb, 0x09, 0x61, 0x64, 0x00, 0xc3, 0x29, 0x44, 0x29, 0x44, 0x21, 0x24, 0x29, 0x65, 0x39, 0xc6, 0x39, 0xe7, 0x41, 0xe7, 0x41, 0xe7, 0x42, 0x07, 0x42, 0x07, 0x39, 0xe7, 0x31, 0xc6, 0x31, 0xa5, 0x31, 0xa6, 0x31, 0x85, 0x31, 0x86, 0x29, 0x85, 0x29, 0x65, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x45, 0x21, 0x45, 0x21, 0x25, 0x29, 0x45, 0x29, 0x66, 0x29, 0x66, 0x31, 0x66, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x31, 0xa7, 0x31, 0x86, 0x31, 0x66, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x65, 0x29, 0x45, 0x29, 0x44, 0x21, 0x45, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xa3, 0x10, 0xa2, 0x10, 0x82, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xda, 0x47, 0xfb, 0x6a, 0xfa, 0x87, 0xfa, 0x66, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa7, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0x87, 0xfa, 0x67, 0xfb, 0x09, 0xfa, 0xc8, 0x29, 0x24, 0x09, 0x04, 0x29, 0x44, 0x29, 0x44, 0x21, 0x24, 0x31, 0xa6, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0x85, 0x31, 0xa5, 0x31, 0x85, 0x29, 0x85, 0x29, 0x85, 0x29, 0x65, 0x29, 0x65, 0x31, 0x85, 0x31, 0x86, 0x31, 0x86, 0x29, 0x86, 0x31, 0x86, 0x31, 0x86, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x29, 0x25, 0x29, 0x46, 0x29, 0x66, 0x29, 0x45, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0x86, 0x29, 0x65, 0x29, 0x66, 0x29, 0x66, 0x29, 0x66, 0x29, 0x66, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x31, 0x86, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x21, 0x44, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x00, 0x20, 0x00, 0x00, 0x91, 0x64, 0xfb, 0x29, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x87, 0xfb, 0x29, 0xda, 0x67, 0x08, 0xe4, 0x21, 0x44, 0x29, 0x44, 0x21, 0x24, 0x29, 0x65, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xe6, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0x86, 0x31, 0x85, 0x31, 0x85, 0x29, 0x65, 0x29, 0x85, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x86, 0x29, 0x65, 0x29, 0x85, 0x29, 0x65, 0x31, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x45, 0x21, 0x45, 0x29, 0x45, 0x21, 0x25, 0x21, 0x25, 0x21, 0x24, 0x21, 0x25, 0x29, 0x45, 0x29, 0x45, 0x21, 0x45, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0x86, 0x29, 0x66, 0x29, 0x66, 0x29, 0x66, 0x31, 0x86, 0x31, 0x86, 0x29, 0x66, 0x29, 0x66, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x03, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x10, 0xa2, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x00, 0x00, 0x20, 0x81, 0xfa, 0xe8, 0xfa, 0xe8, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0x46, 0xfa, 0x87, 0xfa, 0xe8, 0x69, 0x85, 0x00, 0xe4, 0x29, 0x44, 0x21, 0x24, 0x21, 0x24, 0x31, 0x85, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xc6, 0x39, 0xc6, 0x31, 0x85, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x21, 0x45, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x25, 0x29, 0x45, 0x21, 0x25, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc8, 0x39, 0xc8, 0x39, 0xa7, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x65, 0x29, 0x65, 0x29, 0x44, 0x21, 0x45, 0x29, 0x45, 0x21, 0x44, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x29, 0x44, 0x21, 0x24, 0x21, 0x24, 0x21, 0x03, 0x20, 0xe3, 0x18, 0xe3, 0x10, 0xa2, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x00, 0x00, 0xb9, 0xc5, 0xfb, 0x29, 0xfa, 0x67, 0xfa, 0x46, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa7, 0xfa, 0x67, 0xfb, 0x09, 0xea, 0x87, 0x19, 0x04, 0x11, 0x24, 0x21, 0x24, 0x21, 0x04, 0x29, 0x44, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xc6, 0x31, 0xc6, 0x31, 0x85, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x21, 0x24, 0x29, 0x45, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x21, 0x25, 0x21, 0x25, 0x29, 0x45, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe8, 0x39, 0xc8, 0x39, 0xc7, 0x31, 0x86, 0x31, 0x87, 0x31, 0x87, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x65, 0x29, 0x45, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x24, 0x21, 0x24, 0x21, 0x04, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x00, 0x21, 0x49, 0x24, 0xfb, 0x09, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0x87, 0xfa, 0x67, 0xfb, 0x29, 0x89, 0xc5, 0x00, 0xc3, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x29, 0x65, 0x31, 0x86, 0x31, 0xa5, 0x31, 0x85, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x85, 0x29, 0x65, 0x29, 0x45, 0x29, 0x45, 0x21, 0x44, 0x21, 0x45, 0x21, 0x24, 0x21, 0x24, 0x21, 0x45, 0x29, 0x45, 0x21, 0x45, 0x21, 0x45, 0x29, 0x45, 0x29, 0x45, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x21, 0x25, 0x21, 0x24, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x42, 0x08, 0x39, 0xe8, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xc7, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xc7, 0x31, 0xc7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x65, 0x29, 0x85, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x31, 0x85, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x65, 0x29, 0x65, 0x29, 0x44, 0x21, 0x04, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x00, 0x21, 0xb2, 0x06, 0xfb, 0x4a, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa7, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x46, 0xfb, 0x09, 0xd2, 0x47, 0x00, 0xc3, 0x19, 0x04, 0x21, 0x04, 0x18, 0xe4, 0x29, 0x44, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0x86, 0x31, 0x85, 0x29, 0x65, 0x21, 0x44, 0x21, 0x44, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x45, 0x21, 0x44, 0x21, 0x44, 0x21, 0x24, 0x29, 0x45, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x42, 0x07, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x42, 0x09, 0x39, 0xe8, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0xc6, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x39, 0xc6, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0x85, 0x31, 0x65, 0x21, 0x04, 0x18, 0xc3, 0x18, 0xe3, 0x08, 0xa3, 0x10, 0xc3, 0xea, 0x67, 0xfa, 0xc8, 0xfa, 0x46, 0xfa, 0x87, 0xfa, 0xe9, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa7, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc9, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xe9, 0x51, 0x44, 0x00, 0xc3, 0x21, 0x04, 0x18, 0xe3, 0x21, 0x04, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe4, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x42, 0x09, 0x39, 0xe8, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x41, 0xe8, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x31, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc6, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0x85, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x00, 0x83, 0x69, 0x85, 0xfb, 0x29, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfb, 0x29, 0xaa, 0x06, 0x00, 0xa2, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x24, 0x29, 0x45, 0x29, 0x65, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x21, 0x44, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x19, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x21, 0x04, 0x21, 0x04, 0x19, 0x04, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x42, 0x09, 0x39, 0xe8, 0x39, 0xc7, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x41, 0xe7, 0x41, 0xe8, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x39, 0xc6, 0x31, 0xc6, 0x39, 0xe7, 0x42, 0x07, 0x41, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xc6, 0x31, 0x85, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x00, 0xc3, 0xba, 0x06, 0xfb, 0x09, 0xfa, 0x87, 0xfa, 0xa7, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa7, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xda, 0x67, 0x08, 0xc3, 0x10, 0xc3, 0x18, 0xe3, 0x18, 0xc3, 0x21, 0x04, 0x21, 0x24, 0x29, 0x44, 0x29, 0x44, 0x29, 0x45, 0x29, 0x44, 0x21, 0x44, 0x21, 0x24, 0x21, 0x03, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x19, 0x03, 0x19, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe4, 0x18, 0xe4, 0x19, 0x04, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe4, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x42, 0x09, 0x39, 0xe8, 0x39, 0xc7, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc8, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x41, 0xe8, 0x42, 0x08, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x3a, 0x07, 0x42, 0x07, 0x42, 0x08, 0x42, 0x07, 0x39, 0xe7, 0x39, 0xe7, 0x31, 0x85, 0x21, 0x24, 0x21, 0x24, 0x19, 0x24, 0x19, 0x04, 0xda, 0x67, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xe9, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0x67, 0xfa, 0xc8, 0xea, 0x67, 0x18, 0xc3, 0x08, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe4, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x04, 0x18, 0xe3, 0x18, 0xe3, 0x19, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x19, 0x04, 0x18, 0xe4, 0x29, 0x45, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe8, 0x42, 0x08, 0x39, 0xe8, 0x39, 0xc7, 0x31, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x42, 0x08, 0x42, 0x08, 0x3a, 0x07, 0x3a, 0x08, 0x3a, 0x07, 0x39, 0xe7, 0x39, 0xe7, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xc7, 0x42, 0x07, 0x42, 0x28, 0x42, 0x28, 0x42, 0x07, 0x42, 0x07, 0x41, 0xe7, 0x31, 0x86, 0x29, 0x25, 0x29, 0x45, 0x19, 0x25, 0x21, 0x24, 0xe2, 0x87, 0xfa, 0xe8, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa7, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xe9, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xe9, 0x38, 0xe3, 0x00, 0x82, 0x18, 0xc3, 0x10, 0xa2, 0x18, 0xe3, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x24, 0x21, 0x24, 0x21, 0x04, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x20, 0xe3, 0x20, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe3, 0x29, 0x24, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe8, 0x42, 0x08, 0x39, 0xe8, 0x39, 0xa7, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x42, 0x08, 0x41, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe6, 0x39, 0xe6, 0x39, 0xe7, 0x42, 0x27, 0x42, 0x28, 0x42, 0x28, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x31, 0x86, 0x29, 0x25, 0x29, 0x45, 0x11, 0x25, 0x39, 0x44, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x46, 0xfa, 0x87, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x67, 0xfb, 0x09, 0x61, 0x44, 0x00, 0x41, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc3, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x04, 0x21, 0x04, 0x21, 0x03, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xa3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x21, 0x04, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x41, 0xe8, 0x39, 0xc7, 0x39, 0xa7, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x42, 0x07, 0x41, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xe6, 0x42, 0x07, 0x42, 0x28, 0x42, 0x08, 0x42, 0x07, 0x42, 0x07, 0x41, 0xe7, 0x31, 0x86, 0x21, 0x45, 0x29, 0x45, 0x09, 0x24, 0x59, 0x65, 0xfa, 0xa7, 0xfa, 0x87, 0xfa, 0x66, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x67, 0xfb, 0x29, 0x81, 0x64, 0x00, 0x21, 0x10, 0xa2, 0x10, 0x82, 0x18, 0xa2, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xa3, 0x18, 0xa3, 0x18, 0xa3, 0x18, 0xa3, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xa3, 0x20, 0xe3, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x39, 0xe8, 0x39, 0xc7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc6, 0x31, 0xc6, 0x39, 0xc6, 0x31, 0xc6, 0x39, 0xc6, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x42, 0x07, 0x41, 0xe7, 0x41, 0xe7, 0x29, 0x65, 0x21, 0x24, 0x29, 0x45, 0x09, 0x04, 0x59, 0x85, 0xfa, 0xe8, 0xfa, 0x87, 0xfa, 0x46, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa7, 0xfa, 0xa7, 0xfa, 0xa8, 0xfa, 0xe8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x46, 0xfb, 0x29, 0x81, 0x85, 0x00, 0x00, 0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc2, 0x10, 0xa2, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xc2, 0x18, 0xa3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xa3, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xa2, 0x18, 0xa3, 0x10, 0xa2, 0x18, 0xc3, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xc7, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc6, 0x39, 0xc7, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x31, 0xc6, 0x31, 0xa6, 0x31, 0x85, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc6, 0x39, 0xe6, 0x41, 0xe7, 0x41, 0xe7, 0x41, 0xe6, 0x39, 0xc6, 0x39, 0xc6, 0x29, 0x45, 0x21, 0x24, 0x29, 0x24, 0x00, 0xe3, 0x59, 0x85, 0xfb, 0x09, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xe9, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x46, 0xfb, 0x29, 0x81, 0x85, 0x00, 0x00, 0x08, 0x61, 0x08, 0x61, 0x10, 0x61, 0x10, 0x82, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x10, 0xa2, 0x10, 0x82, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x18, 0xa2, 0x18, 0xa2, 0x10, 0x82, 0x18, 0xa2, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xc6, 0x39, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0x85, 0x31, 0x65, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0xa5, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa5, 0x29, 0x44, 0x21, 0x03, 0x21, 0x24, 0x00, 0xc3, 0x59, 0x44, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x67, 0xfb, 0x4a, 0x81, 0x44, 0x00, 0x00, 0x08, 0x41, 0x08, 0x41, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x81, 0x10, 0x82, 0x10, 0x82, 0x10, 0x81, 0x10, 0x61, 0x10, 0x81, 0x10, 0x61, 0x10, 0x81, 0x10, 0x61, 0x10, 0x61, 0x10, 0x81, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x18, 0xa2, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xa6, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x85, 0x31, 0x86, 0x31, 0x85, 0x31, 0x85, 0x31, 0x86, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa5, 0x31, 0xa6, 0x31, 0xa5, 0x31, 0x85, 0x31, 0x65, 0x29, 0x65, 0x31, 0x65, 0x29, 0x65, 0x31, 0x65, 0x29, 0x65, 0x31, 0x85, 0x39, 0xa5, 0x39, 0xa5, 0x39, 0xa5, 0x39, 0x85, 0x31, 0x85, 0x31, 0x85, 0x29, 0x24, 0x20, 0xe3, 0x21, 0x03, 0x08, 0xc3, 0x41, 0x03, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfb, 0x4a, 0x69, 0x23, 0x00, 0x00, 0x08, 0x41, 0x08, 0x20, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x61, 0x10, 0x62, 0x10, 0x61, 0x10, 0x62, 0x10, 0x82, 0x10, 0x61, 0x18, 0xa2, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x39, 0xa6, 0x31, 0x86, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x29, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x65, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0x65, 0x29, 0x64, 0x29, 0x44, 0x29, 0x64, 0x29, 0x64, 0x29, 0x64, 0x29, 0x44, 0x29, 0x44, 0x31, 0x84, 0x31, 0x85, 0x31, 0x85, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x29, 0x23, 0x18, 0xc2, 0x18, 0xe3, 0x08, 0xa2, 0x20, 0xc2, 0xf2, 0x87, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xe9, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xe9, 0x40, 0xc2, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x41, 0x10, 0x41, 0x08, 0x20, 0x10, 0x40, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x18, 0xa2, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x65, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x31, 0x65, 0x29, 0x45, 0x29, 0x44, 0x31, 0x44, 0x31, 0x65, 0x31, 0x65, 0x31, 0x64, 0x31, 0x64, 0x29, 0x64, 0x29, 0x64, 0x29, 0x44, 0x29, 0x23, 0x29, 0x44, 0x29, 0x44, 0x29, 0x23, 0x29, 0x23, 0x29, 0x23, 0x29, 0x44, 0x31, 0x64, 0x31, 0x44, 0x29, 0x43, 0x29, 0x23, 0x29, 0x23, 0x20, 0xe3, 0x18, 0xa2, 0x18, 0xa2, 0x10, 0x81, 0x10, 0x81, 0xda, 0x67, 0xfb, 0x09, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0x88, 0x18, 0x20, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x08, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x08, 0x41, 0x08, 0x41, 0x10, 0x41, 0x10, 0x41, 0x08, 0x20, 0x18, 0xa2, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x65, 0x31, 0x85, 0x31, 0x65, 0x29, 0x44, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x44, 0x29, 0x44, 0x29, 0x24, 0x29, 0x44, 0x31, 0x44, 0x31, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x44, 0x29, 0x23, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x29, 0x23, 0x29, 0x23, 0x29, 0x23, 0x29, 0x03, 0x29, 0x03, 0x29, 0x03, 0x20, 0xc2, 0x10, 0x81, 0x18, 0x81, 0x10, 0x81, 0x00, 0x40, 0xc2, 0x47, 0xfa, 0xe9, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x47, 0xfb, 0x2a, 0xe2, 0x67, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x21, 0x08, 0x21, 0x08, 0x41, 0x08, 0x20, 0x08, 0x41, 0x10, 0x41, 0x10, 0x41, 0x08, 0x20, 0x20, 0xc3, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x45, 0x31, 0x65, 0x29, 0x44, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x44, 0x29, 0x24, 0x29, 0x23, 0x29, 0x23, 0x29, 0x23, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x20, 0xe2, 0x21, 0x02, 0x29, 0x02, 0x21, 0x02, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xc2, 0x20, 0xc2, 0x10, 0x81, 0x10, 0x61, 0x10, 0x61, 0x00, 0x00, 0x89, 0x84, 0xfb, 0x09, 0xfa, 0x67, 0xfa, 0x47, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0x87, 0xfb, 0x2a, 0xb9, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x10, 0x21, 0x08, 0x00, 0x21, 0x04, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x45, 0x31, 0x44, 0x29, 0x24, 0x29, 0x04, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x29, 0x03, 0x29, 0x03, 0x29, 0x23, 0x29, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x03, 0x21, 0x02, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x18, 0xc2, 0x20, 0xc2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xc2, 0x20, 0xc1, 0x18, 0xa1, 0x20, 0xc1, 0x10, 0x81, 0x08, 0x40, 0x10, 0x60, 0x00, 0x00, 0x28, 0x81, 0xfa, 0xe9, 0xfb, 0x09, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x87, 0xfb, 0x4a, 0x69, 0x03, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x29, 0x24, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x65, 0x29, 0x24, 0x29, 0x04, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x21, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x29, 0x03, 0x21, 0x02, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xc1, 0x18, 0xc1, 0x18, 0xc1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xc1, 0x20, 0xc1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x08, 0x40, 0x10, 0x60, 0x08, 0x40, 0x00, 0x00, 0xc2, 0x06, 0xfb, 0x4a, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0xc9, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x26, 0xfa, 0xe9, 0xea, 0x88, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x31, 0x65, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x21, 0x03, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xc2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xc2, 0x20, 0xc2, 0x18, 0xc1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x81, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x80, 0x18, 0x80, 0x18, 0x60, 0x18, 0x81, 0x10, 0x60, 0x08, 0x40, 0x10, 0x40, 0x00, 0x00, 0x71, 0x43, 0xfb, 0x29, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0x88, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x47, 0xfa, 0x87, 0xfb, 0x6a, 0xa1, 0xe6, 0x00, 0x00, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x10, 0x61, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x20, 0xe2, 0x21, 0x03, 0x20, 0xe3, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc1, 0x18, 0xc1, 0x18, 0xc1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x80, 0x18, 0x80, 0x10, 0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x18, 0x80, 0x10, 0x60, 0x08, 0x20, 0x08, 0x40, 0x00, 0x20, 0x08, 0x20, 0xe2, 0x67, 0xfb, 0x09, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x46, 0xfa, 0xe9, 0xfb, 0x09, 0x38, 0xa2, 0x00, 0x00, 0x10, 0x41, 0x08, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x41, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x07, 0x18, 0xc2, 0x20, 0xe2, 0x20, 0xe2, 0x18, 0xc2, 0x18, 0xc2, 0x18, 0xa2, 0x18, 0xa1, 0x18, 0xc1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x81, 0x10, 0x80, 0x10, 0x80, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x81, 0x08, 0x40, 0x10, 0x40, 0x10, 0x60, 0x00, 0x00, 0x59, 0x23, 0xfb, 0x2a, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x46, 0xfa, 0x87, 0xfb, 0x2a, 0x91, 0xa5, 0x00, 0x00, 0x10, 0x61, 0x10, 0x41, 0x10, 0x21, 0x10, 0x61, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x21, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x18, 0x61, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x18, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x80, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x18, 0xa1, 0x18, 0x81, 0x10, 0x40, 0x10, 0x60, 0x08, 0x60, 0x00, 0x20, 0xe2, 0x67, 0xfb, 0x4a, 0xfa, 0xa8, 0xfa, 0x46, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x46, 0xfa, 0x67, 0xfb, 0x09, 0xfa, 0xc8, 0x10, 0x81, 0x00, 0x41, 0x18, 0x82, 0x10, 0x41, 0x10, 0x61, 0x20, 0xa2, 0x18, 0x61, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x18, 0xa2, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x21, 0x03, 0x20, 0xa1, 0x20, 0xa2, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x80, 0x18, 0x80, 0x18, 0x81, 0x18, 0xa1, 0x10, 0x60, 0x10, 0x81, 0x18, 0xa1, 0x00, 0x61, 0x20, 0xa2, 0xfa, 0xc8, 0xfb, 0x09, 0xfa, 0x88, 0xfa, 0x26, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xe9, 0xfa, 0xe9, 0x59, 0x24, 0x00, 0x41, 0x18, 0xa2, 0x18, 0x82, 0x10, 0x61, 0x18, 0xc2, 0x20, 0xa2, 0x18, 0x82, 0x18, 0x81, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x40, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x21, 0x03, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x45, 0x18, 0x81, 0x18, 0xa1, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0xa1, 0x18, 0xa1, 0x20, 0xe2, 0x18, 0xc2, 0x10, 0x81, 0x18, 0xc2, 0x20, 0xe3, 0x00, 0x61, 0x71, 0x64, 0xfb, 0x09, 0xfa, 0xe9, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0x87, 0xfa, 0x46, 0xfa, 0xc8, 0xfb, 0x4a, 0xa1, 0xe6, 0x00, 0x62, 0x18, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0xc2, 0x20, 0xe3, 0x20, 0xa2, 0x20, 0xa2, 0x20, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x18, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x40, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x31, 0x65, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xa6, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x61, 0x10, 0x61, 0x10, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x80, 0x18, 0x80, 0x20, 0xa1, 0x20, 0xc1, 0x20, 0xc1, 0x20, 0xe2, 0x29, 0x02, 0x29, 0x23, 0x18, 0xc2, 0x20, 0xe2, 0x21, 0x03, 0x29, 0x24, 0x00, 0xc3, 0x91, 0xc5, 0xfb, 0x09, 0xfa, 0xe9, 0xfa, 0x88, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0xa8, 0xfb, 0x09, 0xc2, 0x26, 0x00, 0xa3, 0x19, 0x04, 0x21, 0x04, 0x20, 0xe3, 0x18, 0xc3, 0x29, 0x24, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xa2, 0x20, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x40, 0x10, 0x40, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x41, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x10, 0x81, 0x18, 0x80, 0x18, 0x80, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x80, 0x18, 0x80, 0x18, 0x81, 0x20, 0xa1, 0x20, 0xc1, 0x20, 0xe2, 0x29, 0x02, 0x29, 0x03, 0x29, 0x23, 0x31, 0x44, 0x29, 0x44, 0x21, 0x03, 0x29, 0x44, 0x31, 0x65, 0x21, 0x65, 0x00, 0xe4, 0xa1, 0xe6, 0xfb, 0x09, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0x46, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x88, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0x46, 0xfa, 0x67, 0xfa, 0xc9, 0xfb, 0x09, 0xd2, 0x67, 0x08, 0xc3, 0x11, 0x04, 0x31, 0x44, 0x29, 0x24, 0x20, 0xe3, 0x29, 0x24, 0x31, 0x45, 0x29, 0x04, 0x29, 0x04, 0x28, 0xe3, 0x28, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x81, 0x18, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x18, 0xa2, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x20, 0xe3, 0x10, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x80, 0x18, 0x80, 0x18, 0x81, 0x18, 0xa1, 0x18, 0xa1, 0x20, 0xc1, 0x20, 0xe2, 0x29, 0x03, 0x29, 0x23, 0x31, 0x43, 0x31, 0x64, 0x39, 0x84, 0x39, 0xc5, 0x29, 0x65, 0x29, 0x24, 0x31, 0x85, 0x39, 0xa6, 0x29, 0xa6, 0x09, 0x45, 0x99, 0xe6, 0xfa, 0xe9, 0xfb, 0x09, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xc9, 0xfb, 0x09, 0xc2, 0x47, 0x11, 0x04, 0x11, 0x45, 0x31, 0x86, 0x29, 0x45, 0x21, 0x04, 0x29, 0x24, 0x39, 0x86, 0x31, 0x65, 0x31, 0x45, 0x31, 0x24, 0x29, 0x24, 0x29, 0x04, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xc2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x81, 0x18, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x29, 0x24, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x65, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x80, 0x18, 0x80, 0x10, 0x80, 0x18, 0x81, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xc1, 0x20, 0xc1, 0x20, 0xe2, 0x29, 0x23, 0x31, 0x43, 0x31, 0x64, 0x31, 0x84, 0x39, 0xa5, 0x41, 0xc5, 0x41, 0xe6, 0x42, 0x07, 0x31, 0x85, 0x31, 0x85, 0x39, 0xc6, 0x41, 0xe7, 0x31, 0xe7, 0x01, 0x45, 0x79, 0xc6, 0xfa, 0xc8, 0xfa, 0xe9, 0xfa, 0xc8, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x88, 0xfa, 0x88, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xc9, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0xa8, 0xfa, 0xe9, 0xfa, 0xc8, 0xa2, 0x06, 0x09, 0x04, 0x19, 0x86, 0x39, 0xa6, 0x31, 0x86, 0x29, 0x45, 0x29, 0x45, 0x39, 0xc6, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x85, 0x31, 0x65, 0x31, 0x45, 0x31, 0x24, 0x29, 0x24, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x81, 0x18, 0x81, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x40, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x10, 0x40, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x10, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x80, 0x18, 0x80, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xc1, 0x20, 0xe2, 0x21, 0x02, 0x21, 0x02, 0x29, 0x23, 0x31, 0x84, 0x39, 0xa5, 0x39, 0xc5, 0x41, 0xe6, 0x42, 0x06, 0x4a, 0x27, 0x4a, 0x48, 0x4a, 0x48, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xe7, 0x42, 0x08, 0x3a, 0x08, 0x09, 0x66, 0x41, 0x65, 0xda, 0x47, 0xfa, 0xe8, 0xfa, 0xe9, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xc9, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0xc8, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0xa8, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x88, 0xfa, 0xe9, 0xfb, 0x09, 0xea, 0x87, 0x61, 0x85, 0x09, 0x45, 0x29, 0xc7, 0x41, 0xc7, 0x39, 0xa6, 0x31, 0x86, 0x29, 0x65, 0x42, 0x07, 0x41, 0xe7, 0x41, 0xc7, 0x41, 0xc6, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x85, 0x31, 0x65, 0x29, 0x24, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x18, 0x81, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x40, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x18, 0x82, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x18, 0xc2, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x80, 0x18, 0x80, 0x18, 0x81, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xc1, 0x20, 0xe2, 0x21, 0x02, 0x29, 0x03, 0x29, 0x23, 0x29, 0x43, 0x31, 0x84, 0x41, 0xc5, 0x42, 0x06, 0x4a, 0x27, 0x4a, 0x48, 0x52, 0x68, 0x52, 0x89, 0x52, 0xa9, 0x52, 0x89, 0x39, 0xe7, 0x39, 0xc7, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x11, 0x86, 0x19, 0x25, 0x69, 0x85, 0xea, 0x67, 0xfb, 0x09, 0xfb, 0x4a, 0xfa, 0xa8, 0xfa, 0xa8, 0xfa, 0xc8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x46, 0xfa, 0x46, 0xfa, 0x47, 0xfa, 0x67, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0x88, 0xfa, 0xe9, 0xfb, 0x29, 0xfa, 0xc8, 0x89, 0xe6, 0x29, 0x45, 0x11, 0x86, 0x3a, 0x08, 0x41, 0xe7, 0x39, 0xc7, 0x31, 0x86, 0x31, 0x86, 0x4a, 0x28, 0x4a, 0x28, 0x4a, 0x28, 0x4a, 0x08, 0x41, 0xe7, 0x41, 0xe7, 0x41, 0xc6, 0x39, 0xa6, 0x31, 0x85, 0x29, 0x44, 0x29, 0x24, 0x29, 0x04, 0x21, 0x03, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x18, 0x61, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x21, 0x04, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x65, 0x10, 0x40, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x60, 0x18, 0x80, 0x18, 0x81, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xc1, 0x20, 0xc1, 0x20, 0xc2, 0x20, 0xe2, 0x20, 0xe2, 0x21, 0x02, 0x29, 0x23, 0x29, 0x43, 0x31, 0x64, 0x31, 0x84, 0x31, 0xa5, 0x41, 0xe6, 0x4a, 0x27, 0x4a, 0x68, 0x52, 0x89, 0x52, 0x89, 0x5a, 0xc9, 0x5a, 0xca, 0x62, 0xeb, 0x52, 0xaa, 0x42, 0x08, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x29, 0x86, 0x00, 0xe4, 0x28, 0xe3, 0x89, 0xc5, 0xca, 0x26, 0xfa, 0xe9, 0xfb, 0x09, 0xfb, 0x2a, 0xfb, 0x09, 0xfa, 0xe9, 0xfa, 0xa8, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0x67, 0xfa, 0x87, 0xfa, 0x87, 0xfa, 0xc8, 0xfa, 0xe9, 0xfb, 0x09, 0xfb, 0x2a, 0xfb, 0x09, 0xda, 0x67, 0x9a, 0x06, 0x49, 0x85, 0x01, 0x45, 0x29, 0xe7, 0x42, 0x08, 0x42, 0x08, 0x39, 0xe7, 0x31, 0xa6, 0x39, 0xc7, 0x4a, 0x49, 0x52, 0x89, 0x52, 0x69, 0x52, 0x69, 0x4a, 0x28, 0x4a, 0x28, 0x4a, 0x08, 0x41, 0xe7, 0x39, 0xc6, 0x31, 0x85, 0x31, 0x45, 0x29, 0x44, 0x29, 0x24, 0x29, 0x04, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xa2, 0x20, 0xa2, 0x18, 0xa2, 0x20, 0x82, 0x18, 0x82, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x18, 0x61, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x10, 0x60, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x40, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0x81, 0x18, 0xa1, 0x20, 0xa1, 0x20, 0xc1, 0x20, 0xc1, 0x20, 0xe2, 0x20, 0xe2, 0x21, 0x02, 0x21, 0x02, 0x21, 0x03, 0x29, 0x23, 0x29, 0x44, 0x31, 0x64, 0x31, 0x84, 0x39, 0xa5, 0x39, 0xc5, 0x39, 0xe6, 0x4a, 0x47, 0x52, 0x88, 0x5a, 0xaa, 0x5a, 0xea, 0x5a, 0xeb, 0x62, 0xeb, 0x63, 0x0b, 0x63, 0x0b, 0x5a, 0xeb, 0x42, 0x28, 0x31, 0xa7, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x11, 0x04, 0x00, 0x62, 0x00, 0x62, 0x49, 0x03, 0xa1, 0xe5, 0xca, 0x26, 0xea, 0x67, 0xfa, 0xe9, 0xfb, 0x4a, 0xfb, 0x2a, 0xfb, 0x4a, 0xfb, 0x6b, 0xfb, 0x2a, 0xfb, 0x2a, 0xfa, 0xe9, 0xf2, 0x67, 0xd2, 0x47, 0xb2, 0x27, 0x61, 0x85, 0x19, 0x04, 0x01, 0x04, 0x19, 0x86, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x39, 0xe7, 0x39, 0xc7, 0x42, 0x08, 0x52, 0xaa, 0x5a, 0xca, 0x5a, 0xaa, 0x5a, 0xaa, 0x52, 0x89, 0x52, 0x69, 0x4a, 0x49, 0x4a, 0x28, 0x42, 0x07, 0x39, 0xc6, 0x31, 0x86, 0x31, 0x85, 0x31, 0x65, 0x29, 0x44, 0x29, 0x44, 0x29, 0x24, 0x21, 0x04, 0x29, 0x03, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc2, 0x20, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x18, 0x82, 0x18, 0x82, 0x18, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x18, 0xa2, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x21, 0x03, 0x10, 0x40, 0x18, 0x60, 0x18, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x10, 0x60, 0x18, 0x80, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0xa1, 0x20, 0xc1, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x29, 0x02, 0x29, 0x23, 0x29, 0x23, 0x29, 0x43, 0x29, 0x43, 0x29, 0x64, 0x31, 0x85, 0x31, 0xa5, 0x39, 0xc5, 0x3a, 0x06, 0x42, 0x07, 0x42, 0x48, 0x52, 0xa9, 0x5a, 0xea, 0x63, 0x0b, 0x63, 0x2c, 0x63, 0x0c, 0x63, 0x0b, 0x63, 0x0b, 0x63, 0x0b, 0x5a, 0xca, 0x4a, 0x49, 0x39, 0xa7, 0x29, 0x65, 0x29, 0x65, 0x29, 0x45, 0x29, 0x24, 0x21, 0x04, 0x10, 0xc3, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x10, 0x20, 0x38, 0xa2, 0x51, 0x03, 0x79, 0x23, 0x81, 0x43, 0x81, 0x64, 0x81, 0x23, 0x61, 0x23, 0x48, 0xe3, 0x20, 0x82, 0x10, 0xa2, 0x00, 0xa2, 0x00, 0xc3, 0x21, 0x65, 0x39, 0xa6, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x4a, 0x69, 0x5a, 0xcb, 0x62, 0xca, 0x5a, 0xcb, 0x5a, 0xca, 0x5a, 0xaa, 0x5a, 0xaa, 0x52, 0x8a, 0x52, 0x69, 0x4a, 0x48, 0x42, 0x07, 0x39, 0xc6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0x65, 0x31, 0x65, 0x31, 0x45, 0x29, 0x24, 0x29, 0x24, 0x29, 0x24, 0x29, 0x04, 0x29, 0x04, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x18, 0x82, 0x18, 0x62, 0x18, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x61, 0x10, 0x41, 0x18, 0x61, 0x29, 0x24, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x10, 0x40, 0x18, 0x60, 0x18, 0x80, 0x18, 0x80, 0x10, 0x60, 0x18, 0x60, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0xa1, 0x18, 0xa1, 0x20, 0xc1, 0x20, 0xc2, 0x28, 0xe2, 0x29, 0x02, 0x29, 0x03, 0x29, 0x23, 0x29, 0x43, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0x64, 0x31, 0xa5, 0x39, 0xe6, 0x39, 0xe6, 0x42, 0x07, 0x42, 0x47, 0x4a, 0x48, 0x4a, 0x89, 0x5a, 0xea, 0x63, 0x2b, 0x63, 0x2c, 0x6b, 0x4c, 0x63, 0x2c, 0x63, 0x0b, 0x63, 0x0b, 0x5a, 0xcb, 0x5a, 0xaa, 0x4a, 0x49, 0x39, 0xe7, 0x29, 0x65, 0x21, 0x04, 0x20, 0xe3, 0x20, 0xe3, 0x18, 0xc2, 0x18, 0x82, 0x10, 0x41, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x82, 0x10, 0xc3, 0x21, 0x04, 0x29, 0x45, 0x31, 0x65, 0x31, 0x86, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xc7, 0x42, 0x28, 0x52, 0xaa, 0x63, 0x0b, 0x63, 0x0b, 0x63, 0x0b, 0x62, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xcb, 0x5a, 0xaa, 0x52, 0x89, 0x4a, 0x48, 0x41, 0xe7, 0x39, 0xe7, 0x39, 0xc6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x45, 0x29, 0x45, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x29, 0x24, 0x29, 0x04, 0x29, 0x03, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xa2, 0x20, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x18, 0x62, 0x18, 0x62, 0x18, 0x62, 0x18, 0x62, 0x18, 0x41, 0x18, 0xa2, 0x39, 0xc6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x18, 0xc2, 0x18, 0x60, 0x18, 0x80, 0x18, 0x81, 0x18, 0x80, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0xa1, 0x20, 0xc1, 0x20, 0xc1, 0x20, 0xc2, 0x20, 0xe2, 0x29, 0x03, 0x29, 0x23, 0x29, 0x23, 0x29, 0x44, 0x31, 0x64, 0x31, 0x84, 0x31, 0xa5, 0x39, 0xa5, 0x31, 0xa5, 0x39, 0xa6, 0x39, 0xe7, 0x42, 0x27, 0x42, 0x27, 0x4a, 0x48, 0x4a, 0x88, 0x4a, 0x89, 0x52, 0xaa, 0x63, 0x0b, 0x6b, 0x4c, 0x6b, 0x4c, 0x6b, 0x4c, 0x63, 0x2c, 0x5a, 0xeb, 0x5a, 0xcb, 0x5a, 0xaa, 0x52, 0x69, 0x4a, 0x48, 0x41, 0xe7, 0x31, 0x65, 0x29, 0x24, 0x18, 0xa2, 0x10, 0x82, 0x10, 0x61, 0x10, 0x41, 0x10, 0x21, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xe3, 0x21, 0x03, 0x29, 0x24, 0x29, 0x44, 0x29, 0x45, 0x31, 0xa6, 0x39, 0xe7, 0x4a, 0x69, 0x5a, 0xeb, 0x63, 0x0b, 0x63, 0x0b, 0x63, 0x2b, 0x63, 0x0b, 0x63, 0x0b, 0x63, 0x0c, 0x63, 0x0b, 0x5a, 0xeb, 0x5a, 0xca, 0x4a, 0x69, 0x42, 0x28, 0x42, 0x27, 0x42, 0x07, 0x39, 0xe7, 0x39, 0xc6, 0x39, 0xc6, 0x31, 0x86, 0x31, 0x65, 0x31, 0x85, 0x31, 0x85, 0x31, 0x65, 0x31, 0x45, 0x31, 0x45, 0x29, 0x24, 0x29, 0x24, 0x29, 0x04, 0x28, 0xe3, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x18, 0x82, 0x18, 0x82, 0x18, 0x62, 0x18, 0x82, 0x20, 0xe3, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x10, 0x60, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0x81, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xc1, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x29, 0x03, 0x29, 0x23, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x31, 0x85, 0x39, 0xa5, 0x39, 0xc5, 0x39, 0xe6, 0x39, 0xe6, 0x39, 0xe6, 0x39, 0xe7, 0x42, 0x48, 0x4a, 0x68, 0x4a, 0x68, 0x52, 0xa9, 0x52, 0xa9, 0x52, 0xa9, 0x52, 0xca, 0x63, 0x2b, 0x6b, 0x4c, 0x63, 0x4c, 0x63, 0x2c, 0x62, 0xeb, 0x5a, 0xca, 0x52, 0x89, 0x52, 0x49, 0x42, 0x08, 0x41, 0xc7, 0x39, 0xa6, 0x31, 0x65, 0x29, 0x45, 0x20, 0xc3, 0x18, 0x82, 0x10, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0xa2, 0x20, 0xe3, 0x29, 0x24, 0x31, 0x65, 0x39, 0xc7, 0x4a, 0x28, 0x52, 0x89, 0x5a, 0xca, 0x5a, 0xcb, 0x63, 0x0b, 0x63, 0x2b, 0x63, 0x2c, 0x63, 0x2c, 0x63, 0x2c, 0x63, 0x2c, 0x63, 0x0b, 0x5a, 0xea, 0x52, 0x89, 0x4a, 0x48, 0x4a, 0x48, 0x4a, 0x48, 0x42, 0x07, 0x39, 0xe7, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0x86, 0x31, 0x86, 0x31, 0x65, 0x31, 0x65, 0x31, 0x45, 0x31, 0x44, 0x29, 0x24, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xa3, 0x20, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0xa2, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x18, 0xc2, 0x18, 0x80, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x18, 0xa1, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xe2, 0x21, 0x03, 0x29, 0x03, 0x29, 0x23, 0x29, 0x23, 0x31, 0x64, 0x39, 0x85, 0x39, 0xa5, 0x39, 0xa5, 0x39, 0xc6, 0x39, 0xe6, 0x42, 0x07, 0x42, 0x27, 0x42, 0x27, 0x42, 0x27, 0x42, 0x28, 0x4a, 0x69, 0x4a, 0x89, 0x4a, 0x89, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xeb, 0x63, 0x2b, 0x63, 0x0b, 0x5a, 0xeb, 0x5a, 0xcb, 0x52, 0x8a, 0x4a, 0x48, 0x42, 0x07, 0x41, 0xc6, 0x39, 0x65, 0x29, 0x24, 0x29, 0x24, 0x28, 0xe3, 0x20, 0xa2, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x10, 0x61, 0x10, 0x41, 0x10, 0x21, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x82, 0x18, 0xc3, 0x21, 0x03, 0x29, 0x44, 0x31, 0x85, 0x39, 0x86, 0x39, 0xc6, 0x4a, 0x28, 0x4a, 0x48, 0x52, 0x89, 0x5a, 0xca, 0x5a, 0xeb, 0x63, 0x0b, 0x63, 0x2c, 0x63, 0x4c, 0x6b, 0x4c, 0x6b, 0x4c, 0x63, 0x2c, 0x5b, 0x0b, 0x52, 0xaa, 0x4a, 0x69, 0x4a, 0x89, 0x4a, 0x69, 0x42, 0x48, 0x42, 0x28, 0x42, 0x08, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0x86, 0x31, 0x65, 0x39, 0x65, 0x31, 0x45, 0x29, 0x24, 0x29, 0x04, 0x29, 0x04, 0x28, 0xe4, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xa3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xa2, 0x18, 0xa2, 0x20, 0xe3, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x18, 0x81, 0x20, 0xc1, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xc2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe3, 0x29, 0x23, 0x29, 0x23, 0x29, 0x24, 0x31, 0x44, 0x31, 0x64, 0x39, 0xa5, 0x41, 0xc6, 0x41, 0xc6, 0x41, 0xe6, 0x42, 0x07, 0x42, 0x28, 0x4a, 0x48, 0x4a, 0x68, 0x4a, 0x68, 0x4a, 0x48, 0x4a, 0x68, 0x52, 0xa9, 0x52, 0xca, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xca, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xea, 0x5a, 0xca, 0x52, 0xaa, 0x52, 0x69, 0x4a, 0x28, 0x41, 0xe7, 0x39, 0xa6, 0x31, 0x65, 0x31, 0x24, 0x20, 0xe3, 0x20, 0xa2, 0x18, 0x61, 0x10, 0x41, 0x18, 0x81, 0x18, 0x82, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x03, 0x29, 0x24, 0x31, 0x45, 0x31, 0x45, 0x39, 0x85, 0x41, 0xc6, 0x42, 0x07, 0x4a, 0x48, 0x52, 0x89, 0x5a, 0xaa, 0x5a, 0xeb, 0x63, 0x0c, 0x63, 0x2c, 0x6b, 0x4c, 0x6b, 0x4c, 0x63, 0x4c, 0x5a, 0xeb, 0x52, 0xaa, 0x52, 0x89, 0x52, 0xa9, 0x52, 0x89, 0x4a, 0x69, 0x4a, 0x69, 0x4a, 0x49, 0x42, 0x08, 0x39, 0xe7, 0x42, 0x07, 0x42, 0x07, 0x41, 0xe7, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x86, 0x31, 0x45, 0x31, 0x25, 0x29, 0x24, 0x29, 0x04, 0x29, 0x04, 0x28, 0xe3, 0x20, 0xe3, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x18, 0xa3, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x20, 0xe3, 0x20, 0xc1, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x20, 0xe2, 0x21, 0x03, 0x29, 0x03, 0x29, 0x23, 0x29, 0x44, 0x31, 0x64, 0x31, 0x65, 0x31, 0x85, 0x39, 0xa5, 0x41, 0xe6, 0x42, 0x07, 0x42, 0x07, 0x42, 0x28, 0x4a, 0x48, 0x4a, 0x69, 0x4a, 0x89, 0x52, 0x8a, 0x52, 0x89, 0x4a, 0x69, 0x4a, 0x89, 0x52, 0xca, 0x52, 0xca, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xca, 0x52, 0xaa, 0x4a, 0x69, 0x4a, 0x69, 0x52, 0x89, 0x52, 0x89, 0x4a, 0x48, 0x4a, 0x08, 0x41, 0xe7, 0x39, 0xa6, 0x31, 0x45, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xa2, 0x18, 0x62, 0x10, 0x41, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x41, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x29, 0x03, 0x31, 0x45, 0x39, 0x85, 0x41, 0xc6, 0x42, 0x07, 0x4a, 0x28, 0x52, 0x69, 0x5a, 0xaa, 0x5a, 0xeb, 0x63, 0x0b, 0x63, 0x2c, 0x63, 0x2c, 0x63, 0x2b, 0x5a, 0xeb, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xa9, 0x4a, 0x69, 0x4a, 0x89, 0x4a, 0x69, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x42, 0x07, 0x41, 0xe7, 0x39, 0xc7, 0x41, 0xc7, 0x39, 0xa7, 0x39, 0x86, 0x31, 0x65, 0x31, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x24, 0x29, 0x04, 0x28, 0xe4, 0x20, 0xe4, 0x20, 0xe4, 0x28, 0xe4, 0x28, 0xe3, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xe3, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc6, 0x18, 0xc2, 0x29, 0x03, 0x29, 0x03, 0x29, 0x03, 0x29, 0x03, 0x29, 0x03, 0x29, 0x24, 0x29, 0x24, 0x31, 0x64, 0x31, 0x85, 0x31, 0x85, 0x39, 0xa5, 0x39, 0xc6, 0x41, 0xe6, 0x4a, 0x28, 0x4a, 0x48, 0x4a, 0x48, 0x4a, 0x69, 0x52, 0x89, 0x52, 0x89, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xca, 0x4a, 0x89, 0x4a, 0x89, 0x52, 0xca, 0x52, 0xca, 0x52, 0xaa, 0x52, 0x89, 0x52, 0xa9, 0x4a, 0x89, 0x4a, 0x48, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x41, 0xe7, 0x39, 0xc6, 0x39, 0x85, 0x31, 0x45, 0x29, 0x04, 0x20, 0xc3, 0x20, 0xa2, 0x18, 0x61, 0x10, 0x41, 0x10, 0x20, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x18, 0x61, 0x18, 0xa2, 0x20, 0xc3, 0x29, 0x04, 0x31, 0x44, 0x39, 0x65, 0x39, 0xc6, 0x42, 0x07, 0x4a, 0x48, 0x52, 0x69, 0x5a, 0xaa, 0x5a, 0xca, 0x62, 0xeb, 0x5b, 0x0b, 0x5a, 0xea, 0x52, 0xca, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xca, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0x89, 0x4a, 0x49, 0x4a, 0x28, 0x4a, 0x48, 0x4a, 0x69, 0x4a, 0x49, 0x4a, 0x48, 0x42, 0x28, 0x42, 0x28, 0x41, 0xe7, 0x41, 0xe7, 0x41, 0xe7, 0x39, 0xc6, 0x39, 0x86, 0x31, 0x66, 0x31, 0x65, 0x31, 0x65, 0x29, 0x45, 0x29, 0x25, 0x29, 0x24, 0x29, 0x04, 0x28, 0xe4, 0x28, 0xe4, 0x29, 0x04, 0x29, 0x04, 0x28, 0xe4, 0x18, 0xc2, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x21, 0x24, 0x29, 0x03, 0x29, 0x23, 0x29, 0x24, 0x29, 0x44, 0x29, 0x23, 0x29, 0x44, 0x31, 0x44, 0x31, 0x65, 0x39, 0xa5, 0x39, 0xc6, 0x39, 0xc6, 0x41, 0xc7, 0x41, 0xe7, 0x4a, 0x28, 0x52, 0x69, 0x52, 0x89, 0x52, 0x89, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xca, 0x5a, 0xeb, 0x5a, 0xeb, 0x52, 0xea, 0x52, 0xaa, 0x4a, 0x8a, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xaa, 0x4a, 0x69, 0x4a, 0x69, 0x4a, 0x48, 0x42, 0x28, 0x39, 0xe7, 0x39, 0xc7, 0x39, 0xa6, 0x39, 0x85, 0x31, 0x65, 0x31, 0x24, 0x28, 0xe3, 0x20, 0xc3, 0x18, 0x82, 0x18, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x18, 0x61, 0x18, 0xa2, 0x20, 0xc3, 0x29, 0x04, 0x31, 0x44, 0x39, 0x85, 0x39, 0xa6, 0x41, 0xe7, 0x4a, 0x28, 0x52, 0x69, 0x52, 0x89, 0x52, 0xa9, 0x52, 0xa9, 0x52, 0xa9, 0x52, 0xa9, 0x52, 0xaa, 0x5a, 0xca, 0x52, 0xca, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xca, 0x52, 0xaa, 0x4a, 0x69, 0x4a, 0x69, 0x4a, 0x89, 0x52, 0x8a, 0x52, 0x89, 0x4a, 0x69, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x28, 0x4a, 0x28, 0x4a, 0x08, 0x41, 0xe7, 0x39, 0xa7, 0x39, 0xa6, 0x31, 0x86, 0x31, 0x86, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x25, 0x29, 0x04, 0x29, 0x04, 0x29, 0x25, 0x29, 0x04, 0x29, 0x04, 0x20, 0xe3, 0x21, 0x04, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x20, 0xe3, 0x31, 0x44, 0x31, 0x44, 0x31, 0x64, 0x31, 0x64, 0x29, 0x44, 0x31, 0x65, 0x31, 0x85, 0x39, 0xa6, 0x39, 0xc6, 0x41, 0xe7, 0x41, 0xe7, 0x42, 0x08, 0x4a, 0x28, 0x4a, 0x49, 0x52, 0xaa, 0x5a, 0xca, 0x5a, 0xca, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x52, 0xeb, 0x52, 0xaa, 0x4a, 0x89, 0x4a, 0x89, 0x4a, 0x89, 0x4a, 0x69, 0x4a, 0x48, 0x42, 0x28, 0x42, 0x07, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0x85, 0x29, 0x45, 0x29, 0x24, 0x29, 0x03, 0x20, 0xe3, 0x20, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x20, 0xa2, 0x20, 0xc3, 0x29, 0x03, 0x31, 0x24, 0x31, 0x65, 0x39, 0xa6, 0x41, 0xe6, 0x42, 0x07, 0x42, 0x28, 0x4a, 0x48, 0x4a, 0x48, 0x4a, 0x48, 0x4a, 0x89, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xca, 0x52, 0xca, 0x52, 0xaa, 0x4a, 0x69, 0x4a, 0x89, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0x8a, 0x52, 0x8a, 0x4a, 0x69, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x08, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0x86, 0x31, 0x65, 0x31, 0x65, 0x29, 0x45, 0x29, 0x25, 0x31, 0x45, 0x31, 0x45, 0x31, 0x25, 0x29, 0x04, 0x18, 0xa2, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x65, 0x29, 0x23, 0x39, 0x85, 0x39, 0x65, 0x39, 0x85, 0x31, 0x85, 0x31, 0x85, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xc7, 0x42, 0x07, 0x42, 0x08, 0x42, 0x28, 0x4a, 0x49, 0x4a, 0x49, 0x52, 0x8a, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5b, 0x0b, 0x5a, 0xeb, 0x52, 0xcb, 0x52, 0xaa, 0x4a, 0x69, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x48, 0x42, 0x28, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0xa6, 0x31, 0x65, 0x29, 0x44, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x41, 0x10, 0x40, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x18, 0x61, 0x18, 0xa2, 0x20, 0xc2, 0x28, 0xe3, 0x29, 0x24, 0x31, 0x44, 0x31, 0x85, 0x39, 0xa6, 0x39, 0xc6, 0x39, 0xe7, 0x42, 0x07, 0x42, 0x48, 0x4a, 0x69, 0x4a, 0x89, 0x52, 0x89, 0x52, 0x89, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xca, 0x52, 0xaa, 0x52, 0x89, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xcb, 0x52, 0xca, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0x8a, 0x4a, 0x69, 0x52, 0x69, 0x52, 0x6a, 0x4a, 0x49, 0x42, 0x08, 0x41, 0xe8, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xc7, 0x39, 0xa7, 0x31, 0x86, 0x31, 0x86, 0x31, 0x65, 0x31, 0x45, 0x31, 0x66, 0x31, 0x66, 0x31, 0x45, 0x31, 0x45, 0x18, 0xc3, 0x29, 0x65, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x21, 0x03, 0x31, 0x85, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xc6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xc7, 0x41, 0xe7, 0x42, 0x08, 0x4a, 0x48, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x69, 0x52, 0x8a, 0x5a, 0xaa, 0x62, 0xeb, 0x63, 0x0c, 0x5a, 0xeb, 0x5a, 0xeb, 0x5b, 0x0c, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xcb, 0x52, 0xca, 0x52, 0xaa, 0x4a, 0x49, 0x42, 0x28, 0x42, 0x08, 0x42, 0x07, 0x39, 0xe7, 0x39, 0xc6, 0x31, 0x86, 0x31, 0x45, 0x29, 0x24, 0x21, 0x03, 0x20, 0xe3, 0x18, 0xa2, 0x18, 0x82, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x18, 0x61, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xe3, 0x29, 0x03, 0x29, 0x24, 0x29, 0x45, 0x31, 0x85, 0x39, 0xa6, 0x39, 0xe7, 0x42, 0x07, 0x42, 0x28, 0x4a, 0x48, 0x4a, 0x69, 0x4a, 0x89, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xaa, 0x4a, 0x89, 0x52, 0xaa, 0x52, 0xca, 0x52, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xcb, 0x52, 0xcb, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0x69, 0x4a, 0x28, 0x42, 0x08, 0x41, 0xe8, 0x41, 0xe8, 0x41, 0xe8, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0xa7, 0x31, 0x86, 0x31, 0x66, 0x31, 0x86, 0x39, 0x86, 0x31, 0x86, 0x39, 0x86, 0x21, 0x04, 0x18, 0xc3, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x20, 0xe3, 0x39, 0xe6, 0x41, 0xe7, 0x41, 0xe7, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xe7, 0x42, 0x08, 0x42, 0x08, 0x4a, 0x49, 0x4a, 0x69, 0x4a, 0x69, 0x52, 0x6a, 0x52, 0x8a, 0x52, 0xaa, 0x5a, 0xcb, 0x63, 0x0c, 0x63, 0x2c, 0x63, 0x0c, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0xaa, 0x4a, 0x69, 0x42, 0x28, 0x3a, 0x07, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0x65, 0x29, 0x45, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x81, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x81, 0x18, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x24, 0x29, 0x44, 0x31, 0x85, 0x31, 0xa6, 0x39, 0xc6, 0x3a, 0x07, 0x42, 0x08, 0x42, 0x48, 0x4a, 0x69, 0x4a, 0x89, 0x4a, 0x89, 0x4a, 0x69, 0x52, 0x89, 0x52, 0xaa, 0x52, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xcb, 0x5a, 0xca, 0x5a, 0xcb, 0x5a, 0xcb, 0x52, 0x8a, 0x4a, 0x49, 0x4a, 0x29, 0x42, 0x29, 0x42, 0x08, 0x42, 0x08, 0x41, 0xe8, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0xa7, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xa7, 0x31, 0x45, 0x18, 0xa2, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x29, 0x44, 0x4a, 0x28, 0x42, 0x08, 0x4a, 0x28, 0x42, 0x08, 0x41, 0xe8, 0x42, 0x08, 0x4a, 0x28, 0x4a, 0x29, 0x4a, 0x69, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0xaa, 0x52, 0xab, 0x5a, 0xab, 0x5a, 0xeb, 0x63, 0x0c, 0x63, 0x2c, 0x63, 0x0c, 0x5a, 0xeb, 0x5a, 0xeb, 0x52, 0xcb, 0x52, 0xaa, 0x52, 0x8a, 0x4a, 0x69, 0x4a, 0x49, 0x42, 0x08, 0x39, 0xe7, 0x31, 0xa6, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc2, 0x18, 0xa2, 0x18, 0x61, 0x10, 0x41, 0x10, 0x40, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x81, 0x18, 0xa2, 0x20, 0xc2, 0x20, 0xe3, 0x29, 0x04, 0x29, 0x44, 0x31, 0x65, 0x31, 0x85, 0x39, 0xc6, 0x39, 0xe7, 0x42, 0x08, 0x42, 0x28, 0x42, 0x48, 0x4a, 0x48, 0x4a, 0x69, 0x4a, 0x89, 0x52, 0xca, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5b, 0x0b, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xeb, 0x52, 0xaa, 0x52, 0x6a, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x29, 0x4a, 0x29, 0x42, 0x28, 0x41, 0xe8, 0x41, 0xc7, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0xa7, 0x41, 0xc7, 0x41, 0xc7, 0x41, 0xe8, 0x39, 0xa7, 0x10, 0x82, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x21, 0x24, 0x31, 0x86, 0x52, 0x69, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x29, 0x42, 0x28, 0x4a, 0x29, 0x4a, 0x49, 0x4a, 0x69, 0x52, 0x8a, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x63, 0x0c, 0x63, 0x0c, 0x62, 0xeb, 0x5a, 0xcb, 0x52, 0xaa, 0x52, 0xaa, 0x52, 0x8a, 0x4a, 0x49, 0x4a, 0x28, 0x42, 0x08, 0x39, 0xe7, 0x39, 0xa6, 0x31, 0x85, 0x29, 0x45, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x10, 0x61, 0x10, 0x41, 0x10, 0x40, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x81, 0x18, 0xa2, 0x20, 0xc2, 0x20, 0xe3, 0x29, 0x04, 0x29, 0x44, 0x31, 0x65, 0x31, 0x86, 0x39, 0xa6, 0x39, 0xc7, 0x39, 0xe7, 0x42, 0x07, 0x42, 0x28, 0x4a, 0x69, 0x52, 0x89, 0x52, 0xca, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5b, 0x0b, 0x5b, 0x0b, 0x5a, 0xeb, 0x5a, 0xeb, 0x62, 0xeb, 0x63, 0x0c, 0x5a, 0xeb, 0x5a, 0xab, 0x52, 0x8a, 0x52, 0x6a, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x42, 0x08, 0x41, 0xe8, 0x41, 0xe8, 0x39, 0xc7, 0x41, 0xc7, 0x41, 0xe8, 0x41, 0xe8, 0x41, 0xe8, 0x41, 0xc8, 0x18, 0xc3, 0x21, 0x24, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x18, 0xe3, 0x39, 0xe7, 0x52, 0x8a, 0x4a, 0x69, 0x52, 0x6a, 0x4a, 0x69, 0x4a, 0x49, 0x4a, 0x49, 0x52, 0x6a, 0x52, 0x6a, 0x52, 0xab, 0x52, 0xcb, 0x5a, 0xcb, 0x52, 0xab, 0x5a, 0xab, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xcb, 0x52, 0xaa, 0x52, 0x8a, 0x4a, 0x69, 0x4a, 0x49, 0x42, 0x28, 0x42, 0x07, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0x85, 0x29, 0x45, 0x29, 0x24, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x81, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0xa2, 0x20, 0xc2, 0x20, 0xe3, 0x21, 0x04, 0x29, 0x24, 0x29, 0x45, 0x31, 0x65, 0x31, 0x86, 0x39, 0xc6, 0x39, 0xe7, 0x42, 0x08, 0x4a, 0x49, 0x4a, 0x69, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x5a, 0xeb, 0x5a, 0xab, 0x52, 0xaa, 0x52, 0x8a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x49, 0x42, 0x29, 0x4a, 0x09, 0x42, 0x08, 0x41, 0xe8, 0x41, 0xe8, 0x42, 0x09, 0x42, 0x09, 0x4a, 0x09, 0x4a, 0x29, 0x20, 0xe3, 0x18, 0xa2, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x18, 0xc3, 0x4a, 0x69, 0x5a, 0xcb, 0x52, 0x8a, 0x52, 0xab, 0x52, 0x8a, 0x4a, 0x6a, 0x4a, 0x6a, 0x52, 0x8b, 0x52, 0x8a, 0x52, 0xab, 0x5a, 0xcb, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x52, 0xaa, 0x52, 0xaa, 0x5a, 0xcb, 0x5a, 0xab, 0x52, 0x8a, 0x4a, 0x49, 0x4a, 0x28, 0x42, 0x08, 0x39, 0xe8, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x04, 0x29, 0x44, 0x31, 0x65, 0x31, 0xa6, 0x39, 0xc7, 0x42, 0x07, 0x42, 0x28, 0x4a, 0x49, 0x4a, 0x69, 0x52, 0x8a, 0x52, 0xaa, 0x5a, 0xcb, 0x5a, 0xeb, 0x5a, 0xeb, 0x5a, 0xeb, 0x63, 0x0c, 0x63, 0x2c, 0x63, 0x0c, 0x5a, 0xeb, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0xab, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x4a, 0x6a, 0x4a, 0x49, 0x4a, 0x29, 0x4a, 0x29, 0x42, 0x08, 0x42, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x4a, 0x29, 0x25, 0x10, 0x81, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x18, 0xa2, 0x52, 0x8a, 0x5a, 0xec, 0x5a, 0xab, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0xab, 0x52, 0x8b, 0x52, 0xab, 0x5a, 0xcb, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0x8b, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x6a, 0x52, 0x6a, 0x52, 0x8a, 0x52, 0x69, 0x4a, 0x28, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xa7, 0x31, 0x86, 0x31, 0x65, 0x29, 0x24, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x81, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x40, 0x10, 0x41, 0x18, 0x61, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xc3, 0x21, 0x03, 0x29, 0x24, 0x29, 0x45, 0x31, 0x85, 0x39, 0xa6, 0x39, 0xe7, 0x42, 0x07, 0x42, 0x28, 0x4a, 0x49, 0x4a, 0x69, 0x52, 0x8a, 0x52, 0xaa, 0x52, 0xca, 0x5a, 0xcb, 0x5a, 0xeb, 0x63, 0x0c, 0x63, 0x0c, 0x63, 0x0c, 0x5a, 0xeb, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x4a, 0x6a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x42, 0x29, 0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x6a, 0x4a, 0x4a, 0x52, 0x6a, 0x31, 0x45, 0x08, 0x61, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x18, 0xc2, 0x52, 0xab, 0x63, 0x2d, 0x5a, 0xcc, 0x5a, 0xcc, 0x5a, 0xab, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8b, 0x52, 0xab, 0x52, 0x8b, 0x52, 0xab, 0x52, 0xab, 0x52, 0x8b, 0x52, 0x6a, 0x4a, 0x6a, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x28, 0x42, 0x08, 0x41, 0xc7, 0x39, 0xa6, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x28, 0xe4, 0x20, 0xc3, 0x20, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xc2, 0x20, 0xc3, 0x29, 0x03, 0x29, 0x24, 0x31, 0x45, 0x31, 0x85, 0x39, 0xa6, 0x39, 0xc7, 0x41, 0xe7, 0x42, 0x28, 0x4a, 0x48, 0x4a, 0x69, 0x52, 0x69, 0x52, 0xaa, 0x5a, 0xca, 0x5a, 0xeb, 0x63, 0x0c, 0x62, 0xeb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xab, 0x52, 0xab, 0x52, 0xab, 0x52, 0xcb, 0x52, 0xab, 0x52, 0x8a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x4a, 0x52, 0x6a, 0x52, 0x6a, 0x52, 0x6a, 0x5a, 0xab, 0x31, 0x65, 0x08, 0x40, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x18, 0xc2, 0x52, 0xab, 0x6b, 0x4d, 0x5a, 0xec, 0x5a, 0xec, 0x5a, 0xcc, 0x52, 0x8b, 0x52, 0x8a, 0x52, 0x8b, 0x52, 0x8b, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x4a, 0x4a, 0x4a, 0x49, 0x4a, 0x29, 0x42, 0x08, 0x42, 0x08, 0x41, 0xe7, 0x41, 0xe7, 0x39, 0xc7, 0x39, 0xa6, 0x31, 0x65, 0x31, 0x25, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x28, 0xe3, 0x29, 0x24, 0x29, 0x45, 0x31, 0x65, 0x39, 0xa6, 0x39, 0xc7, 0x39, 0xe7, 0x42, 0x08, 0x4a, 0x28, 0x4a, 0x49, 0x52, 0x89, 0x5a, 0xaa, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xcb, 0x5a, 0xab, 0x52, 0xab, 0x5a, 0xab, 0x5a, 0xab, 0x52, 0xab, 0x5a, 0xcb, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x6a, 0x4a, 0x6a, 0x4a, 0x4a, 0x52, 0x6a, 0x52, 0x8b, 0x52, 0x8b, 0x52, 0xab, 0x5a, 0xcb, 0x31, 0x65, 0x08, 0x40, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x10, 0xa2, 0x52, 0xab, 0x6b, 0x6e, 0x63, 0x0c, 0x62, 0xed, 0x5a, 0xcc, 0x52, 0xab, 0x52, 0x6a, 0x52, 0x8a, 0x52, 0x8a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x49, 0x42, 0x28, 0x41, 0xe8, 0x41, 0xe8, 0x39, 0xc7, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x66, 0x31, 0x45, 0x31, 0x25, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x81, 0x10, 0x61, 0x10, 0x41, 0x10, 0x40, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x20, 0xe4, 0x29, 0x04, 0x29, 0x45, 0x31, 0x65, 0x31, 0x86, 0x39, 0xa6, 0x41, 0xe7, 0x42, 0x08, 0x4a, 0x28, 0x52, 0x69, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x5a, 0xab, 0x5a, 0xcb, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0x8b, 0x52, 0x8b, 0x52, 0x8a, 0x4a, 0x6a, 0x52, 0x6a, 0x52, 0x8b, 0x5a, 0xab, 0x5a, 0xab, 0x5a, 0xcc, 0x5a, 0xec, 0x29, 0x45, 0x08, 0x40, 0x39, 0xc6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xc7, 0x10, 0x82, 0x4a, 0x6a, 0x73, 0x8f, 0x63, 0x0d, 0x62, 0xec, 0x5a, 0xcc, 0x52, 0xab, 0x52, 0x6a, 0x4a, 0x6a, 0x4a, 0x6a, 0x4a, 0x4a, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x29, 0x42, 0x29, 0x41, 0xe8, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0x86, 0x31, 0x66, 0x31, 0x45, 0x29, 0x24, 0x29, 0x04, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x61, 0x18, 0x61, 0x10, 0x41, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x04, 0x31, 0x24, 0x31, 0x65, 0x39, 0x86, 0x39, 0xa7, 0x41, 0xe7, 0x42, 0x08, 0x4a, 0x28, 0x4a, 0x28, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x69, 0x52, 0x6a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0xab, 0x52, 0xab, 0x5a, 0xcb, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x52, 0xab, 0x52, 0x8a, 0x52, 0x6a, 0x52, 0x8b, 0x5a, 0xab, 0x5a, 0xcc, 0x5a, 0xcb, 0x63, 0x0d, 0x5a, 0xcc, 0x21, 0x04, 0x08, 0x40, 0x39, 0xc7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x10, 0x82, 0x39, 0xe7, 0x6b, 0x4e, 0x63, 0x2d, 0x5a, 0xec, 0x5a, 0xcc, 0x52, 0xab, 0x4a, 0x6a, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x29, 0x42, 0x29, 0x42, 0x08, 0x41, 0xe8, 0x41, 0xe8, 0x39, 0xc7, 0x39, 0xa7, 0x31, 0x86, 0x31, 0x65, 0x29, 0x45, 0x29, 0x04, 0x29, 0x04, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x18, 0x61, 0x10, 0x41, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x28, 0xe3, 0x29, 0x04, 0x31, 0x24, 0x31, 0x65, 0x39, 0x86, 0x39, 0xa6, 0x39, 0xc7, 0x41, 0xe7, 0x41, 0xe7, 0x42, 0x08, 0x4a, 0x29, 0x4a, 0x29, 0x4a, 0x49, 0x4a, 0x6a, 0x52, 0x6a, 0x52, 0x8b, 0x52, 0xab, 0x52, 0xab, 0x52, 0x8b, 0x52, 0xab, 0x52, 0xab, 0x52, 0x8b, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0xab, 0x5a, 0xcc, 0x5a, 0xec, 0x5a, 0xec, 0x63, 0x2d, 0x52, 0x8b, 0x18, 0xc3, 0x08, 0x61, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x10, 0x81, 0x31, 0x66, 0x63, 0x0d, 0x6b, 0x4e, 0x5a, 0xcc, 0x5a, 0xcc, 0x52, 0x8b, 0x4a, 0x4a, 0x4a, 0x29, 0x42, 0x09, 0x42, 0x09, 0x41, 0xe8, 0x41, 0xc8, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0x87, 0x31, 0x86, 0x31, 0x65, 0x29, 0x25, 0x29, 0x04, 0x20, 0xe4, 0x20, 0xc3, 0x20, 0xa2, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x04, 0x29, 0x24, 0x31, 0x45, 0x31, 0x65, 0x31, 0x86, 0x39, 0xa6, 0x39, 0xc7, 0x41, 0xe7, 0x41, 0xe8, 0x42, 0x08, 0x4a, 0x29, 0x4a, 0x49, 0x4a, 0x6a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x8b, 0x52, 0x8b, 0x52, 0x8b, 0x52, 0x8a, 0x52, 0xab, 0x5a, 0xcc, 0x5a, 0xec, 0x5a, 0xec, 0x63, 0x0d, 0x63, 0x2d, 0x4a, 0x29, 0x10, 0x61, 0x10, 0x81, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x20, 0xe3, 0x18, 0xc2, 0x52, 0x8a, 0x6b, 0x4e, 0x5a, 0xcc, 0x52, 0xab, 0x52, 0x8b, 0x4a, 0x4a, 0x4a, 0x29, 0x41, 0xe8, 0x41, 0xc8, 0x39, 0xc7, 0x39, 0xa7, 0x39, 0x86, 0x31, 0x66, 0x31, 0x66, 0x29, 0x45, 0x29, 0x25, 0x29, 0x04, 0x20, 0xe4, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x62, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x81, 0x18, 0xa2, 0x20, 0xa3, 0x20, 0xc3, 0x28, 0xe3, 0x29, 0x04, 0x29, 0x24, 0x31, 0x45, 0x31, 0x66, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xc7, 0x41, 0xe8, 0x42, 0x08, 0x4a, 0x29, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x4a, 0x52, 0x6a, 0x52, 0x8a, 0x52, 0x8a, 0x52, 0x6a, 0x52, 0x8b, 0x5a, 0xcb, 0x5a, 0xec, 0x63, 0x0d, 0x62, 0xed, 0x6b, 0x4e, 0x6b, 0x4d, 0x31, 0x86, 0x00, 0x00, 0x21, 0x04, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x29, 0x65, 0x10, 0x61, 0x39, 0xa7, 0x5a, 0xec, 0x62, 0xec, 0x52, 0x8b, 0x52, 0x6a, 0x4a, 0x49, 0x42, 0x09, 0x41, 0xc8, 0x39, 0xa7, 0x39, 0xa7, 0x31, 0x86, 0x31, 0x66, 0x29, 0x45, 0x29, 0x25, 0x29, 0x04, 0x20, 0xe4, 0x20, 0xe3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x82, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x04, 0x29, 0x24, 0x29, 0x45, 0x31, 0x65, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xc7, 0x41, 0xe8, 0x42, 0x08, 0x42, 0x08, 0x42, 0x29, 0x4a, 0x29, 0x4a, 0x49, 0x4a, 0x4a, 0x4a, 0x6a, 0x4a, 0x6a, 0x52, 0x6a, 0x52, 0xab, 0x5a, 0xcc, 0x62, 0xed, 0x62, 0xec, 0x63, 0x2d, 0x6b, 0x8f, 0x52, 0x8a, 0x20, 0xe3, 0x08, 0x20, 0x31, 0x85, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x10, 0x81, 0x21, 0x04, 0x42, 0x29, 0x5a, 0xcc, 0x52, 0x8b, 0x4a, 0x4a, 0x4a, 0x29, 0x41, 0xe8, 0x39, 0xc7, 0x39, 0x87, 0x31, 0x66, 0x31, 0x65, 0x29, 0x45, 0x29, 0x04, 0x29, 0x04, 0x20, 0xe4, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x82, 0x18, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x62, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x29, 0x04, 0x29, 0x24, 0x29, 0x45, 0x31, 0x65, 0x31, 0x86, 0x39, 0x87, 0x39, 0xa7, 0x39, 0xc7, 0x39, 0xe8, 0x42, 0x08, 0x42, 0x09, 0x4a, 0x29, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x4a, 0x52, 0x8a, 0x5a, 0xab, 0x5a, 0xec, 0x5a, 0xec, 0x63, 0x0d, 0x6b, 0x6e, 0x63, 0x0c, 0x39, 0xa7, 0x08, 0x40, 0x10, 0x81, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x29, 0x45, 0x08, 0x61, 0x29, 0x65, 0x4a, 0x4a, 0x52, 0x6a, 0x4a, 0x29, 0x42, 0x08, 0x41, 0xe8, 0x39, 0xa7, 0x31, 0x86, 0x31, 0x45, 0x29, 0x25, 0x29, 0x04, 0x20, 0xe4, 0x20, 0xc3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x62, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x62, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x21, 0x04, 0x29, 0x04, 0x29, 0x25, 0x29, 0x45, 0x31, 0x65, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xa7, 0x41, 0xc8, 0x41, 0xe8, 0x42, 0x08, 0x42, 0x08, 0x4a, 0x29, 0x4a, 0x4a, 0x52, 0x8b, 0x5a, 0xab, 0x5a, 0xcc, 0x5a, 0xec, 0x6b, 0x4e, 0x6b, 0x4e, 0x4a, 0x6a, 0x18, 0xa2, 0x00, 0x20, 0x29, 0x65, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x18, 0xe3, 0x10, 0x82, 0x29, 0x65, 0x4a, 0x29, 0x4a, 0x29, 0x41, 0xe8, 0x39, 0xa7, 0x39, 0x86, 0x31, 0x66, 0x29, 0x25, 0x29, 0x04, 0x20, 0xe4, 0x20, 0xc3, 0x18, 0xa3, 0x18, 0x82, 0x18, 0x82, 0x18, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x62, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xa3, 0x20, 0xc3, 0x20, 0xe4, 0x29, 0x04, 0x29, 0x24, 0x29, 0x45, 0x31, 0x66, 0x31, 0x66, 0x39, 0x86, 0x39, 0xa7, 0x39, 0xc7, 0x41, 0xc8, 0x42, 0x08, 0x4a, 0x29, 0x4a, 0x6a, 0x52, 0x8b, 0x52, 0xab, 0x5a, 0xcb, 0x63, 0x2d, 0x6b, 0x4d, 0x4a, 0x6a, 0x21, 0x04, 0x08, 0x20, 0x18, 0xc3, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x10, 0x82, 0x18, 0xc2, 0x29, 0x45, 0x39, 0xa7, 0x41, 0xc8, 0x39, 0xa7, 0x31, 0x66, 0x31, 0x45, 0x29, 0x04, 0x28, 0xe4, 0x20, 0xc3, 0x20, 0xa3, 0x18, 0x82, 0x18, 0x82, 0x10, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xa3, 0x20, 0xc3, 0x20, 0xe3, 0x28, 0xe4, 0x29, 0x04, 0x29, 0x25, 0x31, 0x45, 0x31, 0x66, 0x31, 0x86, 0x39, 0xa7, 0x41, 0xc8, 0x42, 0x08, 0x4a, 0x29, 0x4a, 0x4a, 0x52, 0x6a, 0x52, 0xab, 0x5a, 0xec, 0x62, 0xec, 0x4a, 0x29, 0x29, 0x45, 0x08, 0x40, 0x08, 0x41, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x31, 0x85, 0x10, 0x82, 0x10, 0xa2, 0x29, 0x24, 0x31, 0x66, 0x31, 0x66, 0x31, 0x45, 0x29, 0x04, 0x28, 0xe4, 0x20, 0xc3, 0x20, 0xc3, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xe4, 0x29, 0x04, 0x29, 0x25, 0x31, 0x65, 0x31, 0x86, 0x39, 0xa7, 0x39, 0xc8, 0x41, 0xe8, 0x4a, 0x09, 0x4a, 0x29, 0x52, 0x6a, 0x5a, 0xab, 0x52, 0x8a, 0x42, 0x28, 0x29, 0x24, 0x08, 0x20, 0x08, 0x61, 0x31, 0x85, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0x86, 0x18, 0xa2, 0x10, 0x81, 0x18, 0xc3, 0x29, 0x04, 0x29, 0x04, 0x28, 0xe4, 0x20, 0xc3, 0x20, 0xa3, 0x18, 0xa2, 0x18, 0x82, 0x18, 0x61, 0x10, 0x61, 0x10, 0x41, 0x10, 0x21, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x10, 0x61, 0x18, 0x82, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x20, 0xe4, 0x29, 0x04, 0x29, 0x25, 0x31, 0x45, 0x31, 0x66, 0x39, 0x86, 0x39, 0xa7, 0x41, 0xc8, 0x42, 0x09, 0x4a, 0x4a, 0x52, 0x6a, 0x4a, 0x29, 0x31, 0x86, 0x18, 0xa2, 0x08, 0x20, 0x10, 0x81, 0x31, 0x86, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x31, 0xa6, 0x18, 0xe3, 0x10, 0x81, 0x18, 0xa2, 0x18, 0xa2, 0x20, 0xa3, 0x20, 0xa2, 0x18, 0x82, 0x18, 0x62, 0x18, 0x61, 0x10, 0x41, 0x10, 0x41, 0x10, 0x20, 0x10, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x10, 0x61, 0x18, 0x62, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xc3, 0x20, 0xc3, 0x28, 0xe4, 0x29, 0x04, 0x29, 0x25, 0x31, 0x45, 0x39, 0x86, 0x39, 0xa7, 0x41, 0xe8, 0x41, 0xe8, 0x39, 0xc7, 0x31, 0x65, 0x21, 0x04, 0x10, 0x82, 0x08, 0x20, 0x18, 0xc2, 0x31, 0xa6, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x29, 0x65, 0x18, 0xc2, 0x10, 0x81, 0x10, 0x82, 0x10, 0x82, 0x18, 0x82, 0x18, 0x61, 0x10, 0x41, 0x10, 0x21, 0x10, 0x20, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x20, 0x10, 0x41, 0x10, 0x41, 0x18, 0x61, 0x18, 0x62, 0x18, 0x82, 0x20, 0xa2, 0x20, 0xc3, 0x20, 0xe3, 0x28, 0xe4, 0x29, 0x04, 0x31, 0x25, 0x31, 0x45, 0x31, 0x65, 0x29, 0x45, 0x29, 0x24, 0x20, 0xe3, 0x10, 0x82, 0x08, 0x20, 0x10, 0x81, 0x29, 0x44, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x29, 0x65, 0x18, 0xe3, 0x10, 0x82, 0x10, 0x82, 0x10, 0x81, 0x10, 0x61, 0x10, 0x41, 0x10, 0x20, 0x08, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x20, 0x10, 0x21, 0x10, 0x41, 0x18, 0x41, 0x18, 0x62, 0x18, 0x82, 0x18, 0xa2, 0x20, 0xa3, 0x20, 0xc3, 0x20, 0xe3, 0x20, 0xc3, 0x20, 0xc3, 0x18, 0xa2, 0x10, 0x82, 0x08, 0x61, 0x08, 0x40, 0x10, 0xa2, 0x29, 0x45, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x08, 0x31, 0xa6, 0x29, 0x45, 0x18, 0xe3, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x81, 0x10, 0x81, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x61, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x81, 0x10, 0x61, 0x10, 0x81, 0x18, 0xc3, 0x21, 0x24, 0x31, 0xa6, 0x42, 0x08, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x39, 0xe7, 0x31, 0xa6, 0x29, 0x65, 0x29, 0x44, 0x21, 0x04, 0x18, 0xe3, 0x18, 0xc3, 0x10, 0xa2, 0x10, 0xa2, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0xa2, 0x10, 0xa2, 0x18, 0xc2, 0x18, 0xe3, 0x18, 0xe3, 0x21, 0x24, 0x29, 0x65, 0x31, 0xa6, 0x39, 0xe7, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+  0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 
+
 #elif LV_COLOR_DEPTH == 24
 /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
 
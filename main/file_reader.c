@@ -0,0 +1,149 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "file_reader.h"
+
+#ifndef min
+  #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+static const char *TAG = "READER";
+
+static void taskReader(void *parameter) {
+  fileReader_t *r = parameter;
+  int idx;
+  //the first read ends on a sector boundary, every read after it is aligned
+  size_t want = READER_BUF_SIZE - r->offset % READER_SECTOR_SIZE;
+  fseek(r->file, r->offset, SEEK_SET);
+  while(r->stop == false) {
+    if(xQueueReceive(r->freeQ, &idx, 20 / portTICK_RATE_MS) != pdPASS) continue;
+    r->lens[idx] = fread(r->bufs[idx], 1, want, r->file);
+    want = READER_BUF_SIZE;
+    xQueueSend(r->fullQ, &idx, portMAX_DELAY);
+    if(r->lens[idx] == 0) break; //an empty buffer marks the end of file
+  }
+  xSemaphoreGive(r->done);
+  vTaskDelete(NULL);
+}
+
+static void reader_free(fileReader_t *r) {
+  for(int i = 0; i < READER_BUF_COUNT; ++i) free(r->bufs[i]);
+  free(r->bounce);
+  if(r->freeQ != NULL) vQueueDelete(r->freeQ);
+  if(r->fullQ != NULL) vQueueDelete(r->fullQ);
+  if(r->done != NULL) vSemaphoreDelete(r->done);
+  free(r);
+}
+
+fileReader_t *reader_open(FILE *file, size_t offset) {
+  if(file == NULL) return NULL;
+  fileReader_t *r = calloc(1, sizeof(fileReader_t));
+  if(r == NULL) return NULL;
+  r->file = file;
+  r->offset = offset;
+  r->cur = -1;
+  for(int i = 0; i < READER_BUF_COUNT; ++i) {
+    //dma capable buffers let fatfs transfer whole sectors without bouncing
+    r->bufs[i] = heap_caps_malloc(READER_BUF_SIZE, MALLOC_CAP_DMA);
+    if(r->bufs[i] == NULL) r->bufs[i] = malloc(READER_BUF_SIZE);
+    if(r->bufs[i] == NULL) goto fail;
+  }
+  r->bounce = malloc(READER_BOUNCE_SIZE);
+  r->freeQ = xQueueCreate(READER_BUF_COUNT, sizeof(int));
+  r->fullQ = xQueueCreate(READER_BUF_COUNT, sizeof(int));
+  r->done = xSemaphoreCreateBinary();
+  if(r->bounce == NULL || r->freeQ == NULL || r->fullQ == NULL || r->done == NULL)
+    goto fail;
+  for(int i = 0; i < READER_BUF_COUNT; ++i) xQueueSend(r->freeQ, &i, 0);
+  if(xTaskCreatePinnedToCore(taskReader,"READER",3000,r,(portPRIVILEGE_BIT | 4),NULL,1) != pdPASS)
+    goto fail;
+  return r;
+fail:
+  ESP_LOGE(TAG, "Failed to start read-ahead reader");
+  reader_free(r);
+  return NULL;
+}
+
+/* hand the current buffer back to the reader task and wait for the next one */
+static bool next_chunk(fileReader_t *r) {
+  int idx;
+  if(r->cur >= 0) xQueueSend(r->freeQ, &r->cur, 0);
+  r->cur = -1;
+  r->curPos = 0;
+  if(r->eof == true) return false;
+  xQueueReceive(r->fullQ, &idx, portMAX_DELAY);
+  if(r->lens[idx] == 0) {
+    r->eof = true;
+    xQueueSend(r->freeQ, &idx, 0);
+    return false;
+  }
+  r->cur = idx;
+  return true;
+}
+
+/* returns at least want contiguous bytes unless the file ends first. the
+ * data stays valid until reader_release() */
+size_t reader_borrow(fileReader_t *r, uint8_t **data, size_t want) {
+  if(want > READER_BOUNCE_SIZE / 2) want = READER_BOUNCE_SIZE / 2;
+  if(r->inBounce == false) {
+    size_t avail = r->cur < 0 ? 0 : r->lens[r->cur] - r->curPos;
+    if(avail >= want) {
+      *data = r->bufs[r->cur] + r->curPos;
+      return avail;
+    }
+    if(avail > 0) memcpy(r->bounce, r->bufs[r->cur] + r->curPos, avail);
+    r->bounceOld = avail;
+    r->bounceNew = 0;
+    if(next_chunk(r) == false) {
+      r->inBounce = avail > 0;
+      *data = avail > 0 ? r->bounce : NULL;
+      return avail;
+    }
+    if(avail == 0) {
+      *data = r->bufs[r->cur];
+      return r->lens[r->cur];
+    }
+    r->inBounce = true;
+  }
+  size_t have = r->bounceOld + r->bounceNew;
+  if(have < want && r->cur >= 0) {
+    size_t n = min(want - have, r->lens[r->cur] - r->bounceNew);
+    memcpy(r->bounce + have, r->bufs[r->cur] + r->bounceNew, n);
+    r->bounceNew += n;
+  }
+  *data = r->bounce;
+  return r->bounceOld + r->bounceNew;
+}
+
+void reader_release(fileReader_t *r, size_t used) {
+  r->consumed += used;
+  if(r->inBounce == true) {
+    if(used >= r->bounceOld) {
+      r->curPos = used - r->bounceOld;
+      r->inBounce = false;
+    } else {
+      memmove(r->bounce, r->bounce + used, r->bounceOld + r->bounceNew - used);
+      r->bounceOld -= used;
+    }
+    return;
+  }
+  r->curPos += used;
+}
+
+size_t reader_tell(fileReader_t *r) {
+  return r->offset + r->consumed;
+}
+
+void reader_close(fileReader_t *r) {
+  if(r == NULL) return;
+  r->stop = true;
+  xSemaphoreTake(r->done, portMAX_DELAY);
+  reader_free(r);
+}
@@ -0,0 +1,35 @@
+#ifndef _FILE_READER_H_
+#define _FILE_READER_H_
+
+#define READER_SECTOR_SIZE 512
+#define READER_BUF_COUNT 4
+#define READER_BUF_SIZE (16 * READER_SECTOR_SIZE)
+#define READER_BOUNCE_SIZE (2 * 4096) //max borrow size is half of it
+
+/* read-ahead reader, a background task keeps READER_BUF_COUNT sector aligned
+ * buffers filled while the decoder borrows data straight out of them. */
+typedef struct {
+  FILE *file;
+  size_t offset, consumed;
+  uint8_t *bufs[READER_BUF_COUNT];
+  size_t lens[READER_BUF_COUNT];
+  QueueHandle_t freeQ, fullQ;
+  SemaphoreHandle_t done;
+  volatile bool stop;
+  bool eof;
+  int cur;
+  size_t curPos;
+  //data spanning two buffers is stitched here: bounceOld bytes from the
+  //previous buffer followed by bounceNew bytes from the start of cur
+  uint8_t *bounce;
+  size_t bounceOld, bounceNew;
+  bool inBounce;
+} fileReader_t;
+
+//file must be unbuffered (setvbuf _IONBF right after fopen)
+fileReader_t *reader_open(FILE *file, size_t offset);
+size_t reader_borrow(fileReader_t *r, uint8_t **data, size_t want);
+void reader_release(fileReader_t *r, size_t used);
+size_t reader_tell(fileReader_t *r);
+void reader_close(fileReader_t *r);
+#endif
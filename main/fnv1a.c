@@ -0,0 +1,7 @@
+#include "fnv1a.h"
+
+uint32_t fnv1a(uint32_t hash, const void *data, size_t len) {
+  const uint8_t *p = data;
+  for(size_t i = 0; i < len; ++i) hash = (hash ^ p[i]) * 16777619u;
+  return hash;
+}
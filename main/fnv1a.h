@@ -0,0 +1,12 @@
+#ifndef _FNV1A_H_
+#define _FNV1A_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FNV1A_INIT 2166136261u
+
+/* 32-bit FNV-1a of len bytes, chained: pass FNV1A_INIT or a previous hash */
+uint32_t fnv1a(uint32_t hash, const void *data, size_t len);
+
+#endif
@@ -0,0 +1,49 @@
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "gain.h"
+
+static int32_t gainCur = -1, gainTarget, gainStep;
+
+int32_t gain_from_db(int db) {
+  if(db >= 0) return GAIN_UNITY;
+  return (int32_t)(pow(10, db / 20.0) * GAIN_UNITY + 0.5);
+}
+
+/* gain never exceeds unity so the products below can't overflow int16 */
+static inline int16_t scale(int32_t s, int32_t g) {
+  return (int16_t)((s * g) >> GAIN_Q);
+}
+
+/* constant gain. below unity the gain fits 16 bits, a 16x16 multiply is
+ * MUL16S on the ESP32 and vectorizes on hosts */
+static void apply_flat(int16_t *buf, int samples, int32_t g) {
+  if(g == GAIN_UNITY) return;
+  if(g == 0) {
+    memset(buf, 0, samples * sizeof(int16_t));
+    return;
+  }
+  int16_t g16 = g;
+  for(int i = 0; i < samples; ++i) buf[i] = (int16_t)((buf[i] * g16) >> GAIN_Q);
+}
+
+void gain_apply_s16(int16_t *buf, int frames, int channels, int32_t target) {
+  if(target > GAIN_UNITY) target = GAIN_UNITY;
+  if(target < 0) target = 0;
+  if(gainCur < 0) gainCur = gainTarget = target;
+  if(target != gainTarget) {
+    gainTarget = target;
+    gainStep = (target - gainCur) / GAIN_RAMP_FRAMES;
+    if(gainStep == 0) gainStep = target > gainCur ? 1 : -1;
+  }
+  while(gainCur != gainTarget && frames > 0) {
+    gainCur += gainStep;
+    if((gainStep > 0 && gainCur > gainTarget) || (gainStep < 0 && gainCur < gainTarget))
+      gainCur = gainTarget;
+    for(int c = 0; c < channels; ++c) buf[c] = scale(buf[c], gainCur);
+    buf += channels;
+    frames--;
+  }
+  if(frames > 0) apply_flat(buf, frames * channels, gainCur);
+}
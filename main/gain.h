@@ -0,0 +1,17 @@
+#ifndef _GAIN_H_
+#define _GAIN_H_
+
+#include <stdint.h>
+
+#define GAIN_Q 15
+#define GAIN_UNITY (1 << GAIN_Q) //0dB
+#define GAIN_RAMP_FRAMES 512 //about 12ms at 44.1kHz
+#define GAIN_BENCH_FRAMES 1152 //one MP3 frame
+#define GAIN_BENCH_ROUNDS 50
+
+/* fixed-point volume stage. gain changes are ramped linearly over
+ * GAIN_RAMP_FRAMES frames so volume steps don't click. */
+int32_t gain_from_db(int db);
+void gain_apply_s16(int16_t *buf, int frames, int channels, int32_t target);
+void gain_bench(void);
+#endif
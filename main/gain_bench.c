@@ -0,0 +1,61 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "xtensa/core-macros.h"
+#include "esp_log.h"
+
+#include "gain.h"
+
+static const char *TAG = "GAIN_BENCH";
+
+/* what setVolume() used to do to every sample */
+static void volume_double(int16_t *buf, int samples, double multiplier) {
+  for(int i = 0; i < samples; ++i)
+    buf[i] *= multiplier;
+}
+
+/* cycles per sample at -25dB, the best of GAIN_BENCH_ROUNDS. every round
+ * scales a fresh copy of the same noise, the copy is timed on its own and
+ * taken off */
+void gain_bench(void) {
+  int n = GAIN_BENCH_FRAMES * 2;
+  int16_t *src = malloc(n * sizeof(int16_t)), *buf = malloc(n * sizeof(int16_t));
+  uint32_t t, copy = UINT32_MAX, before = UINT32_MAX, after = UINT32_MAX;
+  if(src == NULL || buf == NULL) {
+    ESP_LOGE(TAG, "No memory");
+    free(src);
+    free(buf);
+    return;
+  }
+  srand(1);
+  for(int i = 0; i < n; ++i) src[i] = (int16_t)(rand() & 0xFFFF);
+  double multiplier = pow(10, -25 / 20.0);
+  int32_t gain = gain_from_db(-25);
+  memcpy(buf, src, n * sizeof(int16_t));
+  gain_apply_s16(buf, GAIN_BENCH_FRAMES, 2, gain); //no ramp in the timed calls
+  for(int r = 0; r < GAIN_BENCH_ROUNDS; ++r) {
+    t = XTHAL_GET_CCOUNT();
+    memcpy(buf, src, n * sizeof(int16_t));
+    t = XTHAL_GET_CCOUNT() - t;
+    if(t < copy) copy = t;
+
+    t = XTHAL_GET_CCOUNT();
+    memcpy(buf, src, n * sizeof(int16_t));
+    volume_double(buf, n, multiplier);
+    t = XTHAL_GET_CCOUNT() - t;
+    if(t < before) before = t;
+
+    t = XTHAL_GET_CCOUNT();
+    memcpy(buf, src, n * sizeof(int16_t));
+    gain_apply_s16(buf, GAIN_BENCH_FRAMES, 2, gain);
+    t = XTHAL_GET_CCOUNT() - t;
+    if(t < after) after = t;
+  }
+  ESP_LOGI(TAG, "double multiply: %.2f cycles/sample", (double)(before - copy) / n);
+  ESP_LOGI(TAG, "Q15 gain stage: %.2f cycles/sample", (double)(after - copy) / n);
+  free(src);
+  free(buf);
+}
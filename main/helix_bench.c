@@ -0,0 +1,58 @@
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xtensa/core-macros.h"
+#include "esp_log.h"
+#include "coder.h"
+
+#include "helix_bench.h"
+
+static const char *TAG = "HELIX_BENCH";
+
+/* cycles of the two kernels that dominate decoding, the best of
+ * HELIX_BENCH_ROUNDS so interrupts don't count. build once as is and once
+ * with CONFIG_HELIX_PORTABLE_PRIMITIVES to see what the Xtensa primitives in
+ * assembly.h buy */
+void helix_kernel_bench() {
+  MP3DecInfo *dec = (MP3DecInfo *)MP3InitDecoder();
+  static short pcm[2 * NBANDS];
+  uint32_t t, poly = UINT32_MAX, imdct = UINT32_MAX;
+  if(dec == NULL) {
+    ESP_LOGE(TAG, "Decoder init failed");
+    return;
+  }
+  FrameHeader *fh = dec->FrameHeaderPS;
+  HuffmanInfo *hi = dec->HuffmanInfoPS;
+  SubbandInfo *sbi = dec->SubbandInfoPS;
+  srand(1);
+  for(int i = 0; i < MAX_NCHAN * VBUF_LENGTH; ++i) sbi->vbuf[i] = (rand() & 0xFFFFF) - 0x80000;
+  //one granule of long blocks, every subband goes through IMDCT36
+  fh->ver = MPEG1;
+  fh->sfBand = &sfBandTable[MPEG1][0];
+  for(int r = 0; r < HELIX_BENCH_ROUNDS; ++r) {
+    for(int i = 0; i < MAX_NSAMP; ++i) hi->huffDecBuf[0][i] = (rand() & 0xFFFF) - 0x8000;
+    hi->nonZeroBound[0] = MAX_NSAMP;
+    hi->gb[0] = 15;
+
+    t = XTHAL_GET_CCOUNT();
+    PolyphaseStereo(pcm, sbi->vbuf, polyCoef);
+    t = XTHAL_GET_CCOUNT() - t;
+    if(t < poly) poly = t;
+
+    t = XTHAL_GET_CCOUNT();
+    IMDCT(dec, 0, 0);
+    t = XTHAL_GET_CCOUNT() - t;
+    if(t < imdct) imdct = t;
+  }
+#ifdef CONFIG_HELIX_PORTABLE_PRIMITIVES
+  ESP_LOGI(TAG, "Portable C primitives");
+#else
+  ESP_LOGI(TAG, "Xtensa primitives");
+#endif
+  ESP_LOGI(TAG, "PolyphaseStereo: %u cycles per 32 stereo samples", (unsigned)poly);
+  ESP_LOGI(TAG, "IMDCT (32 x IMDCT36): %u cycles per granule", (unsigned)imdct);
+  MP3FreeDecoder(dec);
+}
@@ -0,0 +1,7 @@
+#ifndef _HELIX_BENCH_H_
+#define _HELIX_BENCH_H_
+
+#define HELIX_BENCH_ROUNDS 200
+
+void helix_kernel_bench();
+#endif
@@ -0,0 +1,119 @@
+#include "sdkconfig.h"
+#ifdef CONFIG_HELIX_STALL_PROFILE
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xtensa/core-macros.h"
+#include "esp_log.h"
+#include "mp3common.h"
+
+static const char *TAG = "HELIX_STALL";
+
+#define HELIX_STALL_FRAMES 500 //frames averaged per report
+
+/* Xtensa performance monitor, reached through the ERI bus. the ESP32 cores
+ * have no Xtensa caches, a flash cache miss holds the instruction or data
+ * bus and shows up as a busy stall */
+#define ERI_PM_PGM 0x101000
+#define ERI_PM_COUNT(n) (0x101080 + 4 * (n))
+#define ERI_PM_CTRL(n) (0x101100 + 4 * (n))
+#define PM_PGM_ENABLE 0x1
+#define PM_CTRL_KRNLCNT 0x8 //count at every interrupt level
+#define PM_EVENT_D_STALL 3
+#define PM_EVENT_I_STALL 4
+#define PM_MASK_D_STALL 0x38 //cache miss, busy, in PIF
+#define PM_MASK_I_STALL 0x07 //cache miss, busy, in PIF
+
+#define PM_ISTALL 0
+#define PM_DSTALL 1
+
+typedef struct {
+  uint32_t cycles, istall, dstall;
+} stallSample_t;
+
+typedef struct {
+  uint64_t cycles, istall, dstall;
+} stallSum_t;
+
+static stallSum_t stages[PROFILE_STAGES];
+static stallSample_t last[portNUM_PROCESSORS];
+static bool started[portNUM_PROCESSORS];
+static uint32_t frames;
+static portMUX_TYPE stallMux = portMUX_INITIALIZER_UNLOCKED;
+static const char *stageNames[PROFILE_STAGES] = {
+  "frame", "huffman", "dequant", "imdct", "subband"
+};
+
+static inline uint32_t eri_get(uint32_t addr) {
+  uint32_t v;
+  __asm__ __volatile__ ("rer %0, %1" : "=r"(v) : "r"(addr));
+  return v;
+}
+
+static inline void eri_set(uint32_t addr, uint32_t v) {
+  __asm__ __volatile__ ("wer %0, %1\n isync" : : "r"(v), "r"(addr));
+}
+
+/* the counters are per core, each core programs its own on first use */
+static void pm_start() {
+  eri_set(ERI_PM_PGM, 0);
+  eri_set(ERI_PM_CTRL(PM_ISTALL), PM_CTRL_KRNLCNT | (PM_EVENT_I_STALL << 8) | (PM_MASK_I_STALL << 16));
+  eri_set(ERI_PM_CTRL(PM_DSTALL), PM_CTRL_KRNLCNT | (PM_EVENT_D_STALL << 8) | (PM_MASK_D_STALL << 16));
+  eri_set(ERI_PM_COUNT(PM_ISTALL), 0);
+  eri_set(ERI_PM_COUNT(PM_DSTALL), 0);
+  eri_set(ERI_PM_PGM, PM_PGM_ENABLE);
+}
+
+static void stall_report() {
+  stallSum_t sum[PROFILE_STAGES], total = {0};
+  uint32_t n;
+  portENTER_CRITICAL(&stallMux);
+  memcpy(sum, stages, sizeof(stages));
+  n = frames;
+  memset(stages, 0, sizeof(stages));
+  frames = 0;
+  portEXIT_CRITICAL(&stallMux);
+  ESP_LOGI(TAG, "Per frame over %u frames:", (unsigned)n);
+  for(int s = 0; s < PROFILE_STAGES; ++s) {
+    ESP_LOGI(TAG, "%-8s %7u cycles %6u fetch stall %6u load stall", stageNames[s],
+             (unsigned)(sum[s].cycles / n), (unsigned)(sum[s].istall / n), (unsigned)(sum[s].dstall / n));
+    total.cycles += sum[s].cycles;
+    total.istall += sum[s].istall;
+    total.dstall += sum[s].dstall;
+  }
+  ESP_LOGI(TAG, "total    %7u cycles, %u%% stalled", (unsigned)(total.cycles / n),
+           (unsigned)(total.cycles ? (total.istall + total.dstall) * 100 / total.cycles : 0));
+}
+
+/* PROFILE_MARK hook of the decoder, see mp3common.h. with CONFIG_MP3_DUAL_CORE
+ * the subband stage runs on the other core, hence per core snapshots */
+void HelixProfileMark(int stage) {
+  int core = xPortGetCoreID();
+  stallSample_t now, prev;
+  if(started[core] == false) {
+    pm_start();
+    started[core] = true;
+  }
+  now.cycles = XTHAL_GET_CCOUNT();
+  now.istall = eri_get(ERI_PM_COUNT(PM_ISTALL));
+  now.dstall = eri_get(ERI_PM_COUNT(PM_DSTALL));
+  prev = last[core];
+  last[core] = now;
+  if(stage < 0) return;
+  portENTER_CRITICAL(&stallMux);
+  stages[stage].cycles += now.cycles - prev.cycles;
+  stages[stage].istall += now.istall - prev.istall;
+  stages[stage].dstall += now.dstall - prev.dstall;
+  bool report = stage == PROFILE_FRAME && ++frames >= HELIX_STALL_FRAMES;
+  portEXIT_CRITICAL(&stallMux);
+  if(report) {
+    stall_report();
+    //the log is not charged to the next stage
+    last[core].cycles = XTHAL_GET_CCOUNT();
+    last[core].istall = eri_get(ERI_PM_COUNT(PM_ISTALL));
+    last[core].dstall = eri_get(ERI_PM_COUNT(PM_DSTALL));
+  }
+}
+#endif
@@ -1,6 +1,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
@@ -16,12 +17,28 @@
 #include "sd_card.h"
 
 #include "ui.h"
+#include "ui_event.h"
 #include "i2s_dac.h"
-
+#include "pcm_buffer.h"
+#include "file_reader.h"
+#include "gain.h"
+#include "mp3_seek.h"
+#include "music_db.h"
+#include "id3_tag.h"
+#include "library_scan.h"
+#include "flacdec.h"
+#include "apedec.h"
+#include "esp_timer.h"
+#ifdef CONFIG_MP3_DUAL_CORE
+#include "mp3_synth.h"
+#endif
+
+
+#ifndef max
+  #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
 
 static const char *TAG = "CODEC";
-headerState_t state = HEADER_RIFF;
-wavProperties_t wavProps;
 int playlist_len, nowplay_offset, list_offset;
 
 //i2s configuration
@@ -46,6 +63,11 @@ i2s_pin_config_t pin_config = {
 };
 
 int i2s_num = 0; // i2s port number
+static int i2sRate = 0, i2sChans = 0; //format i2s is currently clocked for
+
+static preloadTrack_t preload;
+static QueueHandle_t preloadQ = NULL;
+static SemaphoreHandle_t preloadLock = NULL;
 
 playerState_t playerState = {
   .paused = true,
@@ -57,9 +79,9 @@ playerState_t playerState = {
   .album = "",
   .playMode = PLAYMODE_RANDOM,
   .volume = 50,
-  .volumeMultiplier = pow(10, -25 / 20.0),
+  .volumeGain = 1843, //-25dB
   .musicType = NONE,
-  .musicChanged = true
+  .seekTo = -1
 };
 
 
@@ -83,97 +105,170 @@ size_t readProps(FILE *file, wavProperties_t *wavProps){
   return n;
 }
 
-esp_err_t wavPlay(FILE *wavFile) {
-  if(wavFile != NULL) {
-    size_t n, fSize, dOffset = 0;
-    fseek(wavFile , 0 , SEEK_END);
-    fSize = ftell (wavFile);
-    ESP_LOGI(TAG, "Wav play");
-    ESP_LOGI(TAG, "File size: %.2f MBytes\n", (double)fSize / 1024.0 / 1024.0);
-    state = HEADER_RIFF;
-    rewind(wavFile);
-    while(ftell(wavFile) != fSize) {
-      switch(state){
-        case HEADER_RIFF: {
-          wavRiff_t wavRiff;
-          n = readRiff(wavFile, &wavRiff);
-            if(n == 12 && wavRiff.chunkID == CCCC('R', 'I', 'F', 'F')
-                && wavRiff.format == CCCC('W', 'A', 'V', 'E'))
-              state = HEADER_FMT;
-        }
-        break;
-        case HEADER_FMT: {
-          n = readProps(wavFile, &wavProps);
-          if(n == 24)
-            state = HEADER_DATA;
-          ESP_LOGI(TAG, "SampleRate: %i ByteRate: %i BitsPerSample: %i ",
-            (int)wavProps.sampleRate,
-            (int)wavProps.byteRate,
-            (int)wavProps.bitsPerSample);
-        }
-        break;
-        case HEADER_DATA: {
-          uint32_t chunkId, chunkSize;
-          uint8_t byte;
-          while(ftell(wavFile) != fSize) {
-            readNBytes(wavFile, &byte, 1);
-            if(byte == 'd') {
-              fseek(wavFile, -1, SEEK_CUR);
-              n = read4bytes(wavFile, &chunkId);
-              if(n == 4){
-                if(chunkId == CCCC('d', 'a', 't', 'a')){
-                  ESP_LOGI(TAG, "HEADER_DATA");
-                  break;
-                }
-              }
-            }
-          }
-          n = read4bytes(wavFile, &chunkSize);
-          if(n == 4){
-            ESP_LOGI(TAG, "MUSIC DATA");
-            state = DATA;
-          }
-          dOffset = ftell(wavFile);
-          playerState.totalTime = (fSize - dOffset) / wavProps.byteRate;
-          //set sample rates of i2s to sample rate of wav file
-          i2s_set_sample_rates((i2s_port_t)i2s_num, wavProps.sampleRate);
-          playerState.sampleRate = wavProps.sampleRate;
-          playerState.bitsPerSample = wavProps.bitsPerSample;
-        }
-        break;
-        /* after processing wav file, it is time to process music data */
-        case DATA: {
-          if(playerState.paused == true) {
-            ESP_LOGI(TAG, "Paused.");
-            i2s_zero_dma_buffer(0);
-            // dac_mute(true);
-            while(playerState.paused == true)vTaskDelay(100 / portTICK_RATE_MS);
-            ESP_LOGI(TAG, "Continued.");
-          }
-          if(playerState.started == false) {
-            i2s_zero_dma_buffer(0);
-            fclose(wavFile);
-            return ESP_FAIL;
-          }
-          playerState.currentTime = (ftell(wavFile) - dOffset) / wavProps.byteRate;
+//KSDATAFORMAT_SUBTYPE_PCM, the SubFormat of WAVE_FORMAT_EXTENSIBLE integer pcm
+static const uint8_t wavSubtypePcm[16] = {
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71
+};
 
-          int bytes = wavProps.bitsPerSample / 8 * 2 * 768;
-          int16_t *data = malloc(bytes);
-          n = readNBytes(wavFile, data, bytes);
-          for(int i = 0; i < bytes / 2; i ++) {
-            data[i] *= playerState.volumeMultiplier;
-          }
-          i2s_write(i2s_num, data, bytes, &n, 100);
-          free(data);
-        }
-        break;
+/* walk the RIFF chunk list once, picking up 'fmt ' and stopping at 'data' */
+esp_err_t wavParseLayout(FILE *file, wavLayout_t *layout) {
+  wavRiff_t wavRiff;
+  uint32_t chunk[2];
+  uint8_t ext[24];
+  bool subtypePcm = false;
+  size_t fSize;
+  memset(layout, 0, sizeof(wavLayout_t));
+  fseek(file, 0, SEEK_END);
+  fSize = ftell(file);
+  rewind(file);
+  if(readRiff(file, &wavRiff) != 12 || wavRiff.chunkID != CCCC('R', 'I', 'F', 'F')
+      || wavRiff.format != CCCC('W', 'A', 'V', 'E'))
+    return ESP_FAIL;
+  while(readNBytes(file, chunk, 8) == 8) {
+    if(chunk[0] == CCCC('f', 'm', 't', ' ') && chunk[1] >= 16) {
+      layout->props.chunkID = chunk[0];
+      layout->props.chunkSize = chunk[1];
+      if(readNBytes(file, &layout->props.audioFormat, 16) != 16) return ESP_FAIL;
+      uint32_t skip = chunk[1] - 16;
+      if(layout->props.audioFormat == WAV_FORMAT_EXTENSIBLE) {
+        //cbSize, valid bits and channel mask, then the SubFormat GUID
+        if(chunk[1] < 40 || readNBytes(file, ext, 24) != 24) return ESP_FAIL;
+        subtypePcm = memcmp(ext + 8, wavSubtypePcm, 16) == 0;
+        skip -= 24;
       }
+      fseek(file, skip + (chunk[1] & 1), SEEK_CUR);
+    } else if(chunk[0] == CCCC('d', 'a', 't', 'a')) {
+      if(layout->props.chunkID == 0) return ESP_FAIL; //data before fmt
+      layout->dataOffset = ftell(file);
+      layout->dataSize = min(chunk[1], fSize - layout->dataOffset);
+      break;
+    } else {
+      fseek(file, chunk[1] + (chunk[1] & 1), SEEK_CUR);
     }
   }
-  else {
+  wavProperties_t *props = &layout->props;
+  if(layout->dataOffset == 0 || props->numChannels == 0 || props->byteRate == 0)
+    return ESP_FAIL;
+  if(props->audioFormat != WAV_FORMAT_PCM && props->audioFormat != WAV_FORMAT_EXTENSIBLE) {
+    ESP_LOGE(TAG, "Unsupported wav format 0x%04x", props->audioFormat);
+    return ESP_FAIL;
+  }
+  if(props->audioFormat == WAV_FORMAT_EXTENSIBLE && subtypePcm == false) {
+    ESP_LOGE(TAG, "Unsupported wav subformat, only integer pcm plays");
+    return ESP_FAIL;
+  }
+  layout->bytesPerSample = props->blockAlign / props->numChannels;
+  if(layout->bytesPerSample < 1 || layout->bytesPerSample > 4) return ESP_FAIL;
+  return ESP_OK;
+}
+
+/* any pcm layout to 16-bit interleaved stereo. samples wider than 16 bits
+ * keep their two most significant bytes, 8-bit samples are unsigned */
+static void wavConvert(int16_t *out, const uint8_t *in, int frames, const wavLayout_t *layout) {
+  int bps = layout->bytesPerSample, channels = layout->props.numChannels;
+  int right = channels > 1 ? bps : 0;
+  for(int i = 0; i < frames; ++i, in += layout->props.blockAlign, out += 2) {
+    if(bps == 1) {
+      out[0] = (int16_t)((in[0] - 128) << 8);
+      out[1] = (int16_t)((in[right] - 128) << 8);
+    } else {
+      out[0] = (int16_t)(in[bps - 2] | (in[bps - 1] << 8));
+      out[1] = (int16_t)(in[right + bps - 2] | (in[right + bps - 1] << 8));
+    }
+  }
+}
+
+/* the ring only has to run dry when the format really changes, back to back
+ * tracks of the same format keep streaming without a gap */
+static void i2s_set_format(int rate, int chans) {
+  if(rate == i2sRate && chans == i2sChans) return;
+  pcm_buffer_drain();
+  pcm_buffer_set_channels(chans);
+  i2s_set_clk((i2s_port_t)i2s_num, rate, 16, chans);
+  i2sRate = rate;
+  i2sChans = chans;
+}
+
+/* the decoders call these every frame, the UI only hears about changes */
+static void set_current_time(uint32_t sec) {
+  if(sec == playerState.currentTime) return;
+  playerState.currentTime = sec;
+  ui_post(UI_EVENT_TIME, sec);
+}
+
+static void set_track_info(uint32_t total, int rate, int bits) {
+  if(total == playerState.totalTime && rate == playerState.sampleRate && bits == playerState.bitsPerSample)
+    return;
+  playerState.totalTime = total;
+  playerState.sampleRate = rate;
+  playerState.bitsPerSample = bits;
+  ui_post(UI_EVENT_TRACK_INFO, total);
+}
+
+esp_err_t wavPlay(FILE *wavFile) {
+  static int16_t out[WAV_CHUNK_FRAMES * 2];
+  wavLayout_t layout;
+  fileReader_t *reader;
+  uint8_t *data;
+  size_t n;
+  if(wavFile == NULL) {
     ESP_LOGE(TAG, "Failed to read wav file.");
     return ESP_FAIL;
   }
+  ESP_LOGI(TAG, "Wav play");
+  if(wavParseLayout(wavFile, &layout) != ESP_OK) {
+    ESP_LOGE(TAG, "Not a playable wav file.");
+    fclose(wavFile);
+    return ESP_FAIL;
+  }
+  wavProperties_t *props = &layout.props;
+  ESP_LOGI(TAG, "SampleRate: %i ByteRate: %i BitsPerSample: %i Channels: %i",
+    (int)props->sampleRate,
+    (int)props->byteRate,
+    (int)props->bitsPerSample,
+    (int)props->numChannels);
+  reader = reader_open(wavFile, layout.dataOffset);
+  if(reader == NULL) {
+    fclose(wavFile);
+    return ESP_FAIL;
+  }
+  //set sample rates of i2s to sample rate of wav file, always stereo out
+  i2s_set_format(props->sampleRate, 2);
+  set_track_info(layout.dataSize / props->byteRate, props->sampleRate, props->bitsPerSample);
+  //16-bit stereo is already what i2s wants and goes to the ring as it is
+  bool native = layout.bytesPerSample == 2 && props->numChannels == 2;
+  size_t remaining = layout.dataSize;
+  while(remaining > 0) {
+    if(playerState.paused == true) {
+      ESP_LOGI(TAG, "Paused.");
+      // dac_mute(true);
+      while(playerState.paused == true)vTaskDelay(100 / portTICK_RATE_MS);
+      ESP_LOGI(TAG, "Continued.");
+    }
+    if(playerState.started == false) {
+      pcm_buffer_flush();
+      reader_close(reader);
+      fclose(wavFile);
+      return ESP_FAIL;
+    }
+    set_current_time((reader_tell(reader) - layout.dataOffset) / props->byteRate);
+
+    n = reader_borrow(reader, &data, WAV_CHUNK_FRAMES * props->blockAlign);
+    n = min(min(n, WAV_CHUNK_FRAMES * props->blockAlign), remaining);
+    n -= n % props->blockAlign;
+    if(n == 0) break;
+    int frames = n / props->blockAlign;
+    int16_t *pcm = (int16_t *)data;
+    if(native == false) {
+      wavConvert(out, data, frames, &layout);
+      pcm = out;
+    }
+    pcm_buffer_write(pcm, frames * 4);
+    reader_release(reader, n);
+    remaining -= n;
+  }
+  pcm_buffer_end();
+  reader_close(reader);
   fclose(wavFile);
   return ESP_OK;
 }
@@ -182,7 +277,8 @@ void setVolume(int vol) {
   if(vol > 100 ) playerState.volume = 100;
   else if(vol < 0) playerState.volume = 0;
   else playerState.volume = vol;
-  playerState.volumeMultiplier = pow(10, (MIN_VOL_OFFSET + vol / 2) / 20.0);
+  playerState.volumeGain = gain_from_db(MIN_VOL_OFFSET + playerState.volume / 2);
+  ui_post(UI_EVENT_VOLUME, playerState.volume);
 }
 
 esp_err_t i2s_init() {
@@ -192,7 +288,10 @@ esp_err_t i2s_init() {
   REG_WRITE(PIN_CTRL, 0xFFFFFFF0);
   PIN_FUNC_SELECT(GPIO_PIN_REG_0, 1);
   memset(playerState.fileName, 0, sizeof(playerState.fileName));
-  return ESP_OK;
+  preloadQ = xQueueCreate(1, sizeof(int));
+  preloadLock = xSemaphoreCreateMutex();
+  if(preloadQ == NULL || preloadLock == NULL) return ESP_ERR_NO_MEM;
+  return pcm_buffer_init(PCM_BUFFER_MS);
 }
 
 esp_err_t i2s_deinit() {
@@ -212,6 +311,7 @@ void dac_mute(bool m) {
 
 void player_pause(bool p) {
   playerState.paused = p;
+  ui_post(UI_EVENT_PLAY_STATE, p);
 }
 
 void parseMusicType() {
@@ -232,7 +332,7 @@ void parseMusicType() {
     playerState.musicType = MP3;
   else if((!strcmp(typeName, ".ape")) | (!strcmp(typeName, ".APE")))
     playerState.musicType = APE;
-  else if((!strcmp(typeName, "flac")) | (!strcmp(typeName, ".flac")))
+  else if((!strcmp(typeName, "flac")) | (!strcmp(typeName, "FLAC")))
     playerState.musicType = FLAC;
   else playerState.musicType = NONE;
 }
@@ -245,12 +345,24 @@ int getMusicType() {
   return playerState.musicType;
 }
 
+void player_seek(int sec) {
+  playerState.seekTo = sec < 0 ? 0 : sec;
+}
+
 bool isPaused() {
   return playerState.paused;
 }
 
+/* the read-ahead reader does its own buffering. stdio's can only be turned
+ * off before the first read, so it is done right at the open */
+static FILE *track_open(const char *fileName) {
+  FILE *file = fopen(fileName, "rb");
+  if(file != NULL) setvbuf(file, NULL, _IONBF, 0);
+  return file;
+}
+
 FILE* musicFileOpen() {
-  return fopen(playerState.fileName, "rb");
+  return track_open(playerState.fileName);
 }
 
 int getVolumePercentage() {
@@ -263,388 +375,628 @@ void mp3Play(FILE *mp3File)
     ESP_LOGI(TAG,"MP3 start decoding");
     HMP3Decoder hMP3Decoder;
     MP3FrameInfo mp3FrameInfo;
-    unsigned char *readBuf=malloc(MAINBUF_SIZE);
-    if(readBuf==NULL){
-      ESP_LOGE(TAG,"ReadBuf malloc failed");
-      return;
-    }
+    fileReader_t *reader;
+    mp3Seek_t seek;
+#ifdef CONFIG_MP3_DUAL_CORE
+    mp3Synth_t synth;
+    synthJob_t *job = NULL;
+#endif
+    int track = nowplay_offset;
     int16_t *output=malloc(1153*4);
     if(output==NULL){
-      free(readBuf);
       ESP_LOGE(TAG,"OutBuf malloc failed");
+      fclose(mp3File);
+      return;
     }
     hMP3Decoder = MP3InitDecoder();
     if (hMP3Decoder == 0){
-      free(readBuf);
       free(output);
+      fclose(mp3File);
       ESP_LOGE(TAG,"Memory not enough");
+      return;
     }
+#ifdef CONFIG_MP3_DUAL_CORE
+    if(synth_start(&synth, hMP3Decoder, output) != ESP_OK) {
+      MP3FreeDecoder(hMP3Decoder);
+      free(output);
+      fclose(mp3File);
+      return;
+    }
+#endif
     fseek(mp3File, 0, SEEK_END);
     size_t fileSize = ftell(mp3File);
     rewind(mp3File);
 
-    playerState.currentTime = 0;
+    set_current_time(0);
 
     int samplerate = 0;
-    i2s_zero_dma_buffer(0);
-    char tag[10];
-    int tag_len = 0;
-    int read_bytes = fread(tag, 1, 10, mp3File);
-    if(read_bytes == 10) {
-      if (memcmp(tag,"ID3",3) == 0) {
-        tag_len = ((tag[6] & 0x7F)<< 21)|((tag[7] & 0x7F) << 14) | ((tag[8] & 0x7F) << 7) | (tag[9] & 0x7F);
-          // ESP_LOGI(TAG,"tag_len: %d %x %x %x %x", tag_len,tag[6],tag[7],tag[8],tag[9]);
-       }
-      else {
-        ESP_LOGE(TAG, "Not an mp3 file.");
-        return;
-      }
+    int tag_len = id3_tag_len(mp3File);
+     if(mp3_seek_open(&seek, mp3File, playerState.fileName, tag_len) != ESP_OK)
+       ESP_LOGE(TAG, "No seek index for %s", playerState.fileName);
+     set_track_info(mp3_seek_duration(&seek), playerState.sampleRate, playerState.bitsPerSample);
+     if(playerState.seekTo < 0) mp3_resume_save(track, playerState.fileName, 0);
+     reader = reader_open(mp3File, tag_len);
+     if(reader == NULL) {
+#ifdef CONFIG_MP3_DUAL_CORE
+       synth_stop(&synth);
+#endif
+       mp3_seek_close(&seek);
+       MP3FreeDecoder(hMP3Decoder);
+       free(output);
+       fclose(mp3File);
+       return;
+     }
+     //output window in samples after the Xing frame, drops the encoder delay
+     //and padding so that consecutive tracks join seamlessly
+     uint64_t trimStart = 0, trimEnd = UINT64_MAX;
+     if(seek.gapless == true && seek.hdr.totalFrames != 0) {
+       trimStart = seek.encoderDelay + MP3_DECODER_DELAY;
+       trimEnd = (uint64_t)seek.hdr.totalFrames * seek.hdr.samplesPerFrame + MP3_DECODER_DELAY;
+       trimEnd = trimEnd > seek.encoderPadding ? trimEnd - seek.encoderPadding : 0;
+       ESP_LOGI(TAG, "Gapless: delay %d padding %d", seek.encoderDelay, seek.encoderPadding);
      }
-     fseek(mp3File, tag_len, SEEK_SET);
      int bytesLeft = 0;
-     unsigned char* readPtr = readBuf;
+     unsigned char *readPtr, *readStart;
+     uint32_t frames = 0, skip = 0, lastSave = 0;
      while (1) {
         if(playerState.paused == true) {
           ESP_LOGI(TAG, "Paused.");
-          i2s_zero_dma_buffer(0);
+          if(playerState.seekTo < 0) mp3_resume_save(track, playerState.fileName, playerState.currentTime);
           while(playerState.paused == true) vTaskDelay(100 / portTICK_RATE_MS);
           ESP_LOGI(TAG, "Continued.");
         }
         if(playerState.started == false) {
-          i2s_zero_dma_buffer(0);
-          fclose(mp3File);
-          return;
+#ifdef CONFIG_MP3_DUAL_CORE
+          synth_wait(&synth);
+#endif
+          pcm_buffer_flush();
+          break;
         }
-        if (bytesLeft < MAINBUF_SIZE)
-        {
-            memmove(readBuf, readPtr, bytesLeft);
-            int br = fread(readBuf + bytesLeft, 1, MAINBUF_SIZE - bytesLeft, mp3File);
-            if ((br == 0)&&(bytesLeft==0)) break;
-
-            bytesLeft = bytesLeft + br;
-            readPtr = readBuf;
+        if(playerState.seekTo >= 0) {
+          size_t offset;
+          uint32_t target;
+          esp_err_t found = mp3_seek_lookup(&seek, playerState.seekTo, &offset, &target, &skip);
+          if(found == ESP_OK) {
+            reader_close(reader);
+#ifdef CONFIG_MP3_DUAL_CORE
+            synth_wait(&synth);
+#endif
+            pcm_buffer_flush();
+            reader = reader_open(mp3File, offset);
+            if(reader == NULL) break;
+            frames = target - skip;
+            ESP_LOGI(TAG, "Seek to %ds, frame %d", playerState.seekTo, target);
+          }
+          //SEEK_IDX is still indexing, asked again at the next frame
+          if(found != ESP_ERR_INVALID_STATE) playerState.seekTo = -1;
         }
+        bytesLeft = reader_borrow(reader, &readStart, MAINBUF_SIZE);
+        if (bytesLeft == 0) break;
+        readPtr = readStart;
         int offset = MP3FindSyncWord(readPtr, bytesLeft);
         if (offset < 0)
         {
              ESP_LOGE(TAG,"MP3FindSyncWord not find");
-             bytesLeft=0;
+             reader_release(reader, bytesLeft);
              continue;
         }
         else
         {
           readPtr += offset;                         //data start point
           bytesLeft -= offset;                 //in buffer
+          size_t framePos = reader_tell(reader) + offset;
+#ifdef CONFIG_MP3_DUAL_CORE
+          //Huffman to IMDCT here, the polyphase synthesis of the frame runs
+          //in the SYNTH task on core 0 while the next one is decoded
+          if(job == NULL) job = synth_job(&synth);
+          int errs = MP3DecodeAnalysis(hMP3Decoder, &readPtr, &bytesLeft, &job->frame);
+#else
           int errs = MP3Decode(hMP3Decoder, &readPtr, &bytesLeft, (short*)output, 0);
-          if (errs != 0)
+#endif
+          reader_release(reader, readPtr - readStart);
+          //the Xing frame carries no audio and is not part of the frame count
+          bool xing = seek.source == SEEK_XING && framePos == seek.hdr.audioStart;
+          uint64_t from = 0, to = 0;
+          if (errs == ERR_MP3_MAINDATA_UNDERFLOW && xing == false)
+          {
+              //bit reservoir still filling after a seek, frame is silent
+              frames++;
+              if(skip > 0) skip--;
+          }
+          else if (errs == 0 && xing == false)
+          {
+              frames++;
+              MP3GetLastFrameInfo(hMP3Decoder, &mp3FrameInfo);
+              set_current_time((uint64_t)frames * (mp3FrameInfo.outputSamps / mp3FrameInfo.nChans) / mp3FrameInfo.samprate);
+              if(samplerate!=mp3FrameInfo.samprate)
+              {
+                  samplerate=mp3FrameInfo.samprate;
+#ifdef CONFIG_MP3_DUAL_CORE
+                  synth_wait(&synth);
+#endif
+                  i2s_set_format(samplerate, mp3FrameInfo.nChans);
+                  //CBR estimate until the seek index knows better
+                  uint32_t total = playerState.totalTime;
+                  if(total == 0 && mp3FrameInfo.bitrate != 0)
+                    total = (fileSize - tag_len) * 8 / mp3FrameInfo.bitrate;
+                  set_track_info(total, mp3FrameInfo.samprate, 16);
+                  ESP_LOGI(TAG,"mp3file info---bitrate=%d,layer=%d,nChans=%d,samprate=%d,outputSamps=%d",mp3FrameInfo.bitrate,mp3FrameInfo.layer,mp3FrameInfo.nChans,mp3FrameInfo.samprate,mp3FrameInfo.outputSamps);
+              }
+              if(mp3_seek_duration(&seek) != 0)
+                set_track_info(mp3_seek_duration(&seek), playerState.sampleRate, playerState.bitsPerSample);
+              int spf = mp3FrameInfo.outputSamps / mp3FrameInfo.nChans;
+              uint64_t first = (uint64_t)(frames - 1) * spf;
+              if(skip > 0) skip--;
+              else if(first < trimEnd) {
+                from = max(trimStart, first) - first;
+                to = min(trimEnd, first + spf) - first;
+              }
+          }
+#ifdef CONFIG_MP3_DUAL_CORE
+          //granules decoded before an error still go through synthesis so
+          //the polyphase state matches MP3Decode(), from == to drops them
+          if(job->frame.nGrans > 0) {
+            job->from = from;
+            job->to = max(from, to);
+            job->nChans = job->frame.nChans;
+            synth_submit(&synth, job);
+            job = NULL;
+          }
+#else
+          if(from < to) {
+            int16_t *pcm = output + from * mp3FrameInfo.nChans;
+            pcm_buffer_write(pcm, (to - from) * mp3FrameInfo.nChans * 2);
+          }
+#endif
+          if (errs != 0 && errs != ERR_MP3_MAINDATA_UNDERFLOW && xing == false)
           {
               ESP_LOGE(TAG,"MP3Decode failed ,code is %d ",errs);
               break;
           }
-          MP3GetLastFrameInfo(hMP3Decoder, &mp3FrameInfo);
-          playerState.currentTime = (ftell(mp3File) - tag_len) * 8 / mp3FrameInfo.bitrate;
-          if(samplerate!=mp3FrameInfo.samprate)
-          {
-              samplerate=mp3FrameInfo.samprate;
-              i2s_set_clk(0,samplerate,16,mp3FrameInfo.nChans);
-              playerState.sampleRate = mp3FrameInfo.samprate;
-              playerState.bitsPerSample = 16;
-              playerState.totalTime = (fileSize - tag_len) * 8 / mp3FrameInfo.bitrate;
-              ESP_LOGI(TAG,"mp3file info---bitrate=%d,layer=%d,nChans=%d,samprate=%d,outputSamps=%d",mp3FrameInfo.bitrate,mp3FrameInfo.layer,mp3FrameInfo.nChans,mp3FrameInfo.samprate,mp3FrameInfo.outputSamps);
+          if(from < to && playerState.seekTo < 0 && playerState.currentTime >= lastSave + SEEK_RESUME_INTERVAL) {
+            lastSave = playerState.currentTime;
+            mp3_resume_save(track, playerState.fileName, lastSave);
           }
-          for(int i = 0; i < mp3FrameInfo.outputSamps; ++i)
-            output[i] *= playerState.volumeMultiplier;
-
-          i2s_write(i2s_num,(const char*)output,mp3FrameInfo.outputSamps*2, (size_t*)(&read_bytes), 1000 / portTICK_RATE_MS);
         }
     }
-    i2s_zero_dma_buffer(0);
+#ifdef CONFIG_MP3_DUAL_CORE
+    if(job != NULL) synth_cancel(&synth, job);
+    synth_stop(&synth);
+#endif
+    pcm_buffer_end();
+    reader_close(reader);
+    mp3_seek_close(&seek);
     //i2s_driver_uninstall(0);
     MP3FreeDecoder(hMP3Decoder);
-    free(readBuf);
     free(output);
     fclose(mp3File);
 
     ESP_LOGI(TAG,"end mp3 decode ..");
 }
 
+/* the decoder takes the reader buffers as they are, each piece is released
+ * when the next one is fetched */
+typedef struct {
+  fileReader_t *reader;
+  size_t held;
+} readerSource_t;
+
+static size_t reader_fetch(void *ctx, const uint8_t **data) {
+  readerSource_t *src = ctx;
+  uint8_t *p = NULL;
+  reader_release(src->reader, src->held);
+  src->held = reader_borrow(src->reader, &p, 1);
+  *data = p;
+  return src->held;
+}
+
+esp_err_t flacPlay(FILE *flacFile) {
+  static int16_t out[FLAC_OUT_FRAMES * 2];
+  readerSource_t src = {NULL, 0};
+  flacDecoder_t *flac;
+  int track = nowplay_offset;
+  uint32_t lastSave = 0;
+  uint64_t skipTo = 0;
+  ESP_LOGI(TAG, "FLAC play");
+  fseek(flacFile, 0, SEEK_END);
+  size_t fileSize = ftell(flacFile);
+  int tag_len = id3_tag_len(flacFile);
+  src.reader = reader_open(flacFile, tag_len);
+  if(src.reader == NULL) {
+    fclose(flacFile);
+    return ESP_FAIL;
+  }
+  flac = flac_open(reader_fetch, &src);
+  if(flac == NULL) {
+    ESP_LOGE(TAG, "Not a playable flac file.");
+    reader_close(src.reader);
+    fclose(flacFile);
+    return ESP_FAIL;
+  }
+  flacStreamInfo_t *info = &flac->info;
+  ESP_LOGI(TAG, "SampleRate: %i BitsPerSample: %i Channels: %i MaxBlock: %i",
+    (int)info->sampleRate,
+    (int)info->bitsPerSample,
+    (int)info->channels,
+    (int)info->maxBlock);
+  set_track_info(info->totalSamples / info->sampleRate, info->sampleRate, info->bitsPerSample);
+  if(playerState.seekTo < 0) mp3_resume_save(track, playerState.fileName, 0);
+  while(1) {
+    if(playerState.paused == true) {
+      ESP_LOGI(TAG, "Paused.");
+      if(playerState.seekTo < 0) mp3_resume_save(track, playerState.fileName, playerState.currentTime);
+      while(playerState.paused == true) vTaskDelay(100 / portTICK_RATE_MS);
+      ESP_LOGI(TAG, "Continued.");
+    }
+    if(playerState.started == false) {
+      pcm_buffer_flush();
+      break;
+    }
+    if(playerState.seekTo >= 0) {
+      //no seek table is kept, jump to the proportional byte offset and
+      //drop samples up to the target once a frame is found there
+      if(info->totalSamples != 0) {
+        skipTo = min((uint64_t)playerState.seekTo * info->sampleRate, info->totalSamples);
+        uint64_t audioSize = fileSize - tag_len - flac->audioStart;
+        uint64_t offset = flac->audioStart + audioSize * skipTo / info->totalSamples;
+        reader_close(src.reader);
+        pcm_buffer_flush();
+        src.reader = reader_open(flacFile, tag_len + offset);
+        src.held = 0;
+        if(src.reader == NULL) break;
+        flac_reset(flac, offset);
+        ESP_LOGI(TAG, "Seek to %ds", playerState.seekTo);
+      }
+      playerState.seekTo = -1;
+    }
+    int n = flac_decode_frame(flac);
+    if(n == FLAC_ERR_END) break;
+    if(n < 0) {
+      ESP_LOGE(TAG, "FLAC frame error %d", n);
+      continue;
+    }
+    flacFrame_t *frame = &flac->frame;
+    set_current_time(frame->firstSample / frame->sampleRate);
+    int from = 0;
+    if(skipTo > frame->firstSample) {
+      if(skipTo >= frame->firstSample + n) continue;
+      from = skipTo - frame->firstSample;
+    }
+    skipTo = 0;
+    i2s_set_format(frame->sampleRate, frame->channels);
+    for(int i = from; i < n; i += FLAC_OUT_FRAMES) {
+      int count = min(n - i, FLAC_OUT_FRAMES);
+      flac_output_s16(flac, out, i, count);
+      pcm_buffer_write(out, count * frame->channels * 2);
+    }
+    if(playerState.seekTo < 0 && playerState.currentTime >= lastSave + SEEK_RESUME_INTERVAL) {
+      lastSave = playerState.currentTime;
+      mp3_resume_save(track, playerState.fileName, lastSave);
+    }
+  }
+  pcm_buffer_end();
+  if(src.reader != NULL) reader_close(src.reader);
+  flac_close(flac);
+  fclose(flacFile);
+  return ESP_OK;
+}
+
+esp_err_t apePlay(FILE *apeFile) {
+  static int16_t out[APE_CHUNK * 2];
+  readerSource_t src = {NULL, 0};
+  apeDecoder_t *ape;
+  int track = nowplay_offset;
+  uint32_t lastSave = 0;
+  uint64_t skipTo = 0, decoded = 0;
+  int64_t decodeUs = 0;
+  ESP_LOGI(TAG, "APE play");
+  int tag_len = id3_tag_len(apeFile);
+  src.reader = reader_open(apeFile, tag_len);
+  if(src.reader == NULL) {
+    fclose(apeFile);
+    return ESP_FAIL;
+  }
+  ape = ape_open(reader_fetch, &src);
+  if(ape == NULL) {
+    ESP_LOGE(TAG, "Not a playable ape file, 3.99 or later at Fast to Extra High needed.");
+    reader_close(src.reader);
+    fclose(apeFile);
+    return ESP_FAIL;
+  }
+  apeInfo_t *info = &ape->info;
+  ESP_LOGI(TAG, "SampleRate: %i BitsPerSample: %i Channels: %i Compression: %i",
+    (int)info->sampleRate,
+    (int)info->bitsPerSample,
+    (int)info->channels,
+    (int)info->compression);
+  set_track_info(info->totalBlocks / info->sampleRate, info->sampleRate, info->bitsPerSample);
+  if(playerState.seekTo < 0) mp3_resume_save(track, playerState.fileName, 0);
+  while(1) {
+    if(playerState.paused == true) {
+      ESP_LOGI(TAG, "Paused.");
+      if(playerState.seekTo < 0) mp3_resume_save(track, playerState.fileName, playerState.currentTime);
+      while(playerState.paused == true) vTaskDelay(100 / portTICK_RATE_MS);
+      ESP_LOGI(TAG, "Continued.");
+    }
+    if(playerState.started == false) {
+      pcm_buffer_flush();
+      break;
+    }
+    if(playerState.seekTo >= 0) {
+      //frames can only be entered at their start, the seek table has them
+      skipTo = min((uint64_t)playerState.seekTo * info->sampleRate, info->totalBlocks);
+      uint32_t frame = min(skipTo / info->blocksPerFrame, info->totalFrames - 1);
+      reader_close(src.reader);
+      pcm_buffer_flush();
+      src.reader = reader_open(apeFile, tag_len + ape_frame_offset(ape, frame));
+      src.held = 0;
+      if(src.reader == NULL) break;
+      ape_reset(ape, frame);
+      ESP_LOGI(TAG, "Seek to %ds", playerState.seekTo);
+      playerState.seekTo = -1;
+    }
+    int64_t start = esp_timer_get_time();
+    int n = ape_decode(ape);
+    decodeUs += esp_timer_get_time() - start;
+    if(n == 0 || n == APE_ERR_END) break;
+    if(n < 0) {
+      ESP_LOGE(TAG, "APE frame %u corrupt", ape->frame - 1);
+      continue;
+    }
+    decoded += n;
+    set_current_time(ape->blockPos / info->sampleRate);
+    int from = 0;
+    if(skipTo > ape->blockPos) {
+      if(skipTo >= ape->blockPos + n) continue;
+      from = skipTo - ape->blockPos;
+    }
+    skipTo = 0;
+    i2s_set_format(info->sampleRate, info->channels);
+    ape_output_s16(ape, out, from, n - from);
+    pcm_buffer_write(out, (n - from) * info->channels * 2);
+    if(playerState.seekTo < 0 && playerState.currentTime >= lastSave + SEEK_RESUME_INTERVAL) {
+      lastSave = playerState.currentTime;
+      mp3_resume_save(track, playerState.fileName, lastSave);
+    }
+  }
+  //share of one core spent decoding, the budget is in apedec.h
+  if(decoded != 0)
+    ESP_LOGI(TAG, "APE decode load %d%%", (int)(decodeUs * info->sampleRate / 10000 / decoded));
+  pcm_buffer_end();
+  if(src.reader != NULL) reader_close(src.reader);
+  ape_close(ape);
+  fclose(apeFile);
+  return ESP_OK;
+}
+
+/* file name and tags of a library track, all empty if it is gone */
+static void load_track(int offset, char *fn, char *title, char *author, char *album) {
+  musicdbRecord_t r;
+  memset(&r, 0, sizeof(r));
+  musicdb_record(offset, &r);
+  musicdb_string(r.path, fn, MUSICDB_FN_LEN);
+  musicdb_string(r.title, title, MUSICDB_TITLE_LEN);
+  musicdb_string(r.artist, author, MUSICDB_TITLE_LEN);
+  musicdb_string(r.album, album, MUSICDB_TITLE_LEN);
+}
+
+/* an empty card or a library the scan has not got to yet */
+static void wait_for_library(void) {
+  while(playlist_len == 0) vTaskDelay(1000 / portTICK_RATE_MS);
+}
+
+static int next_track(int offset) {
+  wait_for_library();
+  switch(playerState.playMode) {
+    case PLAYMODE_RANDOM:
+      return rand() % playlist_len;
+    case PLAYMODE_REPEAT_PLAYLIST:
+      return offset + 1 < playlist_len ? offset + 1 : 0;
+    case PLAYMODE_REPEAT:
+    default:
+      return offset;
+  }
+}
+
+/* opens the queued track and reads its tags while the current one plays */
+void taskPreload(void *parameter) {
+  int offset;
+  while(1) {
+    if(xQueueReceive(preloadQ, &offset, portMAX_DELAY) != pdPASS) continue;
+    xSemaphoreTake(preloadLock, portMAX_DELAY);
+    if(preload.state == PRELOAD_READY) {
+      if(preload.offset == offset && preload.generation == musicdb_generation()) {
+        xSemaphoreGive(preloadLock);
+        continue;
+      }
+      if(preload.filePtr != NULL) fclose(preload.filePtr);
+      preload.state = PRELOAD_IDLE;
+    }
+    preload.offset = offset;
+    preload.generation = musicdb_generation();
+    load_track(offset, preload.fileName, preload.title, preload.author, preload.album);
+    preload.filePtr = track_open(preload.fileName);
+    preload.state = PRELOAD_READY;
+    ESP_LOGI(TAG, "Preloaded %s", preload.fileName);
+    xSemaphoreGive(preloadLock);
+  }
+}
+
+/* hands the preloaded track over to playerState if it is the one wanted,
+ * a stale one is closed */
+static bool preload_take(int offset) {
+  bool taken = false;
+  xSemaphoreTake(preloadLock, portMAX_DELAY);
+  if(preload.state == PRELOAD_READY) {
+    if(preload.offset == offset && preload.generation == musicdb_generation()) {
+      setNowPlaying(preload.fileName);
+      strcpy(playerState.title, preload.title);
+      strcpy(playerState.author, preload.author);
+      strcpy(playerState.album, preload.album);
+      playerState.filePtr = preload.filePtr;
+      taken = true;
+    } else if(preload.filePtr != NULL) {
+      fclose(preload.filePtr);
+    }
+    preload.filePtr = NULL;
+    preload.state = PRELOAD_IDLE;
+  }
+  xSemaphoreGive(preloadLock);
+  return taken;
+}
+
 void taskPlay(void *parameter) {
   nowplay_offset = 0;
   list_offset = 0;
-  FILE *db = fopen("/sdcard/music_list.db", "r");
-  if(db == NULL) {
-    fclose(db);
-    db = fopen("/sdcard/music_list.db", "wb");
-    scan_music_file("/sdcard/", 0, 3, db);
-    fflush(db);
-    playlist_len = ftell(db) / (MUSICDB_FN_LEN + MUSICDB_TITLE_LEN);
-    fclose(db);
-  } else {
-    fseek(db, 0, SEEK_END);
-    playlist_len = ftell(db) / (MUSICDB_FN_LEN + MUSICDB_TITLE_LEN);
-    fclose(db);
+  //what is already in the library plays right away, the scan adds to it
+  library_scan_start();
+  playlist_len = musicdb_count();
+  ESP_LOGI(TAG, "Playlist length: %d", playlist_len);
+  char tmp_fn[MUSICDB_FN_LEN], resume_fn[MUSICDB_FN_LEN];
+  int resume_offset, next_offset, next_mode;
+  uint32_t resume_sec, generation = musicdb_generation();
+  if(mp3_resume_load(&resume_offset, resume_fn, &resume_sec) == ESP_OK) {
+    //ids change when the library is compacted, the file name does not
+    uint32_t id = musicdb_find_path(resume_fn);
+    if(id != MUSICDB_NONE) {
+      ESP_LOGI(TAG, "Resume %s at %ds", resume_fn, resume_sec);
+      nowplay_offset = id;
+      playerState.seekTo = resume_sec;
+    }
   }
-  ESP_LOGI(TAG, "Music scanning completed.Playlist length: %d", playlist_len);
+  srand(time(NULL));
+  wait_for_library();
   while(1) {
-    playerState.musicChanged = true;
-    char tmp_fn[MUSICDB_FN_LEN], tmp_title[MUSICDB_TITLE_LEN];
-    db = fopen("/sdcard/music_list.db", "rb");
-    fseek(db, nowplay_offset * (MUSICDB_FN_LEN + MUSICDB_TITLE_LEN), SEEK_SET);
-    fread(tmp_fn, 1, MUSICDB_FN_LEN, db);
-    fread(tmp_title, 1, MUSICDB_TITLE_LEN, db);
-    fclose(db);
-    setNowPlaying(tmp_fn);
-    strcpy(playerState.title, tmp_title);
-    playerState.filePtr = fopen(playerState.fileName, "rb");
-    memset(playerState.author, 0, sizeof(playerState.author));
-    memset(playerState.album, 0, sizeof(playerState.album));
-    parse_mp3_info(playerState.filePtr, NULL, playerState.author, playerState.album);
+    bool played = false;
+    if(preload_take(nowplay_offset) == false) {
+      load_track(nowplay_offset, tmp_fn, playerState.title, playerState.author, playerState.album);
+      setNowPlaying(tmp_fn);
+      playerState.filePtr = track_open(playerState.fileName);
+    }
+    ui_post(UI_EVENT_TRACK, nowplay_offset);
+    //the following track is opened in the background so it can start the
+    //moment this one runs out
+    next_mode = playerState.playMode;
+    next_offset = next_track(nowplay_offset);
+    xQueueOverwrite(preloadQ, &next_offset);
     if(playerState.filePtr != NULL) {
       parseMusicType();
+      //the play functions own the file from here and close it
       switch(playerState.musicType) {
         case WAV:
           wavPlay(playerState.filePtr);
+          played = true;
         break;
         case MP3:
           mp3Play(playerState.filePtr);
+          played = true;
+        break;
+        case FLAC:
+          flacPlay(playerState.filePtr);
+          played = true;
+        break;
+        case APE:
+          apePlay(playerState.filePtr);
+          played = true;
+        break;
+        default:
+          fclose(playerState.filePtr);
         break;
-        default:break;
       }
-      fclose(playerState.filePtr);
+      playerState.filePtr = NULL;
     }
-    playerState.totalTime = 0;
-    playerState.currentTime = 0;
+    playerState.seekTo = -1;
+    set_track_info(0, playerState.sampleRate, playerState.bitsPerSample);
+    set_current_time(0);
     if(playerState.started != false) {
-      switch(playerState.playMode) {
-        case PLAYMODE_RANDOM:
-          srand(time(NULL));
-          nowplay_offset = rand() % playlist_len;
-        break;
-        case PLAYMODE_REPEAT_PLAYLIST:
-          nowplay_offset++;
-          if(nowplay_offset > playlist_len) nowplay_offset = 0;
-        break;
-        case PLAYMODE_REPEAT:break;
-        default:break;
+      //a compaction renumbered the library, find the track again by name
+      if(generation != musicdb_generation()) {
+        generation = musicdb_generation();
+        playlist_len = musicdb_count();
+        uint32_t id = musicdb_find_path(playerState.fileName);
+        nowplay_offset = id != MUSICDB_NONE ? id : 0;
+        next_mode = -1;
       }
+      if(playerState.playMode != next_mode) next_offset = next_track(nowplay_offset);
+      nowplay_offset = next_offset;
     } else {
       playerState.started = true;
+      ui_post(UI_EVENT_PLAY_STATE, 0);
     }
-    vTaskDelay(800 / portTICK_RATE_MS);
+    //nothing was played, don't spin over unreadable files
+    if(played == false) vTaskDelay(100 / portTICK_RATE_MS);
   }
 }
 
-static int check_music_file(char* filename) {
-  char l[5];
-  memset(l, 0, sizeof(l));
-  int len = strlen(filename);
-  for(int i = 0; i < 4; ++i) {
-    l[i] = filename[len - (4 - i)];
-  }
-  if(strcmp(l,".mp3") == 0 || strcmp(l, ".MP3") == 0)
-    return 1;
-  else if(strcmp(l, ".wav") == 0 || strcmp(l, ".WAV") == 0) return 2;
-
-  return 0;
-}
-
-int scan_music_file(const char *basePath, int dep_cur, const int dep, FILE *db) {
-  if(dep == dep_cur) return 0;
-  if(db == NULL) return -1;
-  DIR *dir_p;
-  struct dirent *dirent_p;
-  FILE *file_p;
-  char path[256];
-  int type = 0;
-  memset(path, 0, sizeof(path));
-  strcpy(path, basePath);
-  char tmp_title[MUSICDB_TITLE_LEN], tmp_fn[MUSICDB_FN_LEN];
-
-  dir_p = opendir(basePath);
-  if(dir_p == NULL) {
-    ESP_LOGE(TAG, "Failed to opendir: %s", basePath);
-    return -1;
-  }
-  dirent_p = readdir(dir_p);
-  while(dirent_p != NULL) {
-    if(strcmp(dirent_p->d_name, ".") == 0 || strcmp(dirent_p->d_name, "..") == 0)
+/* TITLE, ARTIST and ALBUM from the VORBIS_COMMENT block, already UTF-8 */
+void parse_flac_info(FILE *flacFile, char *title, char *author, char *album) {
+  uint8_t hdr[4];
+  char field[MUSICDB_TITLE_LEN + 8];
+  if(flacFile == NULL) return;
+  fseek(flacFile, id3_tag_len(flacFile), SEEK_SET);
+  if(fread(hdr, 1, 4, flacFile) != 4 || memcmp(hdr, "fLaC", 4) != 0) return;
+  do {
+    if(fread(hdr, 1, 4, flacFile) != 4) return;
+    uint32_t len = (hdr[1] << 16) | (hdr[2] << 8) | hdr[3];
+    if((hdr[0] & 0x7F) != 4) {
+      fseek(flacFile, len, SEEK_CUR);
       continue;
-
-    switch(dirent_p->d_type) {
-      case 1://file
-        strcat(path, dirent_p->d_name);
-        type = check_music_file(path);
-        if(type != 0) {
-          playlist_len++;
-          memset(tmp_title, 0, sizeof(tmp_title));
-          memset(tmp_fn, 0, sizeof(tmp_fn));
-          sprintf(tmp_fn, "%s/%s", basePath, dirent_p->d_name);
-          file_p = fopen(tmp_fn, "rb");
-          if(type == 1)
-            parse_mp3_info(file_p, tmp_title, NULL, NULL);
-          else if(type == 2)
-            memcpy(tmp_title, tmp_fn, MUSICDB_TITLE_LEN);
-          fclose(file_p);
-          fwrite(tmp_fn, 1, MUSICDB_FN_LEN, db);
-          fwrite(tmp_title, 1, MUSICDB_TITLE_LEN, db);
-        }
-
-        break;
-      case 2:
-        strcat(path, dirent_p->d_name);
-        //strcat(path, "/");
-        scan_music_file(path, dep_cur + 1, dep, db);
-        break;
-      default:break;
     }
-    dirent_p = readdir(dir_p);
-    memset(path, 0, sizeof(path));
-    strcpy(path, basePath);
-  }
-  return 0;
-}
-
-void parse_mp3_info(FILE *mp3File, char *title, char *author, char *album) {
-    if(mp3File == NULL) return;
-    rewind(mp3File);
-    int tag_len = 0;
-    char tag[10];
-    int read_bytes = fread(tag, 1, 10, mp3File);
-    if(read_bytes == 10) {
-      if (memcmp(tag,"ID3",3) == 0) {
-        tag_len = ((tag[6] & 0x7F)<< 21)|((tag[7] & 0x7F) << 14) | ((tag[8] & 0x7F) << 7) | (tag[9] & 0x7F);
-        while(ftell(mp3File) <= tag_len) {
-          read_bytes = fread(tag, 1, 10, mp3File);
-          int frame_len = 0;
-          if(read_bytes == 10) {
-            frame_len = (tag[4] << 24)|(tag[5] << 16)|(tag[6] << 8)|tag[7];
-            char FrameID[5] = "", *FrameData = NULL;
-            for(int i = 0; i < 4; ++i) FrameID[i] = tag[i];
-            if(!strcmp(FrameID, "TIT2")) {
-              FrameData = title;
-            } else if(!strcmp(FrameID, "TPE1")) {
-              FrameData = author;
-            } else if(!strcmp(FrameID, "TALB")) {
-              FrameData = album;
-            } else {
-              fseek(mp3File, frame_len, SEEK_CUR);
-              continue;
-            }
-            if(FrameData == NULL) {
-              fseek(mp3File, frame_len, SEEK_CUR);
-              continue;
-            }
-            uint8_t code = 0x0;
-            fread(&code, 1, 1, mp3File);
-            fread(FrameData, 1, frame_len - 1, mp3File);
-            switch(code) {
-              case 0x00:break;//iso-8859-1
-              case 0x01:utf16_to_utf8(FrameData, frame_len - 1);break;
-              case 0x02:utf16be_to_utf8(FrameData, frame_len - 1);break;
-              case 0x03:break;
-              default:break;
-            }
-          }
-        }
-      }
-      else {
-        return;
-      }
+    uint32_t n, count;
+    if(fread(&n, 1, 4, flacFile) != 4) return; //vendor string, little endian
+    fseek(flacFile, n, SEEK_CUR);
+    if(fread(&count, 1, 4, flacFile) != 4) return;
+    while(count-- > 0 && fread(&n, 1, 4, flacFile) == 4) {
+      size_t got = fread(field, 1, min(n, sizeof(field) - 1), flacFile);
+      field[got] = 0;
+      fseek(flacFile, n - got, SEEK_CUR);
+      char *value = strchr(field, '='), *dest = NULL;
+      if(value == NULL) continue;
+      *value++ = 0;
+      if(strcasecmp(field, "TITLE") == 0) dest = title;
+      else if(strcasecmp(field, "ARTIST") == 0) dest = author;
+      else if(strcasecmp(field, "ALBUM") == 0) dest = album;
+      if(dest != NULL) strncpy(dest, value, MUSICDB_TITLE_LEN - 1);
     }
-}
-
-void utf16_to_utf8(char *data, size_t length) {
-  if(data[0] != 0xFF || data[1] != 0xFE) {
-    ESP_LOGE(TAG, "Not utf16");
     return;
-  }
-  int len = length,oOffset = 0;
-  uint16_t tmp[256];
-  uint32_t unicode = 0;
-  memset(tmp, 0, sizeof(tmp));
-  for(int i = 2; i < len; i += 2) {
-    tmp[(i - 2) / 2] = ((uint16_t)data[i + 1] << 8) | data[i];
-  }
-  len = (len - 2) / 2;
-  memset(data, 0, sizeof(char) * length);
-  for(int i = 0; i < len; ++i) {
-    if(tmp[i] < 0xD800 || tmp[i] > 0xDFFF) unicode = tmp[i];
-    else if(tmp[i] >= 0xD800 && tmp[i] <= 0xDBFF
-            && i != len - 1 && tmp[i+1] >= 0xDC00
-            && tmp[i+1] <= 0xDFFF) {
-      unicode = ((((tmp[i] - 0xD800) & 0x3FF) << 10) | ((tmp[i+1] - 0xDC00) & 0x3FF)) + 0x10000;
-      i++;
-    } else {
-      continue;
-    }
-
-    if(unicode <= 0x7F) {
-      data[oOffset] = unicode & 0x7F;
-      oOffset++;
-    } else if(unicode <= 0x7FF) {
-      data[oOffset] = ((unicode & 0x7C0) >> 6) | 0xC0;
-      data[oOffset + 1] = (unicode & 0x3F) | 0x80;
-      oOffset += 2;
-    } else if(unicode <= 0xFFFF) {
-      data[oOffset] = ((unicode & 0xF000) >> 12) | 0xE0;
-      data[oOffset + 1] = ((unicode & 0xFC0) >> 6) | 0x80;
-      data[oOffset + 2] = (unicode & 0x3F) | 0x80;
-      oOffset += 3;
-    } else {
-      data[oOffset] = ((unicode & 0x1C0000) >> 18) | 0xF0;
-      data[oOffset + 1] = ((unicode & 0x3F000) >> 12) | 0x80;
-      data[oOffset + 2] = ((unicode & 0xFC0) >> 6) | 0x80;
-      data[oOffset + 3] = (unicode & 0x3F) | 0x80;
-      oOffset += 4;
-    }
-
-  }
+  } while((hdr[0] & 0x80) == 0);
 }
 
-void utf16be_to_utf8(char *data, size_t length) {
-  if(data[0] != 0xFE || data[1] != 0xFF) {
-    ESP_LOGE(TAG, "Not utf16be");
-    return;
+/* Title, Artist and Album from the APEv2 tag at the end, before an ID3v1 tag
+ * if there is one. values are UTF-8, lists of them NUL separated */
+void parse_ape_info(FILE *apeFile, char *title, char *author, char *album) {
+  uint8_t footer[32];
+  char key[16];
+  if(apeFile == NULL) return;
+  for(int id3v1 = 0; ; id3v1 = 128) {
+    if(fseek(apeFile, -32 - id3v1, SEEK_END) != 0 || fread(footer, 1, 32, apeFile) != 32) return;
+    if(memcmp(footer, "APETAGEX", 8) == 0) break;
+    if(id3v1 != 0) return;
   }
-  int len = length,oOffset = 0;
-  uint16_t tmp[256];
-  uint32_t unicode = 0;
-  memset(tmp, 0, sizeof(tmp));
-  for(int i = 2; i < len; i += 2) {
-    tmp[(i - 2) / 2] = ((uint16_t)data[i] << 8) | data[i + 1];
-  }
-  len = (len - 2) / 2;
-  memset(data, 0, sizeof(char) * length);
-  for(int i = 0; i < len; ++i) {
-    if(tmp[i] < 0xD800 || tmp[i] > 0xDFFF) unicode = tmp[i];
-    else if(tmp[i] >= 0xD800 && tmp[i] <= 0xDBFF
-            && i != len - 1 && tmp[i+1] >= 0xDC00
-            && tmp[i+1] <= 0xDFFF) {
-      unicode = ((((tmp[i] - 0xD800) & 0x3FF) << 10) | ((tmp[i+1] - 0xDC00) & 0x3FF)) + 0x10000;
-      i++;
-    } else {
+  uint32_t size, count; //little endian
+  memcpy(&size, footer + 12, 4);
+  memcpy(&count, footer + 16, 4);
+  if(size < 32) return;
+  fseek(apeFile, -(long)size, SEEK_CUR);
+  while(count-- > 0) {
+    uint32_t len, flags;
+    int k = 0, c;
+    if(fread(&len, 1, 4, apeFile) != 4 || fread(&flags, 1, 4, apeFile) != 4) return;
+    while((c = fgetc(apeFile)) > 0)
+      if(k < sizeof(key) - 1) key[k++] = c;
+    if(c < 0) return;
+    key[k] = 0;
+    char *dest = NULL;
+    if(strcasecmp(key, "Title") == 0) dest = title;
+    else if(strcasecmp(key, "Artist") == 0) dest = author;
+    else if(strcasecmp(key, "Album") == 0) dest = album;
+    if(dest == NULL) {
+      fseek(apeFile, len, SEEK_CUR);
       continue;
     }
-
-    if(unicode <= 0x7F) {
-      data[oOffset] = unicode & 0x7F;
-      oOffset++;
-    } else if(unicode <= 0x7FF) {
-      data[oOffset] = ((unicode & 0x7C0) >> 6) | 0xC0;
-      data[oOffset + 1] = (unicode & 0x3F) | 0x80;
-      oOffset += 2;
-    } else if(unicode <= 0xFFFF) {
-      data[oOffset] = ((unicode & 0xF000) >> 12) | 0xE0;
-      data[oOffset + 1] = ((unicode & 0xFC0) >> 6) | 0x80;
-      data[oOffset + 2] = (unicode & 0x3F) | 0x80;
-      oOffset += 3;
-    } else {
-      data[oOffset] = ((unicode & 0x1C0000) >> 18) | 0xF0;
-      data[oOffset + 1] = ((unicode & 0x3F000) >> 12) | 0x80;
-      data[oOffset + 2] = ((unicode & 0xFC0) >> 6) | 0x80;
-      data[oOffset + 3] = (unicode & 0x3F) | 0x80;
-      oOffset += 4;
-    }
-
+    size_t got = fread(dest, 1, min(len, MUSICDB_TITLE_LEN - 1), apeFile);
+    dest[got] = 0;
+    fseek(apeFile, len - got, SEEK_CUR);
   }
 }
+
@@ -3,6 +3,10 @@
 
 #define MAINBUF_SIZE    1940
 #define MIN_VOL_OFFSET -50
+#define WAV_CHUNK_FRAMES 768
+#define WAV_FORMAT_PCM 0x0001
+#define WAV_FORMAT_EXTENSIBLE 0xFFFE
+#define FLAC_OUT_FRAMES 1024
 
 #define CCCC(c1, c2, c3, c4)    ((c4 << 24) | (c3 << 16) | (c2 << 8) | c1)
 #define PIN_PD 4
@@ -19,11 +23,6 @@ typedef enum {
 } musicType_t;
 
 extern int playlist_len, nowplay_offset, list_offset;
-/* these are data structures to process wav file */
-typedef enum {
-    HEADER_RIFF, HEADER_FMT, HEADER_DATA, DATA
-} headerState_t;
-
 typedef struct {
     bool paused, started;
     uint16_t totalTime;
@@ -37,9 +36,11 @@ typedef struct {
     FILE *filePtr;
     int playMode;
     int volume; //0 - 100%
-    double volumeMultiplier;
+    int32_t volumeGain; //Q15, see gain.h
     musicType_t musicType;
-    bool musicChanged;
+    int bufferFill; //0 - 100% of the pcm ring buffer
+    uint32_t underruns;
+    int seekTo; //seconds, -1 = no pending seek
 } playerState_t;
 
 typedef struct {
@@ -58,31 +59,59 @@ typedef struct {
     uint16_t blockAlign;
     uint16_t bitsPerSample;
 } wavProperties_t;
-/* variables hold file, state of process wav file and wav file properties */
+
+/* where the pcm data of a wav file lives, computed once from the chunk list */
+typedef struct {
+    wavProperties_t props;
+    size_t dataOffset;
+    size_t dataSize;
+    int bytesPerSample;
+} wavLayout_t;
+
+typedef enum {
+    PRELOAD_IDLE = 0, PRELOAD_READY
+} preloadState_t;
+
+/* the track queued after the current one, opened and tagged while the
+ * current one is still playing */
+typedef struct {
+    preloadState_t state;
+    int offset;
+    uint32_t generation; //of the library offset is from
+    FILE *filePtr;
+    char fileName[MUSICDB_FN_LEN];
+    char title[MUSICDB_TITLE_LEN];
+    char author[128];
+    char album[128];
+} preloadTrack_t;
 
 extern playerState_t playerState;
+extern int i2s_num;
 
 size_t readNBytes(FILE *file, void *data, int count);
 size_t read4bytes(FILE *file, uint32_t *chunkId);
 size_t readRiff(FILE *file, wavRiff_t *wavRiff);
 size_t readProps(FILE *file, wavProperties_t *wavProps);
+esp_err_t wavParseLayout(FILE *file, wavLayout_t *layout);
 esp_err_t wavPlay(FILE *wavFile);
 void mp3Play(FILE *mp3File);
+esp_err_t flacPlay(FILE *flacFile);
+esp_err_t apePlay(FILE *apeFile);
 void setVolume(int vol);
 int getVolumePercentage();
 esp_err_t i2s_init();
 esp_err_t i2s_deinit();
 void dac_mute(bool m);
 void player_pause(bool p);
+void player_seek(int sec);
 void parseMusicType();
 int getMusicType();
 void setNowPlaying(char *str);
 bool isPaused();
 FILE* musicFileOpen();
 void taskPlay(void *parameter);
+void taskPreload(void *parameter);
 
-int scan_music_file(const char *basePath, int dep_cur, const int dep, FILE *db);
-void parse_mp3_info(FILE *mp3File, char *title, char *author, char *album);
-void utf16_to_utf8(char *data, size_t length);
-void utf16be_to_utf8(char *data, size_t length);
+void parse_flac_info(FILE *flacFile, char *title, char *author, char *album);
+void parse_ape_info(FILE *apeFile, char *title, char *author, char *album);
 #endif
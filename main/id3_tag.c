@@ -0,0 +1,402 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <limits.h>
+
+#include "id3_tag.h"
+
+#ifndef min
+  #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#define ID3_LATIN1 0
+#define ID3_UTF16 1 //with a byte order mark
+#define ID3_UTF16BE 2
+#define ID3_UTF8 3
+
+typedef enum {
+  FRAME_OTHER = 0, FRAME_TITLE, FRAME_ARTIST, FRAME_ALBUM, FRAME_TRACK, FRAME_LENGTH,
+  FRAME_PICTURE, FRAME_USER, FRAME_VOLUME
+} frameKind_t;
+
+//v2.2 ids are three characters
+static const struct {
+  char id22[4], id[5];
+  frameKind_t kind;
+} frameIds[] = {
+  {"TT2", "TIT2", FRAME_TITLE}, {"TP1", "TPE1", FRAME_ARTIST}, {"TAL", "TALB", FRAME_ALBUM},
+  {"TRK", "TRCK", FRAME_TRACK}, {"TLE", "TLEN", FRAME_LENGTH}, {"PIC", "APIC", FRAME_PICTURE},
+  {"TXX", "TXXX", FRAME_USER}, {"", "RVA2", FRAME_VOLUME}
+};
+
+/* the tag is read front to back through a window of the bytes as stored,
+ * frames that aren't wanted are skipped over without being read */
+typedef struct {
+  const id3Io_t *io;
+  uint32_t offset; //of buf[0]
+  uint32_t end; //of the frames
+  int pos, len;
+  bool ff; //the last byte taken was 0xFF, a 0x00 after it is unsynchronisation
+  uint8_t buf[ID3_WINDOW];
+} id3Window_t;
+
+/* what is left of a frame. v2.4 sizes count the stored bytes, v2.2 and v2.3
+ * sizes count them after a tag wide unsynchronisation is undone (resynced) */
+typedef struct {
+  uint32_t left;
+  bool unsync, resynced;
+} id3Frame_t;
+
+static uint32_t syncsafe(const uint8_t *b) {
+  return ((b[0] & 0x7F) << 21) | ((b[1] & 0x7F) << 14) | ((b[2] & 0x7F) << 7) | (b[3] & 0x7F);
+}
+
+static uint32_t be32(const uint8_t *b) {
+  return ((uint32_t)b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3];
+}
+
+static uint32_t win_at(const id3Window_t *w) {
+  return w->offset + w->pos;
+}
+
+static bool win_fill(id3Window_t *w) {
+  int keep = w->len - w->pos;
+  memmove(w->buf, w->buf + w->pos, keep);
+  w->offset += w->pos;
+  w->pos = 0;
+  w->len = keep;
+  uint32_t want = min((uint32_t)(ID3_WINDOW - keep), w->end - (w->offset + keep));
+  if(want == 0) return false;
+  size_t got = w->io->read(w->io->ctx, w->buf + keep, want);
+  w->len += got;
+  return got > 0;
+}
+
+static bool win_skip(id3Window_t *w, uint32_t n) {
+  uint32_t buffered = w->len - w->pos;
+  if(n <= buffered) {
+    w->pos += n;
+    return true;
+  }
+  n -= buffered;
+  w->offset += w->len;
+  w->pos = w->len = 0;
+  if(n > w->end - w->offset || w->io->skip(w->io->ctx, n) != 0) return false;
+  w->offset += n;
+  return true;
+}
+
+/* up to n bytes of the frame into dst, or dropped with dst NULL. returns
+ * how many, fewer only at the end of the frame or of the stream */
+static int frame_take(id3Window_t *w, id3Frame_t *f, uint8_t *dst, int n) {
+  int got = 0;
+  while(got < n && f->left > 0) {
+    if(w->pos == w->len && win_fill(w) == false) {
+      f->left = 0;
+      break;
+    }
+    //copied as they are up to and including the next 0xFF
+    if(f->unsync == false || w->ff == false) {
+      int k = min((uint32_t)min(n - got, w->len - w->pos), f->left);
+      if(f->unsync == true) {
+        uint8_t *ff = memchr(w->buf + w->pos, 0xFF, k);
+        if(ff != NULL) {
+          k = ff - (w->buf + w->pos) + 1;
+          w->ff = true;
+        }
+      }
+      if(dst != NULL) memcpy(dst + got, w->buf + w->pos, k);
+      w->pos += k;
+      got += k;
+      f->left -= k;
+      continue;
+    }
+    w->ff = false;
+    if(w->buf[w->pos] == 0) { //not data, counted only by v2.4 sizes
+      w->pos++;
+      if(f->resynced == false) f->left--;
+    }
+  }
+  return got;
+}
+
+static void frame_skip(id3Window_t *w, id3Frame_t *f) {
+  if(f->resynced == true) {
+    frame_take(w, f, NULL, INT_MAX);
+    return;
+  }
+  //a stream shorter than its tag ends the frame loop
+  if(win_skip(w, f->left) == false) w->end = win_at(w);
+  f->left = 0;
+}
+
+/* appends cp unless it doesn't fit whole in len, including the NUL */
+static bool put_utf8(char *dst, int *o, int len, uint32_t cp) {
+  int n = cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+  if(*o + n >= len) return false;
+  char *d = dst + *o;
+  switch(n) {
+    case 1: d[0] = cp; break;
+    case 2: d[0] = 0xC0 | (cp >> 6); d[1] = 0x80 | (cp & 0x3F); break;
+    case 3: d[0] = 0xE0 | (cp >> 12); d[1] = 0x80 | ((cp >> 6) & 0x3F); d[2] = 0x80 | (cp & 0x3F); break;
+    default:
+      d[0] = 0xF0 | (cp >> 18); d[1] = 0x80 | ((cp >> 12) & 0x3F);
+      d[2] = 0x80 | ((cp >> 6) & 0x3F); d[3] = 0x80 | (cp & 0x3F);
+    break;
+  }
+  *o += n;
+  return true;
+}
+
+/* one string in enc from src into dst as UTF-8, cut at a whole character
+ * when it doesn't fit. returns the bytes of src used, terminator included */
+static int text_utf8(uint8_t enc, const uint8_t *src, int n, char *dst, int len) {
+  int i = 0, o = 0;
+  bool full = false, be = enc == ID3_UTF16BE;
+  if(enc == ID3_UTF16 && n >= 2) {
+    if(src[0] == 0xFE && src[1] == 0xFF) be = true;
+    if((src[0] == 0xFE && src[1] == 0xFF) || (src[0] == 0xFF && src[1] == 0xFE)) i = 2;
+  }
+  while(i < n) {
+    uint32_t cp;
+    if(enc == ID3_UTF16 || enc == ID3_UTF16BE) {
+      if(i + 1 >= n) {
+        i = n;
+        break;
+      }
+      uint16_t u = be ? (src[i] << 8) | src[i + 1] : (src[i + 1] << 8) | src[i];
+      i += 2;
+      if(u == 0) break;
+      if(u >= 0xDC00 && u <= 0xDFFF) continue;
+      cp = u;
+      if(u >= 0xD800 && u <= 0xDBFF) {
+        if(i + 1 >= n) continue;
+        uint16_t l = be ? (src[i] << 8) | src[i + 1] : (src[i + 1] << 8) | src[i];
+        if(l < 0xDC00 || l > 0xDFFF) continue;
+        cp = 0x10000 + ((u - 0xD800) << 10) + (l - 0xDC00);
+        i += 2;
+      }
+    } else if(enc == ID3_UTF8) {
+      uint8_t c = src[i];
+      if(c == 0) {
+        i++;
+        break;
+      }
+      int k = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+      if(i + k > n) k = n - i;
+      if(full == false && o + k < len) {
+        memcpy(dst + o, src + i, k);
+        o += k;
+      } else {
+        full = true;
+      }
+      i += k;
+      continue;
+    } else {
+      cp = src[i++]; //ISO-8859-1 is the first 256 code points
+      if(cp == 0) break;
+    }
+    if(full == false) full = !put_utf8(dst, &o, len, cp);
+  }
+  if(len > 0) dst[o] = 0;
+  return i;
+}
+
+/* "-6.50 dB" in 1/100 dB */
+static int16_t parse_gain(const char *s) {
+  char *end;
+  float db = strtof(s, &end);
+  if(end == s || db < -300 || db > 300) return ID3_GAIN_NONE;
+  return (int16_t)(db * 100 + (db < 0 ? -0.5f : 0.5f));
+}
+
+static frameKind_t frame_kind(const uint8_t *id, int idLen) {
+  for(int i = 0; i < sizeof(frameIds) / sizeof(frameIds[0]); ++i) {
+    const char *name = idLen == 3 ? frameIds[i].id22 : frameIds[i].id;
+    if(name[0] != 0 && memcmp(id, name, idLen) == 0) return frameIds[i].kind;
+  }
+  return FRAME_OTHER;
+}
+
+static void read_text(id3Window_t *w, id3Frame_t *f, uint8_t *text, char *dst, int len) {
+  int n = frame_take(w, f, text, ID3_TEXT_LEN * 2);
+  if(n > 1) text_utf8(text[0], text + 1, n - 1, dst, len);
+}
+
+/* REPLAYGAIN_TRACK_GAIN and REPLAYGAIN_ALBUM_GAIN as foobar2000 and
+ * most taggers write them */
+static void read_user(id3Window_t *w, id3Frame_t *f, uint8_t *text, id3Info_t *info) {
+  char desc[32], value[16];
+  int n = frame_take(w, f, text, ID3_TEXT_LEN * 2);
+  if(n < 2) return;
+  int used = text_utf8(text[0], text + 1, n - 1, desc, sizeof(desc));
+  text_utf8(text[0], text + 1 + used, n - 1 - used, value, sizeof(value));
+  if(strcasecmp(desc, "REPLAYGAIN_TRACK_GAIN") == 0) info->trackGain = parse_gain(value);
+  else if(strcasecmp(desc, "REPLAYGAIN_ALBUM_GAIN") == 0) info->albumGain = parse_gain(value);
+}
+
+/* identification, then per channel: type, volume in 1/512 dB and peak */
+static void read_volume(id3Window_t *w, id3Frame_t *f, uint8_t *text, id3Info_t *info) {
+  int n = frame_take(w, f, text, ID3_TEXT_LEN * 2), i = 0;
+  while(i < n && text[i] != 0) ++i;
+  bool album = i == 5 && strncasecmp((char *)text, "album", 5) == 0;
+  for(++i; i + 4 <= n; i += 4 + (text[i + 3] + 7) / 8) {
+    if(text[i] != 1) continue; //master volume
+    int16_t adj = (text[i + 1] << 8) | text[i + 2];
+    int16_t gain = adj >= 0 ? (adj * 100 + 256) / 512 : (adj * 100 - 256) / 512;
+    if(album == true) info->albumGain = gain;
+    else info->trackGain = gain;
+    return;
+  }
+}
+
+static void read_picture(id3Window_t *w, id3Frame_t *f, uint8_t major, id3Info_t *info) {
+  uint8_t enc, type, c[3];
+  char mime[ID3_MIME_LEN];
+  int n = 0;
+  if(frame_take(w, f, &enc, 1) != 1) return;
+  if(major == 2) { //image format instead of a mime type
+    if(frame_take(w, f, c, 3) != 3) return;
+    strcpy(mime, memcmp(c, "PNG", 3) == 0 ? "image/png" : "image/jpeg");
+  } else {
+    while(frame_take(w, f, c, 1) == 1 && c[0] != 0)
+      if(n < sizeof(mime) - 1) mime[n++] = c[0];
+    mime[n] = 0;
+  }
+  if(frame_take(w, f, &type, 1) != 1) return;
+  //the first picture, replaced only by a front cover
+  if(info->pictureOffset != 0 && (info->pictureType == ID3_FRONT_COVER || type != ID3_FRONT_COVER))
+    return;
+  int unit = enc == ID3_UTF16 || enc == ID3_UTF16BE ? 2 : 1;
+  do {
+    if(frame_take(w, f, c, unit) != unit) return;
+  } while(c[0] != 0 || c[unit - 1] != 0);
+  info->pictureOffset = win_at(w);
+  info->pictureUnsync = f->unsync;
+  info->pictureType = type;
+  strcpy(info->pictureMime, mime);
+  if(f->resynced == false) {
+    info->pictureBytes = f->left;
+    return;
+  }
+  frame_skip(w, f);
+  info->pictureBytes = win_at(w) - info->pictureOffset;
+}
+
+/* the wanted frames of an ID3v2 tag at the start of io in one pass. returns
+ * 0 when there is a tag, -1 without one */
+int id3_parse(const id3Io_t *io, id3Info_t *info) {
+  id3Window_t w;
+  uint8_t text[ID3_TEXT_LEN * 2];
+  memset(info, 0, sizeof(id3Info_t));
+  info->trackGain = info->albumGain = ID3_GAIN_NONE;
+  w.io = io;
+  w.offset = 0;
+  w.end = ID3_HEADER;
+  w.pos = w.len = 0;
+  w.ff = false;
+  while(w.len < ID3_HEADER)
+    if(win_fill(&w) == false) return -1;
+  const uint8_t *h = w.buf;
+  if(memcmp(h, "ID3", 3) != 0 || h[3] < 2 || h[3] > 4 || ((h[6] | h[7] | h[8] | h[9]) & 0x80))
+    return -1;
+  uint8_t major = h[3], flags = h[5];
+  bool tagUnsync = (flags & 0x80) != 0;
+  info->version = major;
+  info->tagBytes = ID3_HEADER + syncsafe(h + 6) + (major == 4 && (flags & 0x10) ? ID3_HEADER : 0);
+  w.pos = ID3_HEADER;
+  w.end = ID3_HEADER + syncsafe(h + 6);
+  if(major == 2 && (flags & 0x40)) return 0; //compressed, no scheme was ever defined
+  if(flags & 0x40) { //extended header, only skipped
+    uint8_t b[4];
+    id3Frame_t f = {4, tagUnsync && major == 3, true};
+    if(frame_take(&w, &f, b, 4) != 4) return 0;
+    if(major == 4 && syncsafe(b) < 4) return 0;
+    f.left = major == 3 ? be32(b) : syncsafe(b) - 4;
+    f.resynced = f.unsync;
+    if(f.resynced == false && f.left > w.end - win_at(&w)) return 0;
+    frame_skip(&w, &f);
+  }
+  int idLen = major == 2 ? 3 : 4, hdrLen = major == 2 ? 6 : 10;
+  while(win_at(&w) + hdrLen <= w.end) {
+    uint8_t fh[10];
+    id3Frame_t f = {hdrLen, tagUnsync && major < 4, true};
+    if(frame_take(&w, &f, fh, hdrLen) != hdrLen || fh[0] == 0) break; //padding
+    bool valid = true;
+    for(int i = 0; i < idLen; ++i)
+      valid &= (fh[i] >= 'A' && fh[i] <= 'Z') || (fh[i] >= '0' && fh[i] <= '9');
+    if(valid == false) break;
+    uint8_t fl = major == 2 ? 0 : fh[9];
+    if(major == 2) f.left = (fh[3] << 16) | (fh[4] << 8) | fh[5];
+    //iTunes wrote plain sizes into v2.4 tags, those have bits syncsafe ones can't
+    else if(major == 4 && ((fh[4] | fh[5] | fh[6] | fh[7]) & 0x80) == 0) f.left = syncsafe(fh + 4);
+    else f.left = be32(fh + 4);
+    if(major == 4) {
+      f.unsync = tagUnsync || (fl & 0x02);
+      f.resynced = false;
+      w.ff = false;
+    } else {
+      f.resynced = f.unsync;
+    }
+    if(f.resynced == false && f.left > w.end - win_at(&w)) break; //runs past the tag
+    frameKind_t kind = frame_kind(fh, idLen);
+    //compressed or encrypted frames are skipped, group ids and data lengths dropped
+    if(major == 3) {
+      if(fl & 0xC0) kind = FRAME_OTHER;
+      else if(fl & 0x20) frame_take(&w, &f, NULL, 1);
+    } else if(major == 4) {
+      if(fl & 0x0C) kind = FRAME_OTHER;
+      else frame_take(&w, &f, NULL, ((fl & 0x40) ? 1 : 0) + ((fl & 0x01) ? 4 : 0));
+    }
+    char num[16] = "";
+    switch(kind) {
+      case FRAME_TITLE:
+        if(info->title[0] == 0) read_text(&w, &f, text, info->title, ID3_TEXT_LEN);
+      break;
+      case FRAME_ARTIST:
+        if(info->artist[0] == 0) read_text(&w, &f, text, info->artist, ID3_TEXT_LEN);
+      break;
+      case FRAME_ALBUM:
+        if(info->album[0] == 0) read_text(&w, &f, text, info->album, ID3_TEXT_LEN);
+      break;
+      case FRAME_TRACK: //"3" or "3/12"
+        read_text(&w, &f, text, num, sizeof(num));
+        info->track = atoi(num);
+      break;
+      case FRAME_LENGTH:
+        read_text(&w, &f, text, num, sizeof(num));
+        info->lengthMs = strtoul(num, NULL, 10);
+      break;
+      case FRAME_PICTURE: read_picture(&w, &f, major, info); break;
+      case FRAME_USER: read_user(&w, &f, text, info); break;
+      case FRAME_VOLUME: read_volume(&w, &f, text, info); break;
+      default: break;
+    }
+    frame_skip(&w, &f);
+  }
+  return 0;
+}
+
+static size_t file_read(void *ctx, uint8_t *buf, size_t len) {
+  return fread(buf, 1, len, (FILE *)ctx);
+}
+
+static int file_skip(void *ctx, uint32_t bytes) {
+  return fseek((FILE *)ctx, bytes, SEEK_CUR);
+}
+
+/* the tag at the start of file, offsets in info are file offsets */
+int id3_parse_file(FILE *file, id3Info_t *info) {
+  id3Io_t io = {file_read, file_skip, file};
+  rewind(file);
+  return id3_parse(&io, info);
+}
+
+/* size of a leading ID3v2 tag including its header and footer, 0 without one */
+int id3_tag_len(FILE *file) {
+  uint8_t tag[ID3_HEADER];
+  rewind(file);
+  if(fread(tag, 1, ID3_HEADER, file) != ID3_HEADER || memcmp(tag, "ID3", 3) != 0) return 0;
+  return syncsafe(tag + 6) + ID3_HEADER + (tag[3] == 4 && (tag[5] & 0x10) ? ID3_HEADER : 0);
+}
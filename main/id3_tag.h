@@ -0,0 +1,44 @@
+#ifndef _ID3_TAG_H_
+#define _ID3_TAG_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ID3_HEADER 10
+#define ID3_WINDOW 512 //bytes of the tag buffered at a time
+#define ID3_TEXT_LEN 128 //same as MUSICDB_TITLE_LEN
+#define ID3_MIME_LEN 24
+#define ID3_GAIN_NONE INT16_MIN
+#define ID3_FRONT_COVER 3 //picture type
+
+/* where the tag comes from. read returns how many bytes it stored, skip
+ * moves past bytes without them being read and returns 0 on success */
+typedef struct {
+  size_t (*read)(void *ctx, uint8_t *buf, size_t len);
+  int (*skip)(void *ctx, uint32_t bytes);
+  void *ctx;
+} id3Io_t;
+
+/* the frames the library and the player use. text is UTF-8 and empty when
+ * the frame is missing, offsets are from the start of the tag */
+typedef struct {
+  uint8_t version; //major, 2 to 4
+  uint32_t tagBytes; //header, frames, padding and footer
+  char title[ID3_TEXT_LEN], artist[ID3_TEXT_LEN], album[ID3_TEXT_LEN]; //TIT2, TPE1, TALB
+  uint16_t track; //TRCK, 0 = unknown
+  uint32_t lengthMs; //TLEN, 0 = unknown
+  int16_t trackGain, albumGain; //1/100 dB from RVA2 or replaygain TXXX, or ID3_GAIN_NONE
+  /* the front cover, or the first picture when there is none. the image is
+   * pictureBytes as stored from pictureOffset, with 0xFF 0x00 pairs still
+   * to be turned back into 0xFF when pictureUnsync is set. 0 = no picture */
+  uint32_t pictureOffset, pictureBytes;
+  bool pictureUnsync;
+  uint8_t pictureType;
+  char pictureMime[ID3_MIME_LEN];
+} id3Info_t;
+
+int id3_parse(const id3Io_t *io, id3Info_t *info);
+int id3_parse_file(FILE *file, id3Info_t *info);
+int id3_tag_len(FILE *file);
+#endif
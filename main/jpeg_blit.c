@@ -0,0 +1,81 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "jpeg_blit.h"
+
+#ifndef min
+  #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+  #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#define RGB565(r, g, b) ((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | ((b) >> 3))
+#define SWAP16(c) ((uint16_t)(((c) >> 8) | ((c) << 8)))
+
+/* bayer matrix scaled to below one step of the 5 and the 6 bit channels */
+static const uint8_t ditherRB[4][4] = {
+  {0, 4, 1, 5}, {6, 2, 7, 3}, {1, 5, 0, 4}, {7, 3, 6, 2}
+};
+static const uint8_t ditherG[4][4] = {
+  {0, 2, 0, 2}, {3, 1, 3, 1}, {0, 2, 0, 2}, {3, 1, 3, 1}
+};
+
+/* n pixels step bytes apart in the MCU buffers, x is the destination column
+ * of the first one for the dither pattern */
+static inline void blit_run(uint16_t *d, const uint8_t *r, const uint8_t *g, const uint8_t *b,
+                            int n, int step, int x, const uint8_t *dRB, const uint8_t *dG, bool swap) {
+  if(dRB == NULL) {
+    for(int i = 0; i < n; ++i, r += step, g += step, b += step) {
+      uint16_t c = RGB565(*r, *g, *b);
+      d[i] = swap ? SWAP16(c) : c;
+    }
+    return;
+  }
+  for(int i = 0; i < n; ++i, r += step, g += step, b += step) {
+    int k = (x + i) & 3;
+    uint16_t c = RGB565(min(*r + dRB[k], 255), min(*g + dG[k], 255), min(*b + dRB[k], 255));
+    d[i] = swap ? SWAP16(c) : c;
+  }
+}
+
+/* the blocks of an MCU are 64 bytes each, side by side at +64 and one below
+ * the other at +128, pixels in raster order within a block. in reduce mode
+ * only the first byte of each block is set */
+void jpeg_blit_mcu(const pjpeg_image_info_t *info, int mcuX, int mcuY, const jpegBlit_t *dst) {
+  bool reduce = (dst->flags & JPEG_BLIT_REDUCED) != 0, swap = (dst->flags & JPEG_BLIT_SWAP) != 0;
+  int shift = reduce ? 3 : 0;
+  int mw = info->m_MCUWidth >> shift, mh = info->m_MCUHeight >> shift;
+  int imgW = (info->m_width + (1 << shift) - 1) >> shift, imgH = (info->m_height + (1 << shift) - 1) >> shift;
+  int ox = mcuX * mw, oy = mcuY * mh;
+  //the part of the MCU inside both the image and the destination, in image pixels
+  int xa = max(ox, dst->x0), xb = min(min(ox + mw, imgW), dst->x0 + dst->width);
+  int ya = max(oy, dst->y0), yb = min(min(oy + mh, imgH), dst->y0 + dst->height);
+  if(xa >= xb || ya >= yb) return;
+  const uint8_t *R = info->m_pMCUBufR;
+  const uint8_t *G = info->m_scanType == PJPG_GRAYSCALE ? R : info->m_pMCUBufG;
+  const uint8_t *B = info->m_scanType == PJPG_GRAYSCALE ? R : info->m_pMCUBufB;
+  for(int y = ya; y < yb; ++y) {
+    int py = y - oy, dy = y - dst->y0;
+    uint16_t *d = dst->pixels + dy * dst->stride + xa - dst->x0;
+    const uint8_t *dRB = NULL, *dG = NULL;
+    if(dst->flags & JPEG_BLIT_DITHER) {
+      dRB = ditherRB[dy & 3];
+      dG = ditherG[dy & 3];
+    }
+    if(reduce == true) {
+      int i = py * 128 + (xa - ox) * 64;
+      blit_run(d, R + i, G + i, B + i, xb - xa, 64, xa - dst->x0, dRB, dG, swap);
+      continue;
+    }
+    //at most two runs, one per block of the row
+    int row = (py >> 3) * 128 + (py & 7) * 8;
+    for(int x = xa; x < xb;) {
+      int px = x - ox, n = min(8 - (px & 7), xb - x), i = row + (px >> 3) * 64 + (px & 7);
+      blit_run(d, R + i, G + i, B + i, n, 1, x - dst->x0, dRB, dG, swap);
+      d += n;
+      x += n;
+    }
+  }
+}
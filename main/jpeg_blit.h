@@ -0,0 +1,23 @@
+#ifndef _JPEG_BLIT_H_
+#define _JPEG_BLIT_H_
+
+#include <stdint.h>
+#include "picojpeg.h"
+
+#define JPEG_BLIT_REDUCED 1 //decoded with reduce set, one pixel per 8x8 block
+#define JPEG_BLIT_SWAP 2 //high byte first, the order the ILI9341 takes
+#define JPEG_BLIT_DITHER 4 //4x4 ordered dither instead of truncating to 5/6/5 bits
+
+/* an RGB565 destination for picojpeg's MCUs. pixel x, y of the image lands
+ * at pixels[(y - y0) * stride + x - x0], only the width x height rectangle
+ * there is written */
+typedef struct {
+  uint16_t *pixels;
+  int stride; //in pixels
+  int width, height;
+  int x0, y0;
+  int flags;
+} jpegBlit_t;
+
+void jpeg_blit_mcu(const pjpeg_image_info_t *info, int mcuX, int mcuY, const jpegBlit_t *dst);
+#endif
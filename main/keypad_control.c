@@ -12,6 +12,7 @@
 #include "../lvgl/lv_core/lv_indev.h"
 #include "i2s_dac.h"
 #include "ledc.h"
+#include "ui_event.h"
 
 #include "keypad_control.h"
 
@@ -53,11 +54,15 @@ void taskScanKey(void *patameter) {
 			last_key = keyEvent.key_name;
 			state = LV_INDEV_STATE_PR;
 			xQueueSend(Queue_Key, (void*)(&keyEvent), (TickType_t) 10);
+			TickType_t pressed = xTaskGetTickCount();
 			while(adc1_get_raw(ADC1_CHANNEL_3) != 0) vTaskDelay(10 / portTICK_RATE_MS);
 			//ESP_LOGI(TAG, "key %i released.", keyEvent.key_name);
 			keyEvent.state = KEY_RELEASED;
 			state = LV_INDEV_STATE_REL;
 			xQueueSend(Queue_Key, (void*)(&keyEvent), (TickType_t) 10);
+			//littlevgl gets the key for focus and clicks, the UI for its menus
+			if(xTaskGetTickCount() - pressed >= KEY_LONG_PRESS) ui_post(UI_EVENT_KEY, keyEvent.key_name | UI_KEY_LONG);
+			else ui_post(UI_EVENT_KEY, keyEvent.key_name);
 			key_last_tick = xTaskGetTickCount();
 			vTaskDelay(10 / portTICK_RATE_MS);
 		}
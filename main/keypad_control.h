@@ -7,6 +7,7 @@
 #define KEY_RELEASED 0
 
 #define KEY_MID 0x70
+#define KEY_LONG_PRESS (600 / portTICK_RATE_MS) //held this long the UI gets UI_KEY_LONG
 
 typedef struct {
 	uint32_t key_name;
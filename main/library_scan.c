@@ -0,0 +1,318 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include "sys/stat.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "i2s_dac.h"
+#include "mp3_seek.h"
+#include "music_db.h"
+#include "id3_tag.h"
+#include "library_scan.h"
+#include "ui_event.h"
+#include "fnv1a.h"
+
+#ifndef min
+  #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+  #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#define SCAN_CHECKPOINT_MAGIC CCCC('S', 'C', 'N', 'P')
+
+/* the walk state saved to SCAN_CHECKPOINT_PATH, followed by stackBytes of
+ * NUL terminated directory paths still to be walked */
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t dirs, files, added;
+  uint32_t stackBytes;
+} scanCheckpoint_t;
+
+static const char *TAG = "LIB_SCAN";
+
+static TaskHandle_t scanTask = NULL;
+static scanProgress_t progress;
+
+//directories still to be walked, depth first from the end
+static char *stack;
+static uint32_t stackBytes, stackCap;
+
+static int check_music_file(char* filename) {
+  char l[5];
+  memset(l, 0, sizeof(l));
+  int len = strlen(filename);
+  for(int i = 0; i < 4; ++i) {
+    l[i] = filename[len - (4 - i)];
+  }
+  if(strcmp(l,".mp3") == 0 || strcmp(l, ".MP3") == 0)
+    return 1;
+  else if(strcmp(l, ".wav") == 0 || strcmp(l, ".WAV") == 0) return 2;
+  else if(strcmp(l, "flac") == 0 || strcmp(l, "FLAC") == 0) return 3;
+  else if(strcmp(l, ".ape") == 0 || strcmp(l, ".APE") == 0) return 4;
+
+  return 0;
+}
+
+/* length in seconds from the stream headers only, 0 if it can't be told */
+static uint16_t probe_duration(FILE *file, int type, const char *fileName) {
+  uint8_t b[32];
+  wavLayout_t layout;
+  uint64_t sec = 0;
+  switch(type) {
+    case 1:
+      sec = mp3_probe_duration(file, fileName, id3_tag_len(file));
+    break;
+    case 2:
+      if(wavParseLayout(file, &layout) == ESP_OK && layout.props.byteRate != 0)
+        sec = layout.dataSize / layout.props.byteRate;
+    break;
+    case 3: //STREAMINFO is always the first metadata block
+      fseek(file, id3_tag_len(file), SEEK_SET);
+      if(fread(b, 1, 26, file) == 26 && memcmp(b, "fLaC", 4) == 0 && (b[4] & 0x7F) == 0) {
+        uint32_t rate = (b[18] << 12) | (b[19] << 4) | (b[20] >> 4);
+        uint64_t samples = ((uint64_t)(b[21] & 0x0F) << 32) | ((uint32_t)b[22] << 24)
+          | (b[23] << 16) | (b[24] << 8) | b[25];
+        if(rate != 0) sec = samples / rate;
+      }
+    break;
+    case 4: { //descriptor then header, little endian
+      uint32_t descBytes, blocksPerFrame, finalBlocks, frames, rate;
+      int tagLen = id3_tag_len(file); //offsets count from the descriptor
+      fseek(file, tagLen, SEEK_SET);
+      if(fread(b, 1, 12, file) != 12 || memcmp(b, "MAC ", 4) != 0) break;
+      memcpy(&descBytes, b + 8, 4);
+      fseek(file, tagLen + descBytes, SEEK_SET);
+      if(fread(b, 1, 24, file) != 24) break;
+      memcpy(&blocksPerFrame, b + 4, 4);
+      memcpy(&finalBlocks, b + 8, 4);
+      memcpy(&frames, b + 12, 4);
+      memcpy(&rate, b + 20, 4);
+      if(frames != 0 && rate != 0)
+        sec = ((uint64_t)(frames - 1) * blocksPerFrame + finalBlocks) / rate;
+    } break;
+    default:break;
+  }
+  return min(sec, UINT16_MAX);
+}
+
+/* reads the tags of a new or changed file into the library */
+static void scan_file(const char *fileName, int type, const struct stat *st) {
+  static id3Info_t tags; //only the scan task gets here
+  musicdbRecord_t r;
+  memset(&r, 0, sizeof(r));
+  memset(&tags, 0, sizeof(tags));
+  FILE *file_p = fopen(fileName, "rb");
+  if(file_p == NULL) return;
+  if(type == 1)
+    id3_parse_file(file_p, &tags);
+  else if(type == 3)
+    parse_flac_info(file_p, tags.title, tags.artist, tags.album);
+  else if(type == 4)
+    parse_ape_info(file_p, tags.title, tags.artist, tags.album);
+  r.duration = probe_duration(file_p, type, fileName);
+  if(r.duration == 0) r.duration = min(tags.lengthMs / 1000, UINT16_MAX);
+  fclose(file_p);
+  //untagged files are listed by their name
+  if(tags.title[0] == 0) strncpy(tags.title, strrchr(fileName, '/') + 1, MUSICDB_TITLE_LEN - 1);
+  r.type = type == 1 ? MP3 : type == 2 ? WAV : type == 3 ? FLAC : APE;
+  r.size = st->st_size;
+  r.mtime = st->st_mtime;
+  if(musicdb_add(&r, fileName, tags.title, tags.artist, tags.album) == ESP_OK)
+    playlist_len = musicdb_count();
+}
+
+static bool push_dir(const char *path) {
+  uint32_t len = strlen(path) + 1;
+  if(stackBytes + len > stackCap) {
+    uint32_t cap = stackCap * 2 + len;
+    char *s = heap_caps_realloc(stack, cap, MALLOC_CAP_SPIRAM);
+    if(s == NULL) return false;
+    stack = s;
+    stackCap = cap;
+  }
+  memcpy(stack + stackBytes, path, len);
+  stackBytes += len;
+  progress.pending++;
+  return true;
+}
+
+static bool pop_dir(char *path) {
+  if(stackBytes == 0) return false;
+  uint32_t start = stackBytes - 1;
+  while(start > 0 && stack[start - 1] != 0) start--;
+  strcpy(path, stack + start);
+  stackBytes = start;
+  progress.pending--;
+  return true;
+}
+
+static void save_checkpoint() {
+  scanCheckpoint_t c = {SCAN_CHECKPOINT_MAGIC, SCAN_CHECKPOINT_VERSION,
+    progress.dirs, progress.files, progress.added, stackBytes};
+  FILE *f = fopen(SCAN_CHECKPOINT_PATH, "wb");
+  if(f == NULL) return;
+  fwrite(&c, 1, sizeof(c), f);
+  fwrite(stack, 1, stackBytes, f);
+  fclose(f);
+}
+
+/* picks up the walk an earlier boot did not finish */
+static esp_err_t load_checkpoint() {
+  scanCheckpoint_t c;
+  FILE *f = fopen(SCAN_CHECKPOINT_PATH, "rb");
+  if(f == NULL) return ESP_ERR_NOT_FOUND;
+  esp_err_t ret = ESP_ERR_INVALID_VERSION;
+  if(fread(&c, 1, sizeof(c), f) == sizeof(c) && c.magic == SCAN_CHECKPOINT_MAGIC
+      && c.version == SCAN_CHECKPOINT_VERSION && c.stackBytes > 0) {
+    stack = heap_caps_malloc(c.stackBytes, MALLOC_CAP_SPIRAM);
+    if(stack != NULL && fread(stack, 1, c.stackBytes, f) == c.stackBytes && stack[c.stackBytes - 1] == 0) {
+      stackCap = stackBytes = c.stackBytes;
+      for(uint32_t i = 0; i < stackBytes; ++i) progress.pending += stack[i] == 0;
+      progress.dirs = c.dirs;
+      progress.files = c.files;
+      progress.added = c.added;
+      ret = ESP_OK;
+    } else {
+      free(stack);
+      stack = NULL;
+    }
+  }
+  fclose(f);
+  return ret;
+}
+
+/* brings one directory up to date and queues its subdirectories. if its
+ * mtime and entry names are as recorded none of its files are looked at,
+ * otherwise only files with a new size or mtime are opened. FAT leaves the
+ * directory alone when a file in it is rewritten under the same name, such
+ * a file is noticed once something else in its directory changes. returns
+ * true if the library changed */
+static bool scan_dir(const char *basePath) {
+  DIR *dir_p;
+  struct dirent *dirent_p;
+  struct stat st;
+  char path[SCAN_PATH_LEN];
+  int type = 0;
+  bool slash = basePath[strlen(basePath) - 1] == '/', changed = false;
+  uint32_t names = FNV1A_INIT;
+
+  dir_p = opendir(basePath);
+  if(dir_p == NULL) {
+    ESP_LOGE(TAG, "Failed to opendir: %s", basePath);
+    return false;
+  }
+  while((dirent_p = readdir(dir_p)) != NULL) {
+    uint8_t entryType = dirent_p->d_type;
+    names = fnv1a(names, dirent_p->d_name, strlen(dirent_p->d_name));
+    names = fnv1a(names, &entryType, 1);
+  }
+  uint32_t mtime = stat(basePath, &st) == 0 ? st.st_mtime : 0; //0 for the root
+  bool unchanged = musicdb_dir_unchanged(basePath, mtime, names);
+  rewinddir(dir_p);
+  while((dirent_p = readdir(dir_p)) != NULL) {
+    if(strcmp(dirent_p->d_name, ".") == 0 || strcmp(dirent_p->d_name, "..") == 0)
+      continue;
+    //nothing below a path too long for the library can be added to it
+    if(snprintf(path, sizeof(path), slash ? "%s%s" : "%s/%s", basePath, dirent_p->d_name) >= MUSICDB_FN_LEN)
+      continue;
+
+    switch(dirent_p->d_type) {
+      case DT_REG:
+        type = check_music_file(path);
+        if(type == 0) break;
+        progress.files++;
+        if(unchanged || stat(path, &st) != 0) break;
+        if(musicdb_file_check(path, st.st_size, st.st_mtime) == MUSICDB_NONE) {
+          scan_file(path, type, &st);
+          progress.added++;
+          changed = true;
+        }
+        break;
+      case DT_DIR:
+        push_dir(path);
+        break;
+      default:break;
+    }
+  }
+  closedir(dir_p);
+  if(unchanged == false) {
+    musicdb_dir_done(basePath, mtime, names);
+    changed = true;
+  }
+  return changed;
+}
+
+static void update_percent() {
+  static int postedLen = -1;
+  int last = progress.percent;
+  uint32_t known = progress.dirs + progress.pending, expected = musicdb_dir_count();
+  progress.percent = progress.dirs * 100 / max(max(known, expected), 1);
+  if(progress.percent > 99) progress.percent = 99;
+  if(progress.percent != last || playlist_len != postedLen) {
+    postedLen = playlist_len;
+    ui_post(UI_EVENT_SCAN, progress.percent);
+  }
+}
+
+/* walks the card below SCAN_ROOT without recursion at the lowest priority.
+ * the directories left to walk are saved as it goes, so a walk cut short
+ * by a power loss carries on at the next boot */
+void taskScan(void *parameter) {
+  char path[SCAN_PATH_LEN];
+  int64_t start = esp_timer_get_time(), saved = start;
+  progress.resumed = load_checkpoint() == ESP_OK;
+  if(progress.resumed)
+    ESP_LOGI(TAG, "Resuming scan, %d directories to go", progress.pending);
+  else
+    push_dir(SCAN_ROOT);
+  musicdb_rescan_begin();
+  while(pop_dir(path)) {
+    bool changed = scan_dir(path);
+    progress.dirs++;
+    update_percent();
+    int64_t now = esp_timer_get_time();
+    if(changed || now - saved > SCAN_CHECKPOINT_INTERVAL * 1000) {
+      save_checkpoint();
+      saved = now;
+    }
+  }
+  int pending = musicdb_rescan_end();
+  remove(SCAN_CHECKPOINT_PATH);
+  ESP_LOGI(TAG, "Scan done in %d ms: %d directories, %d files, %d read, %d changes",
+           (int)((esp_timer_get_time() - start) / 1000), progress.dirs, progress.files,
+           progress.added, pending);
+  free(stack);
+  stack = NULL;
+  stackBytes = stackCap = 0;
+  playlist_len = musicdb_count();
+  progress.percent = 100;
+  progress.running = false;
+  ui_post(UI_EVENT_SCAN, progress.percent);
+  scanTask = NULL;
+  vTaskDelete(NULL);
+}
+
+esp_err_t library_scan_start(void) {
+  if(scanTask != NULL) return ESP_ERR_INVALID_STATE;
+  memset(&progress, 0, sizeof(progress));
+  progress.running = true;
+  if(xTaskCreatePinnedToCore(taskScan,"SCAN",6000,NULL,(portPRIVILEGE_BIT | 1),&scanTask,0) != pdPASS) {
+    ESP_LOGE(TAG, "Failed to create scan task.");
+    progress.running = false;
+    scanTask = NULL;
+    return ESP_FAIL;
+  }
+  return ESP_OK;
+}
+
+void library_scan_progress(scanProgress_t *p) {
+  *p = progress;
+}
@@ -0,0 +1,23 @@
+#ifndef _LIBRARY_SCAN_H_
+#define _LIBRARY_SCAN_H_
+
+#define SCAN_ROOT "/sdcard/"
+#define SCAN_CHECKPOINT_PATH "/sdcard/music.scn"
+#define SCAN_CHECKPOINT_VERSION 1
+#define SCAN_CHECKPOINT_INTERVAL 5000 //ms between saves while nothing changes
+#define SCAN_PATH_LEN 256
+
+typedef struct {
+  bool running;
+  bool resumed; //carried on from a checkpoint
+  uint32_t dirs; //walked so far
+  uint32_t pending; //found but not walked yet
+  uint32_t files; //music files seen
+  uint32_t added; //files whose tags were read
+  int percent; //estimate, the total is only known at the end
+} scanProgress_t;
+
+esp_err_t library_scan_start(void);
+void library_scan_progress(scanProgress_t *p);
+void taskScan(void *parameter);
+#endif
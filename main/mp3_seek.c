@@ -0,0 +1,374 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sys/stat.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "mp3common.h"
+
+#include "i2s_dac.h"
+#include "mp3_seek.h"
+#include "fnv1a.h"
+
+#define SEEK_INDEX_MAGIC CCCC('S', 'I', 'D', 'X')
+#define SEEK_RESUME_MAGIC CCCC('R', 'S', 'M', '1')
+
+typedef struct {
+  uint32_t magic;
+  int32_t offset;
+  uint32_t sec;
+  char fileName[MUSICDB_FN_LEN];
+} seekResume_t;
+
+static const char *TAG = "MP3_SEEK";
+
+static uint32_t be32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint16_t be16(const uint8_t *p) {
+  return (p[0] << 8) | p[1];
+}
+
+/* layer 3 only. returns the frame length in bytes, -1 if h is no valid header */
+int mp3_parse_header(const uint8_t *h, int *sampleRate, int *samplesPerFrame) {
+  int ver, verBits = (h[1] >> 3) & 0x03, layerBits = (h[1] >> 1) & 0x03;
+  int brIdx = h[2] >> 4, srIdx = (h[2] >> 2) & 0x03, pad = (h[2] >> 1) & 0x01;
+  if(h[0] != 0xFF || (h[1] & 0xE0) != 0xE0) return -1;
+  if(verBits == 1 || layerBits != 1 || brIdx == 0 || brIdx == 15 || srIdx == 3) return -1;
+  ver = verBits == 3 ? MPEG1 : (verBits == 2 ? MPEG2 : MPEG25);
+  *sampleRate = samplerateTab[ver][srIdx];
+  *samplesPerFrame = samplesPerFrameTab[ver][2];
+  return (ver == MPEG1 ? 144000 : 72000) * bitrateTab[ver][2][brIdx] / *sampleRate + pad;
+}
+
+/* Xing/Info tag, sits right after the side info of the first frame */
+static esp_err_t parse_xing(mp3Seek_t *s, const uint8_t *h, int n) {
+  bool mpeg1 = ((h[1] >> 3) & 0x03) == 3, mono = (h[3] >> 6) == 3;
+  int off = 4 + (mpeg1 ? (mono ? 17 : 32) : (mono ? 9 : 17));
+  if(n < off + 120) return ESP_FAIL;
+  const uint8_t *x = h + off;
+  if(memcmp(x, "Xing", 4) != 0 && memcmp(x, "Info", 4) != 0) return ESP_FAIL;
+  uint32_t flags = be32(x + 4);
+  x += 8;
+  if((flags & 0x01) == 0) return ESP_FAIL; //no frame count, no duration
+  s->hdr.totalFrames = be32(x);
+  x += 4;
+  s->audioBytes = s->hdr.fileSize - s->hdr.audioStart;
+  if(flags & 0x02) {
+    s->audioBytes = be32(x);
+    x += 4;
+  }
+  if(flags & 0x04) {
+    memcpy(s->toc, x, 100);
+    x += 100;
+  } else for(int i = 0; i < 100; ++i) s->toc[i] = i * 256 / 100; //CBR Info tag
+  if(flags & 0x08) x += 4;
+  //LAME extension: 9 byte encoder string, 12 bit delay and padding at +21
+  if(x + 24 <= h + n && (memcmp(x, "LAME", 4) == 0 || memcmp(x, "Lavc", 4) == 0
+      || memcmp(x, "Lavf", 4) == 0)) {
+    s->encoderDelay = (x[21] << 4) | (x[22] >> 4);
+    s->encoderPadding = ((x[22] & 0x0F) << 8) | x[23];
+    s->gapless = true;
+  }
+  s->source = SEEK_XING;
+  return ESP_OK;
+}
+
+/* Fraunhofer VBRI tag, 32 bytes after the frame header. its table holds the
+ * byte size of every framesPerEntry frames, turned into offsets here */
+static esp_err_t parse_vbri(mp3Seek_t *s, const uint8_t *h, int n) {
+  const uint8_t *v = h + 36;
+  if(n < 36 + 26 || memcmp(v, "VBRI", 4) != 0) return ESP_FAIL;
+  uint32_t entries = be16(v + 18), scale = be16(v + 20), size = be16(v + 22), fpe = be16(v + 24);
+  if(size < 1 || size > 4 || fpe == 0 || entries + 1 > SEEK_INDEX_MAX
+      || n < 36 + 26 + entries * size)
+    return ESP_FAIL;
+  s->offsets = heap_caps_malloc((entries + 1) * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+  if(s->offsets == NULL) return ESP_ERR_NO_MEM;
+  s->audioBytes = be32(v + 10);
+  s->hdr.totalFrames = be32(v + 14);
+  s->hdr.framesPerEntry = fpe;
+  s->hdr.entries = entries + 1;
+  s->offsets[0] = s->hdr.audioStart;
+  for(int i = 0; i < entries; ++i) {
+    uint32_t val = 0;
+    for(int b = 0; b < size; ++b) val = (val << 8) | v[26 + i * size + b];
+    s->offsets[i + 1] = s->offsets[i] + val * scale;
+  }
+  s->source = SEEK_VBRI;
+  return ESP_OK;
+}
+
+static void cache_path(mp3Seek_t *s) {
+  uint32_t hash = fnv1a(FNV1A_INIT, s->fileName, strlen(s->fileName));
+  sprintf(s->cachePath, SEEK_CACHE_DIR "/%08x.idx", hash);
+}
+
+static esp_err_t load_cache(mp3Seek_t *s) {
+  seekIndexHeader_t hdr;
+  FILE *f = fopen(s->cachePath, "rb");
+  if(f == NULL) return ESP_ERR_NOT_FOUND;
+  if(fread(&hdr, 1, sizeof(hdr), f) != sizeof(hdr) || hdr.magic != SEEK_INDEX_MAGIC
+      || hdr.version != SEEK_INDEX_VERSION || hdr.fileSize != s->hdr.fileSize
+      || hdr.audioStart != s->hdr.audioStart || hdr.entries == 0 || hdr.entries > SEEK_INDEX_MAX) {
+    fclose(f);
+    return ESP_ERR_INVALID_VERSION;
+  }
+  s->offsets = heap_caps_malloc(hdr.entries * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+  if(s->offsets == NULL || fread(s->offsets, sizeof(uint32_t), hdr.entries, f) != hdr.entries) {
+    free(s->offsets);
+    s->offsets = NULL;
+    fclose(f);
+    return ESP_FAIL;
+  }
+  fclose(f);
+  s->hdr = hdr;
+  s->source = SEEK_TABLE;
+  return ESP_OK;
+}
+
+static void save_cache(mp3Seek_t *s) {
+  mkdir(SEEK_CACHE_DIR, 0755);
+  FILE *f = fopen(s->cachePath, "wb");
+  if(f == NULL) {
+    ESP_LOGE(TAG, "Failed to write %s", s->cachePath);
+    return;
+  }
+  fwrite(&s->hdr, 1, sizeof(s->hdr), f);
+  fwrite(s->offsets, sizeof(uint32_t), s->hdr.entries, f);
+  fclose(f);
+}
+
+/* low priority pass over the whole file recording every framesPerEntry-th
+ * frame offset, for files without a Xing/VBRI table */
+static void taskSeekIndex(void *parameter) {
+  mp3Seek_t *s = parameter;
+  FILE *f = fopen(s->fileName, "rb");
+  uint8_t *buf = malloc(SEEK_SCAN_BUF);
+  uint32_t *offsets = heap_caps_malloc(SEEK_INDEX_MAX * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+  size_t pos = s->hdr.audioStart, bufPos = 0, bufLen = 0;
+  uint32_t frames = 0, entries = 0, fpe = SEEK_INDEX_FRAMES;
+  uint8_t first[3];
+  int rate, spf;
+  if(f == NULL || buf == NULL || offsets == NULL) goto out;
+  setvbuf(f, NULL, _IONBF, 0);
+  while(s->stop == false) {
+    if(pos + 4 > bufPos + bufLen) {
+      fseek(f, pos, SEEK_SET);
+      bufLen = fread(buf, 1, SEEK_SCAN_BUF, f);
+      bufPos = pos;
+      if(bufLen < 4) break;
+      vTaskDelay(1);
+    }
+    uint8_t *h = buf + (pos - bufPos);
+    int len = mp3_parse_header(h, &rate, &spf);
+    if(len > 0 && frames > 0 && (h[1] != first[1] || (h[2] & 0x0C) != (first[2] & 0x0C)))
+      len = -1; //version, layer and sample rate never change inside a stream
+    if(len <= 0) {
+      int off = MP3FindSyncWord(h + 1, bufLen - (pos - bufPos) - 1);
+      pos = off < 0 ? bufPos + bufLen - 1 : pos + off + 1;
+      continue;
+    }
+    if(frames == 0) memcpy(first, h, 3);
+    if(frames % fpe == 0) {
+      if(entries == SEEK_INDEX_MAX) {
+        for(int i = 0; i < SEEK_INDEX_MAX / 2; ++i) offsets[i] = offsets[i * 2];
+        entries = SEEK_INDEX_MAX / 2;
+        fpe *= 2;
+      }
+      if(frames % fpe == 0) offsets[entries++] = pos;
+    }
+    frames++;
+    pos += len;
+  }
+  if(s->stop == false && entries > 0) {
+    s->offsets = offsets;
+    offsets = NULL;
+    s->hdr.totalFrames = frames;
+    s->hdr.framesPerEntry = fpe;
+    s->hdr.entries = entries;
+    s->source = SEEK_TABLE;
+    save_cache(s);
+    __sync_synchronize();
+    s->ready = true;
+    ESP_LOGI(TAG, "Indexed %d frames in %d entries", frames, entries);
+  }
+out:
+  if(f != NULL) fclose(f);
+  free(buf);
+  free(offsets);
+  s->indexing = false;
+  xSemaphoreGive(s->done);
+  vTaskDelete(NULL);
+}
+
+/* reads the head of the file into s, len of the first frame at *pos or -1 */
+static int find_first_frame(mp3Seek_t *s, FILE *file, size_t audioStart, uint8_t *head, int *pos) {
+  int rate, spf, len = -1, n;
+  *pos = 0;
+  fseek(file, 0, SEEK_END);
+  s->hdr.fileSize = ftell(file);
+  fseek(file, audioStart, SEEK_SET);
+  n = fread(head, 1, SEEK_HEAD_BYTES, file);
+  while(*pos + 4 <= n) {
+    int off = MP3FindSyncWord(head + *pos, n - *pos);
+    if(off < 0 || *pos + off + 4 > n) break;
+    *pos += off;
+    len = mp3_parse_header(head + *pos, &rate, &spf);
+    //a sync word inside leftover tag data is rarely followed by another frame
+    if(len > 0 && (*pos + len + 4 > n || mp3_parse_header(head + *pos + len, &rate, &spf) > 0)) break;
+    len = -1;
+    (*pos)++;
+  }
+  if(len < 0) return -1;
+  mp3_parse_header(head + *pos, &rate, &spf);
+  s->hdr.magic = SEEK_INDEX_MAGIC;
+  s->hdr.version = SEEK_INDEX_VERSION;
+  s->hdr.audioStart = audioStart + *pos;
+  s->hdr.sampleRate = rate;
+  s->hdr.samplesPerFrame = spf;
+  return n;
+}
+
+/* audioStart only needs to be close, the first frame is searched from there */
+esp_err_t mp3_seek_open(mp3Seek_t *s, FILE *file, const char *fileName, size_t audioStart) {
+  int pos, n;
+  memset(s, 0, sizeof(mp3Seek_t));
+  strncpy(s->fileName, fileName, sizeof(s->fileName) - 1);
+  uint8_t *head = malloc(SEEK_HEAD_BYTES);
+  if(head == NULL) return ESP_ERR_NO_MEM;
+  n = find_first_frame(s, file, audioStart, head, &pos);
+  if(n < 0) {
+    free(head);
+    return ESP_FAIL;
+  }
+  if(parse_xing(s, head + pos, n - pos) == ESP_OK || parse_vbri(s, head + pos, n - pos) == ESP_OK) {
+    free(head);
+    s->ready = true;
+    return ESP_OK;
+  }
+  free(head);
+  cache_path(s);
+  if(load_cache(s) == ESP_OK) {
+    s->ready = true;
+    return ESP_OK;
+  }
+  s->done = xSemaphoreCreateBinary();
+  if(s->done == NULL) return ESP_ERR_NO_MEM;
+  s->indexing = true;
+  if(xTaskCreatePinnedToCore(taskSeekIndex,"SEEK_IDX",3000,s,(portPRIVILEGE_BIT | 1),&s->task,0) != pdPASS) {
+    s->indexing = false;
+    vSemaphoreDelete(s->done);
+    s->done = NULL;
+    return ESP_FAIL;
+  }
+  return ESP_OK;
+}
+
+/* duration in seconds for the library, without building a seek table.
+ * Xing/VBRI and an existing cache are exact, anything else is taken to be
+ * constant bitrate and estimated from the first frame */
+uint32_t mp3_probe_duration(FILE *file, const char *fileName, size_t audioStart) {
+  int pos, n, rate, spf, len;
+  uint32_t sec = 0;
+  mp3Seek_t *s = calloc(1, sizeof(mp3Seek_t));
+  uint8_t *head = malloc(SEEK_HEAD_BYTES);
+  if(s == NULL || head == NULL) goto out;
+  strncpy(s->fileName, fileName, sizeof(s->fileName) - 1);
+  n = find_first_frame(s, file, audioStart, head, &pos);
+  if(n < 0) goto out;
+  cache_path(s);
+  if(parse_xing(s, head + pos, n - pos) == ESP_OK || parse_vbri(s, head + pos, n - pos) == ESP_OK
+      || load_cache(s) == ESP_OK) {
+    s->ready = true;
+    sec = mp3_seek_duration(s);
+  } else if((len = mp3_parse_header(head + pos, &rate, &spf)) > 0) {
+    sec = (uint64_t)(s->hdr.fileSize - s->hdr.audioStart) / len * spf / rate;
+  }
+  free(s->offsets);
+out:
+  free(head);
+  free(s);
+  return sec;
+}
+
+/* in seconds, 0 while unknown */
+uint32_t mp3_seek_duration(mp3Seek_t *s) {
+  if(s->ready == false || s->hdr.sampleRate == 0) return 0;
+  return (uint64_t)s->hdr.totalFrames * s->hdr.samplesPerFrame / s->hdr.sampleRate;
+}
+
+/* offset of the frame to resume decoding from. with a table, skip frames
+ * have to be decoded and dropped to land exactly on frame.
+ * ESP_ERR_INVALID_STATE while the table is still being built, worth asking
+ * again; ESP_ERR_NOT_FOUND without any index, ESP_ERR_INVALID_ARG past the end */
+esp_err_t mp3_seek_lookup(mp3Seek_t *s, uint32_t sec, size_t *offset, uint32_t *frame, uint32_t *skip) {
+  seekIndexHeader_t *hdr = &s->hdr;
+  if(s->ready == false) return s->indexing ? ESP_ERR_INVALID_STATE : ESP_ERR_NOT_FOUND;
+  if(hdr->totalFrames == 0) return ESP_ERR_NOT_FOUND;
+  uint32_t f = (uint64_t)sec * hdr->sampleRate / hdr->samplesPerFrame;
+  if(f >= hdr->totalFrames) return ESP_ERR_INVALID_ARG;
+  *frame = f;
+  *skip = 0;
+  if(s->source == SEEK_XING) {
+    uint32_t p = (uint64_t)f * 100000 / hdr->totalFrames, i = p / 1000;
+    uint32_t a = s->toc[i], b = i < 99 ? s->toc[i + 1] : 256;
+    *offset = hdr->audioStart + (uint64_t)(a * 1000 + (b - a) * (p % 1000)) * s->audioBytes / 256000;
+    return ESP_OK;
+  }
+  uint32_t e = f / hdr->framesPerEntry;
+  if(e >= hdr->entries) e = hdr->entries - 1;
+  *skip = f - e * hdr->framesPerEntry;
+  //the bit reservoir needs a frame or two of history before output is valid
+  if(*skip < 2 && e > 0) {
+    e--;
+    *skip += hdr->framesPerEntry;
+  }
+  *offset = s->offsets[e];
+  return ESP_OK;
+}
+
+void mp3_seek_close(mp3Seek_t *s) {
+  if(s->done != NULL) {
+    s->stop = true;
+    xSemaphoreTake(s->done, portMAX_DELAY);
+    vSemaphoreDelete(s->done);
+    s->done = NULL;
+  }
+  free(s->offsets);
+  s->offsets = NULL;
+  s->ready = false;
+}
+
+esp_err_t mp3_resume_save(int offset, const char *fileName, uint32_t sec) {
+  seekResume_t r;
+  memset(&r, 0, sizeof(r));
+  r.magic = SEEK_RESUME_MAGIC;
+  r.offset = offset;
+  r.sec = sec;
+  strncpy(r.fileName, fileName, sizeof(r.fileName) - 1);
+  mkdir(SEEK_CACHE_DIR, 0755);
+  FILE *f = fopen(SEEK_RESUME_FILE, "wb");
+  if(f == NULL) return ESP_FAIL;
+  fwrite(&r, 1, sizeof(r), f);
+  fclose(f);
+  return ESP_OK;
+}
+
+esp_err_t mp3_resume_load(int *offset, char *fileName, uint32_t *sec) {
+  seekResume_t r;
+  FILE *f = fopen(SEEK_RESUME_FILE, "rb");
+  if(f == NULL) return ESP_ERR_NOT_FOUND;
+  size_t n = fread(&r, 1, sizeof(r), f);
+  fclose(f);
+  if(n != sizeof(r) || r.magic != SEEK_RESUME_MAGIC) return ESP_FAIL;
+  r.fileName[sizeof(r.fileName) - 1] = 0;
+  *offset = r.offset;
+  *sec = r.sec;
+  strcpy(fileName, r.fileName);
+  return ESP_OK;
+}
@@ -0,0 +1,56 @@
+#ifndef _MP3_SEEK_H_
+#define _MP3_SEEK_H_
+
+#define SEEK_CACHE_DIR "/sdcard/.seekidx"
+#define SEEK_RESUME_FILE SEEK_CACHE_DIR "/resume"
+#define SEEK_INDEX_VERSION 1
+#define SEEK_INDEX_FRAMES 32 //frames per table entry, doubled when the table fills up
+#define SEEK_INDEX_MAX 8192
+#define SEEK_HEAD_BYTES 4096 //searched for the first frame and its Xing/VBRI tag
+#define SEEK_SCAN_BUF (16 * 1024)
+#define SEEK_RESUME_INTERVAL 15 //seconds between resume point saves
+#define MP3_DECODER_DELAY 529 //samples of synthesis filter delay, part of every LAME gapless figure
+
+typedef enum {
+  SEEK_NONE = 0, SEEK_XING, SEEK_VBRI, SEEK_TABLE
+} seekSource_t;
+
+/* also the header of the per track cache file */
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t fileSize;
+  uint32_t audioStart; //offset of the first frame
+  uint32_t totalFrames;
+  uint32_t sampleRate;
+  uint16_t samplesPerFrame;
+  uint16_t framesPerEntry;
+  uint32_t entries;
+} seekIndexHeader_t;
+
+typedef struct {
+  seekSource_t source;
+  seekIndexHeader_t hdr;
+  uint32_t *offsets; //byte offset of frame i * framesPerEntry (VBRI and table)
+  uint8_t toc[100]; //Xing: percent of time -> 1/256 of audioBytes
+  uint32_t audioBytes;
+  bool gapless; //LAME tag found, encoderDelay/encoderPadding are valid
+  uint16_t encoderDelay, encoderPadding;
+  char fileName[128];
+  char cachePath[40];
+  TaskHandle_t task;
+  SemaphoreHandle_t done;
+  volatile bool ready, stop;
+  volatile bool indexing; //SEEK_IDX is still walking the file
+} mp3Seek_t;
+
+int mp3_parse_header(const uint8_t *h, int *sampleRate, int *samplesPerFrame);
+esp_err_t mp3_seek_open(mp3Seek_t *s, FILE *file, const char *fileName, size_t audioStart);
+uint32_t mp3_seek_duration(mp3Seek_t *s);
+uint32_t mp3_probe_duration(FILE *file, const char *fileName, size_t audioStart);
+esp_err_t mp3_seek_lookup(mp3Seek_t *s, uint32_t sec, size_t *offset, uint32_t *frame, uint32_t *skip);
+void mp3_seek_close(mp3Seek_t *s);
+
+esp_err_t mp3_resume_save(int offset, const char *fileName, uint32_t sec);
+esp_err_t mp3_resume_load(int *offset, char *fileName, uint32_t *sec);
+#endif
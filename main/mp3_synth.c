@@ -0,0 +1,96 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+#include "i2s_dac.h"
+#include "pcm_buffer.h"
+#include "mp3_synth.h"
+
+static const char *TAG = "MP3_SYNTH";
+
+/* runs on core 0 next to the UI, the Player task keeps core 1 for the
+ * front half of the decoder */
+static void taskSynth(void *parameter) {
+  mp3Synth_t *s = parameter;
+  synthJob_t *job;
+  while(s->stop == false) {
+    if(xQueueReceive(s->fullQ, &job, 20 / portTICK_RATE_MS) != pdPASS) continue;
+    if(MP3DecodeSynthesis(s->decoder, &job->frame, s->pcm) == ERR_MP3_NONE && job->to > job->from) {
+      short *pcm = s->pcm + job->from * job->nChans;
+      pcm_buffer_write(pcm, (job->to - job->from) * job->nChans * 2);
+    }
+    xQueueSend(s->freeQ, &job, 0);
+  }
+  xSemaphoreGive(s->done);
+  vTaskDelete(NULL);
+}
+
+static void synth_free(mp3Synth_t *s) {
+  free(s->jobs);
+  if(s->freeQ != NULL) vQueueDelete(s->freeQ);
+  if(s->fullQ != NULL) vQueueDelete(s->fullQ);
+  if(s->done != NULL) vSemaphoreDelete(s->done);
+  memset(s, 0, sizeof(mp3Synth_t));
+}
+
+/* pcm holds one decoded frame and belongs to the synthesis task until
+ * synth_stop() */
+esp_err_t synth_start(mp3Synth_t *s, HMP3Decoder decoder, short *pcm) {
+  memset(s, 0, sizeof(mp3Synth_t));
+  s->decoder = decoder;
+  s->pcm = pcm;
+  s->jobs = malloc(SYNTH_JOBS * sizeof(synthJob_t));
+  s->freeQ = xQueueCreate(SYNTH_JOBS, sizeof(synthJob_t *));
+  s->fullQ = xQueueCreate(SYNTH_JOBS, sizeof(synthJob_t *));
+  s->done = xSemaphoreCreateBinary();
+  if(s->jobs == NULL || s->freeQ == NULL || s->fullQ == NULL || s->done == NULL)
+    goto fail;
+  for(int i = 0; i < SYNTH_JOBS; ++i) {
+    synthJob_t *job = &s->jobs[i];
+    xQueueSend(s->freeQ, &job, 0);
+  }
+  if(xTaskCreatePinnedToCore(taskSynth,"SYNTH",3000,s,(portPRIVILEGE_BIT | 4),NULL,0) != pdPASS)
+    goto fail;
+  return ESP_OK;
+fail:
+  ESP_LOGE(TAG, "Failed to start synthesis task");
+  synth_free(s);
+  return ESP_FAIL;
+}
+
+/* blocks until a job is free */
+synthJob_t *synth_job(mp3Synth_t *s) {
+  synthJob_t *job;
+  xQueueReceive(s->freeQ, &job, portMAX_DELAY);
+  return job;
+}
+
+void synth_submit(mp3Synth_t *s, synthJob_t *job) {
+  xQueueSend(s->fullQ, &job, portMAX_DELAY);
+}
+
+/* a job taken but not submitted */
+void synth_cancel(mp3Synth_t *s, synthJob_t *job) {
+  xQueueSend(s->freeQ, &job, 0);
+}
+
+/* returns once every submitted job has been written, e.g. before a flush or
+ * an i2s clock change */
+void synth_wait(mp3Synth_t *s) {
+  synthJob_t *jobs[SYNTH_JOBS];
+  for(int i = 0; i < SYNTH_JOBS; ++i) xQueueReceive(s->freeQ, &jobs[i], portMAX_DELAY);
+  for(int i = 0; i < SYNTH_JOBS; ++i) xQueueSend(s->freeQ, &jobs[i], 0);
+}
+
+void synth_stop(mp3Synth_t *s) {
+  if(s->jobs == NULL) return;
+  synth_wait(s);
+  s->stop = true;
+  xSemaphoreTake(s->done, portMAX_DELAY);
+  synth_free(s);
+}
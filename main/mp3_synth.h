@@ -0,0 +1,31 @@
+#ifndef _MP3_SYNTH_H_
+#define _MP3_SYNTH_H_
+
+#include "mp3dec.h"
+
+#define SYNTH_JOBS 2 //frame N in synthesis while frame N+1 is decoded
+
+/* one frame between the Player task (Huffman to IMDCT) and the synthesis
+ * task (polyphase, gain and pcm output) */
+typedef struct {
+  MP3SynthJob frame;
+  int from, to; //samples per channel written out, the rest is trimmed
+  int nChans;
+} synthJob_t;
+
+typedef struct {
+  HMP3Decoder decoder;
+  synthJob_t *jobs;
+  short *pcm;
+  QueueHandle_t freeQ, fullQ;
+  SemaphoreHandle_t done;
+  volatile bool stop;
+} mp3Synth_t;
+
+esp_err_t synth_start(mp3Synth_t *s, HMP3Decoder decoder, short *pcm);
+synthJob_t *synth_job(mp3Synth_t *s);
+void synth_submit(mp3Synth_t *s, synthJob_t *job);
+void synth_cancel(mp3Synth_t *s, synthJob_t *job);
+void synth_wait(mp3Synth_t *s);
+void synth_stop(mp3Synth_t *s);
+#endif
@@ -0,0 +1,884 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <dirent.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "i2s_dac.h"
+#include "music_db.h"
+#include "fnv1a.h"
+
+#ifndef min
+  #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#define MUSICDB_MAGIC CCCC('M', 'L', 'D', 'B')
+#define JOURNAL_MAGIC CCCC('M', 'L', 'D', 'J')
+#define COMPACT_BATCH 64 //records copied per hold of dbLock
+
+/* the file stays open and is read through a small cache of whole pages,
+ * so list pages and binary searches cost no sd access once they are warm */
+typedef struct {
+  uint32_t page; //MUSICDB_NONE = empty
+  uint32_t used; //lru stamp
+  uint8_t data[MUSICDB_PAGE_BYTES];
+} dbPage_t;
+
+/* records and directories with their own string pool. holds what the
+ * journal added since the last compaction, and the next file while it is
+ * being compacted */
+typedef struct {
+  musicdbRecord_t *records;
+  uint32_t *hashes; //of each record's path, for lookups without strcmp
+  uint32_t count, cap;
+  musicdbDir_t *dirs;
+  uint32_t dirCount, dirCap;
+  char *pool;
+  uint32_t poolBytes, poolCap;
+} recordSet_t;
+
+/* the journal is a journalHeader_t, then entries of a journalEntry_t and
+ * bytes of payload each. JOURNAL_ADD carries a musicdbRecord_t and its path,
+ * title, artist and album, JOURNAL_DIR a musicdbDir_t and its path,
+ * JOURNAL_DELETE only the id in arg */
+typedef enum {
+  JOURNAL_ADD = 1, JOURNAL_DELETE, JOURNAL_DIR
+} journalOp_t;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t stamp; //of the database file it applies to
+} journalHeader_t;
+
+typedef struct {
+  uint32_t op;
+  uint32_t arg;
+  uint32_t bytes;
+} journalEntry_t;
+
+static const char *TAG = "MUSIC_DB";
+
+static SemaphoreHandle_t dbLock = NULL;
+static FILE *dbFile = NULL;
+static musicdbHeader_t hdr;
+static uint32_t useStamp;
+static dbPage_t cache[MUSICDB_CACHE_PAGES];
+
+static recordSet_t jnl; //ids hdr.count and up
+static FILE *jnlFile = NULL;
+static uint8_t *deleted; //bitmap over all ids
+static uint32_t deletedBits;
+static uint32_t changes; //journal entries not compacted yet
+static uint32_t generation;
+static TaskHandle_t compactTask = NULL;
+static bool rescanning; //ids must not change under a rescan
+
+//rescan bookkeeping, bitmaps over the ids and the base then journal dirs
+static uint8_t *seen, *dirSeen;
+static uint32_t seenBits, dirSeenBits;
+
+//qsort() has no context argument, commits run one at a time
+static const recordSet_t *sortSet;
+static musicdbOrder_t sortOrder;
+
+static uint32_t hash_path(const char *s) {
+  return fnv1a(FNV1A_INIT, s, strlen(s));
+}
+
+static bool bit_get(const uint8_t *map, uint32_t bits, uint32_t i) {
+  return i < bits && (map[i >> 3] & (1 << (i & 7)));
+}
+
+/* grows the map in PSRAM as needed, false if that fails */
+static bool bit_set(uint8_t **map, uint32_t *bits, uint32_t i) {
+  if(i >= *bits) {
+    uint32_t n = (i + 1024) & ~1023;
+    uint8_t *m = heap_caps_realloc(*map, n / 8, MALLOC_CAP_SPIRAM);
+    if(m == NULL) return false;
+    memset(m + *bits / 8, 0, (n - *bits) / 8);
+    *map = m;
+    *bits = n;
+  }
+  (*map)[i >> 3] |= 1 << (i & 7);
+  return true;
+}
+
+/* ---- record sets ---- */
+
+static esp_err_t set_init(recordSet_t *set) {
+  memset(set, 0, sizeof(recordSet_t));
+  set->poolCap = 16 * 1024;
+  set->pool = heap_caps_malloc(set->poolCap, MALLOC_CAP_SPIRAM);
+  if(set->pool == NULL) return ESP_ERR_NO_MEM;
+  set->pool[0] = 0; //offset 0 is the empty string
+  set->poolBytes = 1;
+  return ESP_OK;
+}
+
+static void set_free(recordSet_t *set) {
+  free(set->records);
+  free(set->hashes);
+  free(set->dirs);
+  free(set->pool);
+  memset(set, 0, sizeof(recordSet_t));
+}
+
+static uint32_t set_string(recordSet_t *set, const char *s) {
+  if(s == NULL || s[0] == 0) return 0;
+  uint32_t len = strlen(s) + 1;
+  if(set->poolBytes + len > set->poolCap) {
+    uint32_t cap = set->poolCap * 2 + len;
+    char *pool = heap_caps_realloc(set->pool, cap, MALLOC_CAP_SPIRAM);
+    if(pool == NULL) return MUSICDB_NONE;
+    set->pool = pool;
+    set->poolCap = cap;
+  }
+  memcpy(set->pool + set->poolBytes, s, len);
+  set->poolBytes += len;
+  return set->poolBytes - len;
+}
+
+/* tracks of an album are scanned one after the other, so artist and album
+ * are shared with the previous record when they are the same */
+static uint32_t set_shared(recordSet_t *set, const char *s, uint32_t prev) {
+  if(prev != 0 && s != NULL && strcmp(set->pool + prev, s) == 0) return prev;
+  return set_string(set, s);
+}
+
+static esp_err_t set_add(recordSet_t *set, const musicdbRecord_t *rec, const char *path,
+                         const char *title, const char *artist, const char *album) {
+  if(set->count == set->cap) {
+    uint32_t cap = set->cap ? set->cap * 2 : 256;
+    musicdbRecord_t *r = heap_caps_realloc(set->records, cap * sizeof(musicdbRecord_t), MALLOC_CAP_SPIRAM);
+    if(r == NULL) return ESP_ERR_NO_MEM;
+    set->records = r;
+    uint32_t *h = heap_caps_realloc(set->hashes, cap * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+    if(h == NULL) return ESP_ERR_NO_MEM;
+    set->hashes = h;
+    set->cap = cap;
+  }
+  musicdbRecord_t *prev = set->count ? &set->records[set->count - 1] : NULL, r = *rec;
+  r.path = set_string(set, path);
+  r.title = set_string(set, title);
+  r.artist = set_shared(set, artist, prev ? prev->artist : 0);
+  r.album = set_shared(set, album, prev ? prev->album : 0);
+  if(r.path == MUSICDB_NONE || r.title == MUSICDB_NONE || r.artist == MUSICDB_NONE
+      || r.album == MUSICDB_NONE)
+    return ESP_ERR_NO_MEM;
+  r.flags = 0;
+  set->hashes[set->count] = hash_path(path);
+  set->records[set->count++] = r;
+  return ESP_OK;
+}
+
+static esp_err_t set_add_dir(recordSet_t *set, const musicdbDir_t *dir, const char *path) {
+  if(set->dirCount == set->dirCap) {
+    uint32_t cap = set->dirCap ? set->dirCap * 2 : 64;
+    musicdbDir_t *d = heap_caps_realloc(set->dirs, cap * sizeof(musicdbDir_t), MALLOC_CAP_SPIRAM);
+    if(d == NULL) return ESP_ERR_NO_MEM;
+    set->dirs = d;
+    set->dirCap = cap;
+  }
+  musicdbDir_t d = *dir;
+  d.path = set_string(set, path);
+  if(d.path == MUSICDB_NONE) return ESP_ERR_NO_MEM;
+  set->dirs[set->dirCount++] = d;
+  return ESP_OK;
+}
+
+static int compare_field(musicdbOrder_t order, const char *a, const char *b) {
+  return order == MUSICDB_BY_PATH ? strcmp(a, b) : strcasecmp(a, b);
+}
+
+static uint32_t record_field(const musicdbRecord_t *r, musicdbOrder_t order) {
+  switch(order) {
+    case MUSICDB_BY_ARTIST: return r->artist;
+    case MUSICDB_BY_ALBUM: return r->album;
+    case MUSICDB_BY_PATH: return r->path;
+    case MUSICDB_BY_TITLE:
+    default: return r->title;
+  }
+}
+
+/* artists sort by album next, ties keep scan order which is track order */
+static int compare_ids(const void *pa, const void *pb) {
+  static const musicdbOrder_t keys[MUSICDB_INDEXES][2] = {
+    {MUSICDB_BY_TITLE, MUSICDB_BY_TITLE},
+    {MUSICDB_BY_ARTIST, MUSICDB_BY_ALBUM},
+    {MUSICDB_BY_ALBUM, MUSICDB_BY_ALBUM},
+    {MUSICDB_BY_PATH, MUSICDB_BY_PATH}
+  };
+  uint32_t a = *(const uint32_t *)pa, b = *(const uint32_t *)pb;
+  const musicdbRecord_t *ra = &sortSet->records[a], *rb = &sortSet->records[b];
+  for(int k = 0; k < 2; ++k) {
+    musicdbOrder_t key = keys[sortOrder][k];
+    int c = compare_field(key, sortSet->pool + record_field(ra, key), sortSet->pool + record_field(rb, key));
+    if(c != 0) return c;
+  }
+  return a < b ? -1 : (a > b);
+}
+
+static int compare_dirs(const void *pa, const void *pb) {
+  const musicdbDir_t *a = pa, *b = pb;
+  return strcmp(sortSet->pool + a->path, sortSet->pool + b->path);
+}
+
+/* writes set as a database file at path with its sorted tables */
+static esp_err_t set_write(recordSet_t *set, uint32_t stamp, const char *path) {
+  musicdbHeader_t h;
+  uint32_t *ids = heap_caps_malloc((set->count + 1) * sizeof(uint32_t), MALLOC_CAP_SPIRAM);
+  FILE *f = fopen(path, "wb");
+  if(ids == NULL || f == NULL) {
+    ESP_LOGE(TAG, "Failed to write %s", path);
+    if(f != NULL) fclose(f);
+    free(ids);
+    return ESP_FAIL;
+  }
+  memset(&h, 0, sizeof(h));
+  h.magic = MUSICDB_MAGIC;
+  h.version = MUSICDB_VERSION;
+  h.stamp = stamp;
+  h.count = set->count;
+  h.recordBytes = sizeof(musicdbRecord_t);
+  h.recordOffset = sizeof(h);
+  h.stringOffset = h.recordOffset + set->count * sizeof(musicdbRecord_t);
+  h.stringBytes = set->poolBytes;
+  uint32_t pad = (4 - h.stringBytes % 4) % 4;
+  h.dirOffset = h.stringOffset + h.stringBytes + pad;
+  h.dirCount = set->dirCount;
+  for(int i = 0; i < MUSICDB_INDEXES; ++i)
+    h.indexOffset[i] = h.dirOffset + set->dirCount * sizeof(musicdbDir_t) + i * set->count * sizeof(uint32_t);
+  sortSet = set;
+  qsort(set->dirs, set->dirCount, sizeof(musicdbDir_t), compare_dirs);
+  fwrite(&h, 1, sizeof(h), f);
+  fwrite(set->records, sizeof(musicdbRecord_t), set->count, f);
+  fwrite(set->pool, 1, set->poolBytes, f);
+  fwrite("\0\0\0", 1, pad, f);
+  fwrite(set->dirs, sizeof(musicdbDir_t), set->dirCount, f);
+  for(int i = 0; i < MUSICDB_INDEXES; ++i) {
+    for(uint32_t id = 0; id < set->count; ++id) ids[id] = id;
+    sortOrder = i;
+    qsort(ids, set->count, sizeof(uint32_t), compare_ids);
+    fwrite(ids, sizeof(uint32_t), set->count, f);
+  }
+  free(ids);
+  bool failed = ferror(f) != 0;
+  if(fclose(f) != 0 || failed) {
+    ESP_LOGE(TAG, "Failed to write %s", path);
+    remove(path);
+    return ESP_FAIL;
+  }
+  return ESP_OK;
+}
+
+/* ---- reading, all with dbLock held ---- */
+
+static const uint8_t *get_page(uint32_t page) {
+  dbPage_t *victim = &cache[0];
+  for(int i = 0; i < MUSICDB_CACHE_PAGES; ++i) {
+    if(cache[i].page == page) {
+      cache[i].used = ++useStamp;
+      return cache[i].data;
+    }
+    if(cache[i].used < victim->used) victim = &cache[i];
+  }
+  fseek(dbFile, page * MUSICDB_PAGE_BYTES, SEEK_SET);
+  size_t n = fread(victim->data, 1, MUSICDB_PAGE_BYTES, dbFile);
+  memset(victim->data + n, 0, MUSICDB_PAGE_BYTES - n);
+  victim->page = page;
+  victim->used = ++useStamp;
+  return victim->data;
+}
+
+static void read_bytes(uint32_t offset, void *buf, size_t len) {
+  uint8_t *out = buf;
+  while(len > 0) {
+    uint32_t at = offset % MUSICDB_PAGE_BYTES;
+    size_t n = min(len, MUSICDB_PAGE_BYTES - at);
+    memcpy(out, get_page(offset / MUSICDB_PAGE_BYTES) + at, n);
+    out += n;
+    offset += n;
+    len -= n;
+  }
+}
+
+static void read_string(uint32_t offset, char *buf, size_t len) {
+  size_t i = 0;
+  if(offset & MUSICDB_JOURNALED) {
+    offset &= ~MUSICDB_JOURNALED;
+    if(offset < jnl.poolBytes) strncpy(buf, jnl.pool + offset, len - 1);
+    buf[len - 1] = 0;
+    return;
+  }
+  if(offset < hdr.stringBytes) {
+    offset += hdr.stringOffset;
+    uint32_t end = hdr.stringOffset + hdr.stringBytes;
+    while(i + 1 < len && offset < end) {
+      const uint8_t *p = get_page(offset / MUSICDB_PAGE_BYTES);
+      uint32_t at = offset % MUSICDB_PAGE_BYTES;
+      size_t n = min(min(len - 1 - i, MUSICDB_PAGE_BYTES - at), end - offset);
+      const uint8_t *nul = memchr(p + at, 0, n);
+      if(nul != NULL) n = nul - (p + at);
+      memcpy(buf + i, p + at, n);
+      i += n;
+      offset += n;
+      if(nul != NULL) break;
+    }
+  }
+  buf[i] = 0;
+}
+
+/* journaled records come back with their strings marked MUSICDB_JOURNALED */
+static bool record_at(uint32_t id, musicdbRecord_t *r) {
+  if(id < hdr.count) {
+    read_bytes(hdr.recordOffset + id * sizeof(musicdbRecord_t), r, sizeof(musicdbRecord_t));
+  } else if(id - hdr.count < jnl.count) {
+    *r = jnl.records[id - hdr.count];
+    r->path |= MUSICDB_JOURNALED;
+    r->title |= MUSICDB_JOURNALED;
+    r->artist |= MUSICDB_JOURNALED;
+    r->album |= MUSICDB_JOURNALED;
+  } else {
+    return false;
+  }
+  r->flags = bit_get(deleted, deletedBits, id) ? MUSICDB_DELETED : 0;
+  return true;
+}
+
+static void dir_at(uint32_t i, musicdbDir_t *d) {
+  if(i < hdr.dirCount) {
+    read_bytes(hdr.dirOffset + i * sizeof(musicdbDir_t), d, sizeof(musicdbDir_t));
+  } else {
+    *d = jnl.dirs[i - hdr.dirCount];
+    d->path |= MUSICDB_JOURNALED;
+  }
+}
+
+/* journaled records follow the sorted ones in scan order until the next
+ * compaction sorts them in */
+static uint32_t id_at(musicdbOrder_t order, uint32_t pos) {
+  uint32_t id;
+  if(pos >= hdr.count) return pos - hdr.count < jnl.count ? pos : MUSICDB_NONE;
+  if(order == MUSICDB_BY_ID) return pos;
+  read_bytes(hdr.indexOffset[order] + pos * sizeof(uint32_t), &id, sizeof(id));
+  return id < hdr.count ? id : MUSICDB_NONE;
+}
+
+/* first position in the sorted table whose field is not below key */
+static uint32_t lower_bound(musicdbOrder_t order, const char *key) {
+  char field[MUSICDB_FN_LEN];
+  musicdbRecord_t r;
+  uint32_t lo = 0, hi = hdr.count;
+  while(lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2, id = id_at(order, mid);
+    if(id == MUSICDB_NONE) break;
+    record_at(id, &r);
+    read_string(record_field(&r, order), field, sizeof(field));
+    if(compare_field(order, field, key) < 0) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+static uint32_t find_path(const char *path) {
+  char field[MUSICDB_FN_LEN];
+  musicdbRecord_t r;
+  uint32_t hash = hash_path(path);
+  for(uint32_t i = jnl.count; i-- > 0; ) {
+    if(jnl.hashes[i] == hash && strcmp(jnl.pool + jnl.records[i].path, path) == 0
+        && bit_get(deleted, deletedBits, hdr.count + i) == false)
+      return hdr.count + i;
+  }
+  for(uint32_t pos = lower_bound(MUSICDB_BY_PATH, path); pos < hdr.count; ++pos) {
+    uint32_t id = id_at(MUSICDB_BY_PATH, pos);
+    if(id == MUSICDB_NONE || record_at(id, &r) == false) break;
+    read_string(r.path, field, sizeof(field));
+    if(strcmp(field, path) != 0) break;
+    if((r.flags & MUSICDB_DELETED) == 0) return id;
+  }
+  return MUSICDB_NONE;
+}
+
+/* index of the newest entry for path in the base then journal dirs */
+static uint32_t find_dir(const char *path) {
+  char field[MUSICDB_FN_LEN];
+  musicdbDir_t d;
+  for(uint32_t i = jnl.dirCount; i-- > 0; )
+    if(strcmp(jnl.pool + jnl.dirs[i].path, path) == 0) return hdr.dirCount + i;
+  uint32_t lo = 0, hi = hdr.dirCount;
+  while(lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    dir_at(mid, &d);
+    read_string(d.path, field, sizeof(field));
+    int c = strcmp(field, path);
+    if(c == 0) return mid;
+    if(c < 0) lo = mid + 1;
+    else hi = mid;
+  }
+  return MUSICDB_NONE;
+}
+
+static void db_close() {
+  if(dbFile != NULL) fclose(dbFile);
+  dbFile = NULL;
+  memset(&hdr, 0, sizeof(hdr));
+  for(int i = 0; i < MUSICDB_CACHE_PAGES; ++i) {
+    cache[i].page = MUSICDB_NONE;
+    cache[i].used = 0;
+  }
+}
+
+/* a file that does not add up is treated like a missing one */
+static esp_err_t db_open() {
+  musicdbHeader_t h;
+  db_close();
+  dbFile = fopen(MUSICDB_PATH, "rb");
+  if(dbFile == NULL && rename(MUSICDB_TMP_PATH, MUSICDB_PATH) == 0) //power lost while swapping
+    dbFile = fopen(MUSICDB_PATH, "rb");
+  if(dbFile == NULL) return ESP_ERR_NOT_FOUND;
+  setvbuf(dbFile, NULL, _IONBF, 0);
+  fseek(dbFile, 0, SEEK_END);
+  uint64_t size = ftell(dbFile);
+  rewind(dbFile);
+  bool ok = fread(&h, 1, sizeof(h), dbFile) == sizeof(h) && h.magic == MUSICDB_MAGIC
+    && h.version == MUSICDB_VERSION && h.recordBytes == sizeof(musicdbRecord_t)
+    && h.recordOffset + (uint64_t)h.count * h.recordBytes <= size
+    && (uint64_t)h.stringOffset + h.stringBytes <= size
+    && h.dirOffset + (uint64_t)h.dirCount * sizeof(musicdbDir_t) <= size;
+  for(int i = 0; ok && i < MUSICDB_INDEXES; ++i)
+    ok = h.indexOffset[i] + (uint64_t)h.count * sizeof(uint32_t) <= size;
+  if(ok == false) {
+    ESP_LOGE(TAG, "%s is damaged or from another version", MUSICDB_PATH);
+    db_close();
+    return ESP_ERR_INVALID_VERSION;
+  }
+  hdr = h;
+  ESP_LOGI(TAG, "%d tracks", hdr.count);
+  return ESP_OK;
+}
+
+/* ---- journal, all with dbLock held ---- */
+
+static void journal_clear() {
+  set_free(&jnl);
+  set_init(&jnl);
+  free(deleted);
+  deleted = NULL;
+  deletedBits = 0;
+  changes = 0;
+}
+
+static esp_err_t journal_write(journalOp_t op, uint32_t arg, const void *data, uint32_t bytes,
+                               const char **strings, int n) {
+  journalEntry_t e = {op, arg, bytes};
+  for(int i = 0; i < n; ++i) e.bytes += strlen(strings[i] ? strings[i] : "") + 1;
+  if(jnlFile == NULL) return ESP_ERR_INVALID_STATE;
+  fwrite(&e, 1, sizeof(e), jnlFile);
+  if(bytes > 0) fwrite(data, 1, bytes, jnlFile);
+  for(int i = 0; i < n; ++i) {
+    const char *s = strings[i] ? strings[i] : "";
+    fwrite(s, 1, strlen(s) + 1, jnlFile);
+  }
+  changes++;
+  return ferror(jnlFile) ? ESP_FAIL : ESP_OK;
+}
+
+/* makes what was written so far survive a power loss */
+static void journal_sync() {
+  if(jnlFile == NULL) return;
+  fflush(jnlFile);
+  fsync(fileno(jnlFile));
+}
+
+static esp_err_t journal_start() {
+  journalHeader_t jh = {JOURNAL_MAGIC, MUSICDB_VERSION, hdr.stamp};
+  if(jnlFile != NULL) fclose(jnlFile);
+  jnlFile = fopen(MUSICDB_JOURNAL_PATH, "wb");
+  if(jnlFile == NULL) {
+    ESP_LOGE(TAG, "Failed to write %s", MUSICDB_JOURNAL_PATH);
+    return ESP_FAIL;
+  }
+  fwrite(&jh, 1, sizeof(jh), jnlFile);
+  journal_sync();
+  return ESP_OK;
+}
+
+/* writes the replayed state back out, after a torn last entry */
+static void journal_rewrite() {
+  const char *s[4];
+  uint32_t n = changes;
+  journal_start();
+  for(uint32_t i = 0; i < jnl.count; ++i) {
+    musicdbRecord_t *r = &jnl.records[i];
+    s[0] = jnl.pool + r->path;
+    s[1] = jnl.pool + r->title;
+    s[2] = jnl.pool + r->artist;
+    s[3] = jnl.pool + r->album;
+    journal_write(JOURNAL_ADD, 0, r, sizeof(musicdbRecord_t), s, 4);
+  }
+  for(uint32_t id = 0; id < deletedBits; ++id)
+    if(bit_get(deleted, deletedBits, id)) journal_write(JOURNAL_DELETE, id, NULL, 0, NULL, 0);
+  for(uint32_t i = 0; i < jnl.dirCount; ++i) {
+    s[0] = jnl.pool + jnl.dirs[i].path;
+    journal_write(JOURNAL_DIR, 0, &jnl.dirs[i], sizeof(musicdbDir_t), s, 1);
+  }
+  journal_sync();
+  changes = n;
+}
+
+/* applies the journal left by the last run if it belongs to this database,
+ * otherwise starts an empty one */
+static void journal_open() {
+  journalHeader_t jh;
+  journalEntry_t e;
+  bool torn = false;
+  uint8_t *buf = NULL;
+  journal_clear();
+  FILE *f = fopen(MUSICDB_JOURNAL_PATH, "rb");
+  if(f == NULL || fread(&jh, 1, sizeof(jh), f) != sizeof(jh) || jh.magic != JOURNAL_MAGIC
+      || jh.version != MUSICDB_VERSION || jh.stamp != hdr.stamp) {
+    if(f != NULL) fclose(f);
+    journal_start();
+    return;
+  }
+  while(fread(&e, 1, sizeof(e), f) == sizeof(e)) {
+    uint8_t *b = e.bytes < 4096 ? heap_caps_realloc(buf, e.bytes + 1, MALLOC_CAP_SPIRAM) : NULL;
+    if(b != NULL) buf = b;
+    if(b == NULL || fread(buf, 1, e.bytes, f) != e.bytes) {
+      torn = true;
+      break;
+    }
+    buf[e.bytes] = 0;
+    const char *s[4] = {"", "", "", ""};
+    uint32_t fixed = e.op == JOURNAL_ADD ? sizeof(musicdbRecord_t) : e.op == JOURNAL_DIR ? sizeof(musicdbDir_t) : 0;
+    if(e.bytes < fixed) {
+      torn = true;
+      break;
+    }
+    char *p = (char *)buf + fixed, *end = (char *)buf + e.bytes;
+    for(int i = 0; i < 4 && p < end; ++i) {
+      s[i] = p;
+      p += strlen(p) + 1;
+    }
+    if(e.op == JOURNAL_ADD) set_add(&jnl, (musicdbRecord_t *)buf, s[0], s[1], s[2], s[3]);
+    else if(e.op == JOURNAL_DIR) set_add_dir(&jnl, (musicdbDir_t *)buf, s[0]);
+    else if(e.op == JOURNAL_DELETE) bit_set(&deleted, &deletedBits, e.arg);
+    changes++;
+  }
+  free(buf);
+  fclose(f);
+  ESP_LOGI(TAG, "Journal: %d added, %d changes", jnl.count, changes);
+  if(torn) {
+    journal_rewrite();
+    return;
+  }
+  jnlFile = fopen(MUSICDB_JOURNAL_PATH, "ab");
+}
+
+/* ---- compaction ---- */
+
+/* folds the journal into a new database file off to the side and swaps it
+ * in. gives up if the journal grows meanwhile, the next rescan retries */
+static void taskCompact(void *parameter) {
+  recordSet_t *set = calloc(1, sizeof(recordSet_t));
+  char path[MUSICDB_FN_LEN], title[MUSICDB_TITLE_LEN], artist[MUSICDB_TITLE_LEN], album[MUSICDB_TITLE_LEN];
+  musicdbRecord_t r;
+  musicdbDir_t d;
+  bool ok = set != NULL && set_init(set) == ESP_OK;
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  uint32_t mark = changes, stamp = hdr.stamp + 1, total = hdr.count + jnl.count;
+  for(uint32_t id = 0; ok && id < total; ++id) {
+    if(id % COMPACT_BATCH == 0) {
+      xSemaphoreGive(dbLock);
+      xSemaphoreTake(dbLock, portMAX_DELAY);
+      if(changes != mark) break;
+    }
+    if(record_at(id, &r) == false || (r.flags & MUSICDB_DELETED)) continue;
+    read_string(r.path, path, sizeof(path));
+    read_string(r.title, title, sizeof(title));
+    read_string(r.artist, artist, sizeof(artist));
+    read_string(r.album, album, sizeof(album));
+    ok = set_add(set, &r, path, title, artist, album) == ESP_OK;
+  }
+  //newest entry per directory, the ones gone for good are left out
+  for(uint32_t i = 0; ok && changes == mark && i < hdr.dirCount + jnl.dirCount; ++i) {
+    dir_at(i, &d);
+    read_string(d.path, path, sizeof(path));
+    if((d.flags & MUSICDB_DIR_GONE) || find_dir(path) != i) continue;
+    ok = set_add_dir(set, &d, path) == ESP_OK;
+  }
+  ok = ok && changes == mark;
+  xSemaphoreGive(dbLock);
+  if(ok) ok = set_write(set, stamp, MUSICDB_TMP_PATH) == ESP_OK;
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  if(ok && changes == mark && rescanning == false) {
+    db_close();
+    remove(MUSICDB_PATH); //FAT does not rename over an existing file
+    rename(MUSICDB_TMP_PATH, MUSICDB_PATH);
+    db_open();
+    journal_clear();
+    journal_start();
+    generation++;
+    ESP_LOGI(TAG, "Compacted, %d tracks", hdr.count);
+  } else {
+    remove(MUSICDB_TMP_PATH);
+  }
+  compactTask = NULL;
+  xSemaphoreGive(dbLock);
+  if(set != NULL) set_free(set);
+  free(set);
+  vTaskDelete(NULL);
+}
+
+/* ---- api ---- */
+
+esp_err_t musicdb_init(void) {
+  dbLock = xSemaphoreCreateMutex();
+  if(dbLock == NULL) return ESP_ERR_NO_MEM;
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  esp_err_t ret = db_open();
+  journal_open();
+  xSemaphoreGive(dbLock);
+  return ret;
+}
+
+/* number of ids, including removed ones until the next compaction.
+ * 0 while there is nothing in the library */
+uint32_t musicdb_count(void) {
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  uint32_t n = hdr.count + jnl.count;
+  xSemaphoreGive(dbLock);
+  return n;
+}
+
+/* changes whenever a compaction renumbers the records */
+uint32_t musicdb_generation(void) {
+  return generation;
+}
+
+esp_err_t musicdb_record(uint32_t id, musicdbRecord_t *r) {
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  bool found = record_at(id, r);
+  xSemaphoreGive(dbLock);
+  return found ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+/* copies a string of a record into buf, truncated to len - 1 bytes */
+esp_err_t musicdb_string(uint32_t offset, char *buf, size_t len) {
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  read_string(offset, buf, len);
+  xSemaphoreGive(dbLock);
+  return ESP_OK;
+}
+
+/* file name and title of a record, empty strings if it does not exist */
+esp_err_t musicdb_read(uint32_t id, char *fileName, char *title) {
+  musicdbRecord_t r;
+  memset(fileName, 0, MUSICDB_FN_LEN);
+  memset(title, 0, MUSICDB_TITLE_LEN);
+  if(musicdb_record(id, &r) != ESP_OK || (r.flags & MUSICDB_DELETED)) return ESP_ERR_NOT_FOUND;
+  musicdb_string(r.path, fileName, MUSICDB_FN_LEN);
+  musicdb_string(r.title, title, MUSICDB_TITLE_LEN);
+  return ESP_OK;
+}
+
+/* record id at position pos when walking in order, MUSICDB_NONE past the end */
+uint32_t musicdb_id_at(musicdbOrder_t order, uint32_t pos) {
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  uint32_t id = id_at(order, pos);
+  xSemaphoreGive(dbLock);
+  return id;
+}
+
+/* up to count ids from position pos on, returns how many there were.
+ * removed records are left out, so a page can come back short */
+int musicdb_range(musicdbOrder_t order, uint32_t pos, int count, uint32_t *ids) {
+  int n = 0;
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  for(uint32_t id; n < count && (id = id_at(order, pos)) != MUSICDB_NONE; ++pos)
+    if(bit_get(deleted, deletedBits, id) == false) ids[n++] = id;
+  xSemaphoreGive(dbLock);
+  return n;
+}
+
+/* position of the first sorted record whose field is not below key,
+ * compared without case except for paths. MUSICDB_BY_ID has no key */
+uint32_t musicdb_find(musicdbOrder_t order, const char *key) {
+  if(order == MUSICDB_BY_ID) return 0;
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  uint32_t pos = lower_bound(order, key);
+  xSemaphoreGive(dbLock);
+  return pos;
+}
+
+/* id of the live record for path, MUSICDB_NONE if there is none */
+uint32_t musicdb_find_path(const char *path) {
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  uint32_t id = find_path(path);
+  xSemaphoreGive(dbLock);
+  return id;
+}
+
+/* ---- rescanning ---- */
+
+/* a rescan walks the directories and for each either confirms it with
+ * musicdb_dir_unchanged() or looks at its files with musicdb_file_check()
+ * and musicdb_add() and then records it with musicdb_dir_done(). the walk
+ * may be spread over several boots, musicdb_rescan_end() only removes
+ * directories that no longer exist */
+esp_err_t musicdb_rescan_begin(void) {
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  free(seen);
+  free(dirSeen);
+  seen = dirSeen = NULL;
+  seenBits = dirSeenBits = 0;
+  bool ok = bit_set(&seen, &seenBits, hdr.count + jnl.count)
+    && bit_set(&dirSeen, &dirSeenBits, hdr.dirCount + jnl.dirCount);
+  rescanning = ok;
+  xSemaphoreGive(dbLock);
+  return ok ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+static void drop_unseen(uint32_t id) {
+  if(bit_get(seen, seenBits, id) || bit_get(deleted, deletedBits, id)) return;
+  bit_set(&deleted, &deletedBits, id);
+  journal_write(JOURNAL_DELETE, id, NULL, 0, NULL, 0);
+}
+
+/* removes the records of files directly in path that were not checked */
+static void dir_drop(const char *path) {
+  char prefix[MUSICDB_FN_LEN], field[MUSICDB_FN_LEN];
+  musicdbRecord_t r;
+  int len = snprintf(prefix, sizeof(prefix), path[strlen(path) - 1] == '/' ? "%s" : "%s/", path);
+  //they are one run in path order, files of subdirectories in between
+  //have another / after the prefix
+  for(uint32_t pos = lower_bound(MUSICDB_BY_PATH, prefix); pos < hdr.count; ++pos) {
+    uint32_t id = id_at(MUSICDB_BY_PATH, pos);
+    if(id == MUSICDB_NONE || record_at(id, &r) == false) break;
+    read_string(r.path, field, sizeof(field));
+    if(strncmp(field, prefix, len) != 0) break;
+    if(strchr(field + len, '/') == NULL) drop_unseen(id);
+  }
+  for(uint32_t i = 0; i < jnl.count; ++i) {
+    const char *p = jnl.pool + jnl.records[i].path;
+    if(strncmp(p, prefix, len) == 0 && strchr(p + len, '/') == NULL) drop_unseen(hdr.count + i);
+  }
+}
+
+/* true if path is as it was, its tracks are kept without looking at them */
+bool musicdb_dir_unchanged(const char *path, uint32_t mtime, uint32_t names) {
+  musicdbDir_t d;
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  uint32_t i = find_dir(path);
+  if(i != MUSICDB_NONE) dir_at(i, &d);
+  bool same = i != MUSICDB_NONE && (d.flags & MUSICDB_DIR_GONE) == 0 && d.mtime == mtime
+    && d.names == names;
+  if(same) bit_set(&dirSeen, &dirSeenBits, i);
+  xSemaphoreGive(dbLock);
+  return same;
+}
+
+/* records a directory whose files have all been checked. tracks of files
+ * that are gone are removed first, so a journal cut short by a power loss
+ * never has the directory without its removals */
+esp_err_t musicdb_dir_done(const char *path, uint32_t mtime, uint32_t names) {
+  musicdbDir_t d = {0, mtime, names, 0};
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  dir_drop(path);
+  esp_err_t ret = set_add_dir(&jnl, &d, path);
+  if(ret == ESP_OK) {
+    bit_set(&dirSeen, &dirSeenBits, hdr.dirCount + jnl.dirCount - 1);
+    ret = journal_write(JOURNAL_DIR, 0, &d, sizeof(d), &path, 1);
+  }
+  journal_sync();
+  xSemaphoreGive(dbLock);
+  return ret;
+}
+
+/* id of the record for path if the file is unchanged, MUSICDB_NONE if it
+ * has to be read and added. a stale record is removed */
+uint32_t musicdb_file_check(const char *path, uint32_t size, uint32_t mtime) {
+  musicdbRecord_t r;
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  uint32_t id = find_path(path);
+  if(id != MUSICDB_NONE) {
+    record_at(id, &r);
+    if(r.size == size && r.mtime == mtime) {
+      bit_set(&seen, &seenBits, id);
+    } else {
+      bit_set(&deleted, &deletedBits, id);
+      journal_write(JOURNAL_DELETE, id, NULL, 0, NULL, 0);
+      id = MUSICDB_NONE;
+    }
+  }
+  xSemaphoreGive(dbLock);
+  return id;
+}
+
+/* appends a record, playable right away under id musicdb_count() - 1 */
+esp_err_t musicdb_add(const musicdbRecord_t *r, const char *path, const char *title,
+                      const char *artist, const char *album) {
+  const char *s[4] = {path, title, artist, album};
+  musicdbRecord_t rec = *r;
+  memset(&rec, 0, sizeof(uint32_t) * 4); //string offsets mean nothing in the journal
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  esp_err_t ret = set_add(&jnl, &rec, path, title, artist, album);
+  if(ret == ESP_OK) {
+    bit_set(&seen, &seenBits, hdr.count + jnl.count - 1);
+    ret = journal_write(JOURNAL_ADD, 0, &rec, sizeof(rec), s, 4);
+  }
+  xSemaphoreGive(dbLock);
+  return ret;
+}
+
+/* removes the directories the walk did not come across that are gone and
+ * compacts in the background if anything changed. returns the number of
+ * journal entries pending */
+int musicdb_rescan_end(void) {
+  musicdbDir_t d;
+  char path[MUSICDB_FN_LEN];
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  for(uint32_t i = 0; i < hdr.dirCount + jnl.dirCount; ++i) {
+    if(bit_get(dirSeen, dirSeenBits, i)) continue;
+    dir_at(i, &d);
+    read_string(d.path, path, sizeof(path));
+    if((d.flags & MUSICDB_DIR_GONE) || find_dir(path) != i) continue;
+    DIR *dir = opendir(path); //walked before a resume
+    if(dir != NULL) {
+      closedir(dir);
+      continue;
+    }
+    musicdbDir_t gone = {0, 0, 0, MUSICDB_DIR_GONE};
+    const char *s = path;
+    dir_drop(path);
+    set_add_dir(&jnl, &gone, path);
+    journal_write(JOURNAL_DIR, 0, &gone, sizeof(gone), &s, 1);
+  }
+  journal_sync();
+  free(seen);
+  free(dirSeen);
+  seen = dirSeen = NULL;
+  seenBits = dirSeenBits = 0;
+  rescanning = false;
+  int pending = changes;
+  if(pending > 0 && compactTask == NULL
+      && xTaskCreatePinnedToCore(taskCompact,"DB_COMPACT",4000,NULL,(portPRIVILEGE_BIT | 1),&compactTask,0) != pdPASS)
+    compactTask = NULL;
+  xSemaphoreGive(dbLock);
+  return pending;
+}
+
+/* directories the last scan found, for progress estimates */
+uint32_t musicdb_dir_count(void) {
+  xSemaphoreTake(dbLock, portMAX_DELAY);
+  uint32_t n = hdr.dirCount + jnl.dirCount;
+  xSemaphoreGive(dbLock);
+  return n;
+}
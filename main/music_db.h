@@ -0,0 +1,80 @@
+#ifndef _MUSIC_DB_H_
+#define _MUSIC_DB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#define MUSICDB_PATH "/sdcard/music.db"
+#define MUSICDB_TMP_PATH "/sdcard/music.tmp"
+#define MUSICDB_JOURNAL_PATH "/sdcard/music.jnl"
+#define MUSICDB_VERSION 3
+#define MUSICDB_PAGE_BYTES 512 //one sd sector
+#define MUSICDB_CACHE_PAGES 16
+#define MUSICDB_NONE 0xFFFFFFFF
+#define MUSICDB_JOURNALED 0x80000000 //string offset into the journal's pool
+
+#define MUSICDB_DELETED 0x01 //record flag, removed since the last compaction
+#define MUSICDB_DIR_GONE 0x01 //dir flag, no longer on the card
+
+/* orders the records can be walked in. MUSICDB_BY_ID is scan order and
+ * needs no table, the others are sorted tables of record ids in the file */
+typedef enum {
+  MUSICDB_BY_ID = -1, MUSICDB_BY_TITLE = 0, MUSICDB_BY_ARTIST, MUSICDB_BY_ALBUM, MUSICDB_BY_PATH,
+  MUSICDB_INDEXES
+} musicdbOrder_t;
+
+/* file layout: this header, count records, the string pool, dirCount
+ * directories sorted by path, then one table of count record ids per sorted
+ * order. all offsets are from the start of the file, all values little endian */
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t stamp; //changes on every rewrite, ties the journal to this file
+  uint32_t count;
+  uint32_t recordBytes; //sizeof(musicdbRecord_t) when written
+  uint32_t recordOffset;
+  uint32_t stringOffset, stringBytes;
+  uint32_t dirOffset, dirCount;
+  uint32_t indexOffset[MUSICDB_INDEXES];
+} musicdbHeader_t;
+
+/* strings are offsets into the pool, NUL terminated UTF-8 */
+typedef struct {
+  uint32_t path, title, artist, album;
+  uint32_t size, mtime; //of the file when its tags were read
+  uint16_t duration; //seconds, 0 = unknown
+  uint8_t type; //musicType_t
+  uint8_t flags;
+} musicdbRecord_t;
+
+/* a scanned directory, names is a hash of its entry names. unchanged mtime
+ * and names mean none of its files have to be looked at again. mtime is 0
+ * where stat() fails, FatFs cannot stat the root */
+typedef struct {
+  uint32_t path;
+  uint32_t mtime;
+  uint32_t names;
+  uint32_t flags;
+} musicdbDir_t;
+
+esp_err_t musicdb_init(void);
+uint32_t musicdb_count(void);
+uint32_t musicdb_generation(void);
+esp_err_t musicdb_record(uint32_t id, musicdbRecord_t *r);
+esp_err_t musicdb_string(uint32_t offset, char *buf, size_t len);
+esp_err_t musicdb_read(uint32_t id, char *fileName, char *title);
+uint32_t musicdb_id_at(musicdbOrder_t order, uint32_t pos);
+int musicdb_range(musicdbOrder_t order, uint32_t pos, int count, uint32_t *ids);
+uint32_t musicdb_find(musicdbOrder_t order, const char *key);
+uint32_t musicdb_find_path(const char *path);
+
+esp_err_t musicdb_rescan_begin(void);
+bool musicdb_dir_unchanged(const char *path, uint32_t mtime, uint32_t names);
+esp_err_t musicdb_dir_done(const char *path, uint32_t mtime, uint32_t names);
+uint32_t musicdb_file_check(const char *path, uint32_t size, uint32_t mtime);
+esp_err_t musicdb_add(const musicdbRecord_t *r, const char *path, const char *title,
+                      const char *artist, const char *album);
+int musicdb_rescan_end(void);
+uint32_t musicdb_dir_count(void);
+#endif
@@ -0,0 +1,141 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <string.h>
+#include "driver/i2s.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "i2s_dac.h"
+#include "pcm_buffer.h"
+#include "gain.h"
+
+#ifndef min
+  #define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif
+
+static const char *TAG = "PCM_BUF";
+static pcmBuffer_t pcmBuf;
+
+esp_err_t pcm_buffer_init(int ms) {
+  size_t size = (size_t)PCM_BUFFER_MAX_RATE * PCM_BUFFER_FRAME_BYTES * ms / 1000;
+  size -= size % PCM_OUT_CHUNK;
+  memset(&pcmBuf, 0, sizeof(pcmBuf));
+  pcmBuf.data = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+  if(pcmBuf.data == NULL) {
+    ESP_LOGE(TAG, "PCM buffer malloc failed");
+    return ESP_ERR_NO_MEM;
+  }
+  pcmBuf.size = size;
+  pcmBuf.channels = 2;
+  ESP_LOGI(TAG, "PCM buffer: %d bytes (%d ms)", (int)size, ms);
+  return ESP_OK;
+}
+
+/* head and tail run over [0, 2 * size) so that full and empty differ */
+static inline uint32_t ring_fill(uint32_t head, uint32_t tail) {
+  return (head + 2 * pcmBuf.size - tail) % (2 * pcmBuf.size);
+}
+
+static inline uint32_t ring_advance(uint32_t pos, uint32_t n) {
+  return (pos + n) % (2 * pcmBuf.size);
+}
+
+size_t pcm_buffer_fill() {
+  return ring_fill(pcmBuf.head, pcmBuf.tail);
+}
+
+/* called from the decoder task, blocks while the ring is full */
+size_t pcm_buffer_write(const void *data, size_t len) {
+  const uint8_t *src = data;
+  size_t written = 0;
+  pcmBuf.producer = xTaskGetCurrentTaskHandle();
+  pcmBuf.streaming = true;
+  while(written < len) {
+    uint32_t space = pcmBuf.size - ring_fill(pcmBuf.head, pcmBuf.tail);
+    if(space == 0) {
+      if(playerState.started == false) break;
+      ulTaskNotifyTake(pdTRUE, 10 / portTICK_RATE_MS);
+      continue;
+    }
+    uint32_t pos = pcmBuf.head % pcmBuf.size;
+    uint32_t n = min(min(space, len - written), pcmBuf.size - pos);
+    memcpy(pcmBuf.data + pos, src + written, n);
+    __sync_synchronize();
+    pcmBuf.head = ring_advance(pcmBuf.head, n);
+    written += n;
+    if(pcmBuf.consumer != NULL) xTaskNotifyGive(pcmBuf.consumer);
+  }
+  return written;
+}
+
+/* wait until the output task has handed everything to i2s, e.g. before
+ * changing the i2s clock */
+void pcm_buffer_drain() {
+  while(pcm_buffer_fill() != 0 && playerState.started == true)
+    ulTaskNotifyTake(pdTRUE, 10 / portTICK_RATE_MS);
+}
+
+/* after pcm_buffer_drain(), the output task ramps the gain per frame */
+void pcm_buffer_set_channels(int channels) {
+  pcmBuf.channels = channels;
+}
+
+/* drop everything not yet played, used when a track is stopped */
+void pcm_buffer_flush() {
+  pcmBuf.streaming = false;
+  if(pcmBuf.consumer == NULL) {
+    pcmBuf.tail = pcmBuf.head;
+    return;
+  }
+  pcmBuf.flushReq = true;
+  xTaskNotifyGive(pcmBuf.consumer);
+  while(pcmBuf.flushReq == true) vTaskDelay(1);
+}
+
+/* end of stream, an empty ring is no longer an underrun */
+void pcm_buffer_end() {
+  pcmBuf.streaming = false;
+}
+
+/* the volume is applied here rather than by the decoders so that a change
+ * is heard right away and not after the PCM_BUFFER_MS already buffered */
+void taskI2SOutput(void *parameter) {
+  static int16_t out[PCM_OUT_CHUNK / 2]; //internal RAM, the ring is in PSRAM
+  size_t n;
+  bool starved = false, muted = false;
+  pcmBuf.consumer = xTaskGetCurrentTaskHandle();
+  while(1) {
+    if(pcmBuf.flushReq == true) {
+      pcmBuf.tail = pcmBuf.head;
+      i2s_zero_dma_buffer(i2s_num);
+      pcmBuf.flushReq = false;
+    }
+    if(playerState.paused == true) {
+      if(muted == false) i2s_zero_dma_buffer(i2s_num);
+      muted = true;
+      ulTaskNotifyTake(pdTRUE, 20 / portTICK_RATE_MS);
+      continue;
+    }
+    muted = false;
+    uint32_t fill = ring_fill(pcmBuf.head, pcmBuf.tail);
+    playerState.bufferFill = (uint64_t)fill * 100 / pcmBuf.size;
+    if(fill == 0) {
+      if(pcmBuf.streaming == true && starved == false) {
+        playerState.underruns++;
+        starved = true;
+      }
+      ulTaskNotifyTake(pdTRUE, 20 / portTICK_RATE_MS);
+      continue;
+    }
+    starved = false;
+    uint32_t pos = pcmBuf.tail % pcmBuf.size;
+    uint32_t len = min(min(fill, PCM_OUT_CHUNK), pcmBuf.size - pos);
+    __sync_synchronize();
+    memcpy(out, pcmBuf.data + pos, len);
+    gain_apply_s16(out, len / 2 / pcmBuf.channels, pcmBuf.channels, playerState.volumeGain);
+    i2s_write(i2s_num, out, len, &n, portMAX_DELAY);
+    pcmBuf.tail = ring_advance(pcmBuf.tail, len);
+    if(pcmBuf.producer != NULL) xTaskNotifyGive(pcmBuf.producer);
+  }
+}
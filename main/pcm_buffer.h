@@ -0,0 +1,30 @@
+#ifndef _PCM_BUFFER_H_
+#define _PCM_BUFFER_H_
+
+#define PCM_BUFFER_MS 500 //buffered audio between decoder and i2s
+#define PCM_BUFFER_MAX_RATE 48000
+#define PCM_BUFFER_FRAME_BYTES 4 //16-bit stereo
+#define PCM_OUT_CHUNK 1024 //max bytes handed to i2s_write at once
+
+/* single-producer/single-consumer ring buffer, decoder -> i2s output task.
+ * only head is written by the producer and only tail by the consumer. */
+typedef struct {
+  uint8_t *data;
+  uint32_t size;
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  volatile bool streaming;
+  volatile bool flushReq;
+  int channels; //of what is in the ring, changed only while it is empty
+  TaskHandle_t producer, consumer;
+} pcmBuffer_t;
+
+esp_err_t pcm_buffer_init(int ms);
+size_t pcm_buffer_write(const void *data, size_t len);
+size_t pcm_buffer_fill();
+void pcm_buffer_drain();
+void pcm_buffer_set_channels(int channels);
+void pcm_buffer_flush();
+void pcm_buffer_end();
+void taskI2SOutput(void *parameter);
+#endif
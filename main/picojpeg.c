@@ -13,11 +13,21 @@
 
 // Define PJPG_INLINE to "inline" if your C compiler supports explicit inlining
 #define PJPG_INLINE
+
+// Set to 1 to decode Huffman codes of up to PJPG_HUFF_LOOKAHEAD_BITS bits with
+// a table lookup from a 32-bit bit buffer, instead of one bit at a time.
+// Costs 2 << PJPG_HUFF_LOOKAHEAD_BITS bytes of RAM per Huffman table (4 tables).
+// Set to 0 for the original tiny-memory decoder.
+#ifndef PJPG_HUFF_LOOKAHEAD
+#define PJPG_HUFF_LOOKAHEAD 1
+#endif
+#define PJPG_HUFF_LOOKAHEAD_BITS 9
 //------------------------------------------------------------------------------
 typedef unsigned char   uint8;
 typedef unsigned short  uint16;
 typedef signed char     int8;
 typedef signed short    int16;
+typedef unsigned int    uint32;
 //------------------------------------------------------------------------------
 #if PJPG_RIGHT_SHIFT_IS_ALWAYS_UNSIGNED
 static int16 replicateSignBit16(int8 n)
@@ -158,6 +168,11 @@ typedef struct HuffTableT
    uint16 mMinCode[16];
    uint16 mMaxCode[16];
    uint8 mValPtr[16];
+#if PJPG_HUFF_LOOKAHEAD
+   // (code length << 8) | value, indexed by the next PJPG_HUFF_LOOKAHEAD_BITS
+   // bits. 0 for longer codes.
+   uint16 mLookup[1 << PJPG_HUFF_LOOKAHEAD_BITS];
+#endif
 } HuffTable;
 
 // DC - 192
@@ -186,6 +201,12 @@ static uint8 gInBufLeft;
 
 static uint16 gBitBuf;
 static uint8 gBitsLeft;
+
+#if PJPG_HUFF_LOOKAHEAD
+// Entropy coded data is read through its own buffer, MSB first.
+static uint32 gScanBitBuf;
+static uint8 gScanBitsLeft;
+#endif
 //------------------------------------------------------------------------------
 static uint16 gImageXSize;
 static uint16 gImageYSize;
@@ -319,6 +340,32 @@ static PJPG_INLINE uint16 getBits1(uint8 numBits)
    return getBits(numBits, 0);
 }
 //------------------------------------------------------------------------------
+#if PJPG_HUFF_LOOKAHEAD
+// Tops up gScanBitBuf to more than 24 bits.
+static PJPG_INLINE void fillScanBits(void)
+{
+   while (gScanBitsLeft <= 24)
+   {
+      gScanBitBuf |= (uint32)getOctet(1) << (24 - gScanBitsLeft);
+      gScanBitsLeft += 8;
+   }
+}
+//------------------------------------------------------------------------------
+// numBits must be 1-16.
+static PJPG_INLINE uint16 getBits2(uint8 numBits)
+{
+   uint16 ret;
+
+   if (gScanBitsLeft < numBits)
+      fillScanBits();
+
+   ret = (uint16)(gScanBitBuf >> (32 - numBits));
+   gScanBitBuf <<= numBits;
+   gScanBitsLeft = (uint8)(gScanBitsLeft - numBits);
+
+   return ret;
+}
+#else
 static PJPG_INLINE uint16 getBits2(uint8 numBits)
 {
    return getBits(numBits, 1);
@@ -342,6 +389,20 @@ static PJPG_INLINE uint8 getBit(void)
    
    return ret;
 }
+#endif
+//------------------------------------------------------------------------------
+// Starts reading entropy coded data, after the SOS or a restart marker.
+static void initScanBits(void)
+{
+#if PJPG_HUFF_LOOKAHEAD
+   gScanBitBuf = 0;
+   gScanBitsLeft = 0;
+#else
+   gBitsLeft = 8;
+   getBits2(8);
+   getBits2(8);
+#endif
+}
 //------------------------------------------------------------------------------
 static uint16 getExtendTest(uint8 i)
 {
@@ -396,6 +457,45 @@ static PJPG_INLINE int16 huffExtend(uint16 x, uint8 s)
    return ((x < getExtendTest(s)) ? ((int16)x + getExtendOffset(s)) : (int16)x);
 }
 //------------------------------------------------------------------------------
+#if PJPG_HUFF_LOOKAHEAD
+static PJPG_INLINE uint8 huffDecode(const HuffTable* pHuffTable, const uint8* pHuffVal)
+{
+   uint8 i;
+   uint16 code;
+   uint16 entry;
+
+   if (gScanBitsLeft < 16)
+      fillScanBits();
+
+   entry = pHuffTable->mLookup[gScanBitBuf >> (32 - PJPG_HUFF_LOOKAHEAD_BITS)];
+   if (entry)
+   {
+      gScanBitBuf <<= entry >> 8;
+      gScanBitsLeft = (uint8)(gScanBitsLeft - (entry >> 8));
+      return (uint8)entry;
+   }
+
+   // A longer code, found like huffDecode() below does but with all bits at once.
+   for (i = PJPG_HUFF_LOOKAHEAD_BITS; i < 16; i++)
+   {
+      uint16 maxCode = pHuffTable->mMaxCode[i];
+
+      code = (uint16)(gScanBitBuf >> (31 - i));
+      if ((code <= maxCode) && (maxCode != 0xFFFF))
+         break;
+   }
+
+   if (i == 16)
+   {
+      getBits2(16);
+      return 0;
+   }
+
+   getBits2(i + 1);
+
+   return pHuffVal[(uint8)(pHuffTable->mValPtr[i] + (code - pHuffTable->mMinCode[i]))];
+}
+#else
 static PJPG_INLINE uint8 huffDecode(const HuffTable* pHuffTable, const uint8* pHuffVal)
 {
    uint8 i = 0;
@@ -426,11 +526,15 @@ static PJPG_INLINE uint8 huffDecode(const HuffTable* pHuffTable, const uint8* pH
 
    return pHuffVal[j];
 }
+#endif
 //------------------------------------------------------------------------------
-static void huffCreate(const uint8* pBits, HuffTable* pHuffTable)
+static void huffCreate(const uint8* pBits, HuffTable* pHuffTable, const uint8* pHuffVal)
 {
    uint8 i = 0;
    uint8 j = 0;
+#if PJPG_HUFF_LOOKAHEAD
+   uint16 k;
+#endif
 
    uint16 code = 0;
       
@@ -461,6 +565,41 @@ static void huffCreate(const uint8* pBits, HuffTable* pHuffTable)
       if (i > 15)
          break;
    }
+
+#if PJPG_HUFF_LOOKAHEAD
+   // Every code of up to PJPG_HUFF_LOOKAHEAD_BITS bits fills the entries of
+   // all the bit patterns that start with it.
+   for (k = 0; k < (1 << PJPG_HUFF_LOOKAHEAD_BITS); k++)
+      pHuffTable->mLookup[k] = 0;
+
+   code = 0;
+   j = 0;
+   for (i = 0; i < PJPG_HUFF_LOOKAHEAD_BITS; i++)
+   {
+      uint8 len = i + 1;
+      uint8 n;
+
+      for (n = 0; n < pBits[i]; n++)
+      {
+         uint16 first = code << (PJPG_HUFF_LOOKAHEAD_BITS - len);
+         uint16 count = 1 << (PJPG_HUFF_LOOKAHEAD_BITS - len);
+
+         // Over-subscribed table, the rest can't be decoded anyway.
+         if (first + count > (1 << PJPG_HUFF_LOOKAHEAD_BITS))
+            return;
+
+         for (k = 0; k < count; k++)
+            pHuffTable->mLookup[first + k] = (uint16)((len << 8) | pHuffVal[j]);
+
+         j++;
+         code++;
+      }
+
+      code <<= 1;
+   }
+#else
+   (void)pHuffVal;
+#endif
 }
 //------------------------------------------------------------------------------
 static HuffTable* getHuffTable(uint8 index)
@@ -546,7 +685,7 @@ static uint8 readDHTMarker(void)
 
       left = (uint16)(left - totalRead);
 
-      huffCreate(bits, pHuffTable);
+      huffCreate(bits, pHuffTable, pHuffVal);
    }
       
    return 0;
@@ -974,9 +1113,7 @@ static void fixInBuffer(void)
    
    stuffChar((uint8)(gBitBuf >> 8));
    
-   gBitsLeft = 8;
-   getBits2(8);
-   getBits2(8);
+   initScanBits();
 }
 //------------------------------------------------------------------------------
 // Restart interval processing.
@@ -1016,9 +1153,7 @@ static uint8 processRestart(void)
 
    // Get the bit buffer going again
 
-   gBitsLeft = 8;
-   getBits2(8);
-   getBits2(8);
+   initScanBits();
    
    return 0;
 }
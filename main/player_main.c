@@ -27,10 +27,16 @@
 #include "sd_card.h"
 #include "dirent.h"
 #include "i2s_dac.h"
+#include "music_db.h"
+#include "cover_art.h"
+#include "pcm_buffer.h"
 #include "ui.h"
+#include "ui_event.h"
 #include "keypad_control.h"
 #include "mp3dec.h"
 #include "ledc.h"
+#include "helix_bench.h"
+#include "gain.h"
 
 static EventGroupHandle_t wifi_event_group;
 const int WIFI_CONNECTED_BIT = BIT0;
@@ -88,6 +94,7 @@ void app_main() {
   ESP_LOGI(TAG, "SPIFFS: free %d KB of %d KB\n", (tot-used) / 1024, tot / 1024);
   //sdcard init
   sdmmc_mount(&card);
+  musicdb_init();
 
   //littlevgl init
   lv_init();
@@ -108,6 +115,7 @@ void app_main() {
   pcfs_drv.seek = pcfs_seek;
   pcfs_drv.tell = pcfs_tell;
   lv_fs_add_drv(&pcfs_drv);
+  if(cover_init() != ESP_OK) ESP_LOGE(TAG, "No cover art.");
 
 
   //set up littlevgl input device
@@ -139,6 +147,8 @@ void app_main() {
   ESP_ERROR_CHECK( esp_wifi_start() );
   ESP_ERROR_CHECK( esp_wifi_connect() );
 
+  //everything that changes on screen is posted to the UI task
+  ESP_ERROR_CHECK(ui_event_init());
   //keypad init
   ESP_ERROR_CHECK(keyQueueCreate());
   if(xTaskCreatePinnedToCore(taskScanKey,"KEYSCAN",2000,NULL,(portPRIVILEGE_BIT | 3),&keyHandle,1) == pdPASS)
@@ -158,8 +168,20 @@ void app_main() {
     ESP_LOGI(TAG, "Backlight control task created.");
   else ESP_LOGE(TAG, "Failed to create backlight control task.");
 
+#ifdef CONFIG_HELIX_KERNEL_BENCH
+  helix_kernel_bench();
+#endif
+#ifdef CONFIG_GAIN_BENCH
+  gain_bench();
+#endif
   //i2s init
   i2s_init();
+  if(xTaskCreatePinnedToCore(taskI2SOutput,"I2S_OUT",3000,NULL,(portPRIVILEGE_BIT | 5),NULL,0) == pdPASS)
+    ESP_LOGI(TAG, "I2S output task created.");
+  else ESP_LOGE(TAG, "Failed to create I2S output task.");
+  if(xTaskCreatePinnedToCore(taskPreload,"PRELOAD",3000,NULL,(portPRIVILEGE_BIT | 2),NULL,0) == pdPASS)
+    ESP_LOGI(TAG, "Track preload task created.");
+  else ESP_LOGE(TAG, "Failed to create track preload task.");
   player_pause(false);
   playerState.started = true;
 
@@ -15,12 +15,15 @@
 #include "soc/gpio_struct.h"
 #include "driver/gpio.h"
 #include "driver/adc.h"
-#include "picojpeg.h"
 #include "../lvgl/lvgl.h"
 
 #include "i2s_dac.h"
+#include "music_db.h"
+#include "library_scan.h"
+#include "cover_art.h"
 #include "keypad_control.h"
 #include "ui.h"
+#include "ui_event.h"
 
 LV_IMG_DECLARE(default_cover);
 LV_FONT_DECLARE(hansans_20_cn);
@@ -34,127 +37,34 @@ uint8_t menuID = 0;
 
 static const char *TAG = "UI";
 lv_theme_t *th;
-key_event_t key_event;
 int selected = 0;
-lv_obj_t *status_bar, *battery_icon, *battery_text, *volume, *wifi_icon, *playing_icon;
+lv_obj_t *status_bar, *battery_icon, *battery_text, *volume, *wifi_icon, *playing_icon, *scan_text;
 lv_obj_t *screen, *home_list, *library_list;
 lv_obj_t *img_cover, *info_obj, *now_playing, *author, *album, *sample_info, *time_text, *time_bar, *playmode;
 lv_style_t status_bar_style, status_bar_icon_style, title_20, style_focused;
 lv_group_t *group;
 
-static lv_res_t onclick_homelist(lv_obj_t * list_btn);
-static lv_res_t onclick_library(lv_obj_t * list_btn);
+/* titles around the visible library rows, read in one go so that scrolling
+ * row by row only touches the card every few pages */
 typedef struct {
-	size_t inBufSize, inBufOffset;
-	FILE *fPtr;
-	uint8_t *inBuf;
-} JPEG_Decoder_t;
-
-JPEG_Decoder_t *JPEG_Decoder;
-unsigned char pjpeg_callback (
-	unsigned char* pBuf,
-	unsigned char buf_size,
-	unsigned char *pBytes_actually_read,
-	void *pCallback_data) {
-
-	unsigned int n;
-
-	n = min(JPEG_Decoder->inBufSize - JPEG_Decoder->inBufOffset, buf_size);
-
-	if(JPEG_Decoder->fPtr != NULL) {
-		*pBytes_actually_read = fread(pBuf, sizeof(unsigned char), n, JPEG_Decoder->fPtr);
-	}
-	else {
-		for(int i = 0; i < n; ++i)
-			pBuf[i] = *(JPEG_Decoder->inBuf + JPEG_Decoder->inBufOffset + i);
-		*pBytes_actually_read = (uint8_t)n;
-	}
-
-	JPEG_Decoder->inBufOffset += n;
-	return 0;
-}
-
-static int lv_img_set_src_jpg(lv_obj_t *img_obj, char *fname, uint8_t *buf, int size) {
-	if(img_obj == NULL) return 0;
-	pjpeg_image_info_t image_info;
-	JPEG_Decoder = heap_caps_malloc(sizeof(JPEG_Decoder_t), MALLOC_CAP_SPIRAM);
-	memset(JPEG_Decoder, 0, sizeof(JPEG_Decoder_t));
-
-	if(fname != NULL) {
-		JPEG_Decoder->fPtr = fopen(fname, "rb");
-		if(JPEG_Decoder->fPtr == NULL) {
-			ESP_LOGE(TAG, "Unable to open jpeg file.");
-			free(JPEG_Decoder);
-			return 0;
-		}
-		fseek(JPEG_Decoder->fPtr, 0, SEEK_END);
-		JPEG_Decoder->inBufSize = ftell(JPEG_Decoder->fPtr);
-		rewind(JPEG_Decoder->fPtr);
-	}
-	else {
-		if(buf == NULL) {
-			free(JPEG_Decoder);
-			return 0;
-		}
-		JPEG_Decoder->inBufSize = size;
-		JPEG_Decoder->inBuf = buf;
-	}
-
-	unsigned char status = pjpeg_decode_init(&image_info, pjpeg_callback, NULL, 0);
-	if(status) {
-		free(JPEG_Decoder);
-		return 0;
-	}
-
-	ESP_LOGI(TAG, "Image size: %ix%i", image_info.m_width, image_info.m_height);
-	ESP_LOGI(TAG, "MCU size: %ix%i", image_info.m_MCUWidth, image_info.m_MCUHeight);
-
-
-
-	status = 0;
-	int pos = 0;
-	uint16_t pixel;
-	// for(int mY = 0; mY < image_info.m_MCUSPerRow; ++mY) {
-	// 	if(status) {
-	// 		if(status == PJPG_NO_MORE_BLOCKS) break;
-	// 		else return 0;
-	// 	}
-	// 	for(int mX = 0; mX < image_info.m_MCUSPerCol; ++mX) {
-	// 		status = pjpeg_decode_mcu();
-	// 		if(status) {
-	// 			if(status == PJPG_NO_MORE_BLOCKS) break;
-	// 			else return 0;
-	// 		}
-	// 		if(image_info.m_scanType == PJPG_GRAYSCALE) {
-	// 			for(int i = 0; i < image_info.m_MCUHeight; ++i) {
-	// 				for(int j = 0; j < image_info.m_MCUWidth; ++j) {
-	// 					pixel = (image_info.m_pMCUBufR[i * (image_info.m_MCUWidth) + j] & 0xF8) << 8
-	// 							| (image_info.m_pMCUBufR[i * (image_info.m_MCUWidth) + j] & 0xFC) << 3
-	// 							| (image_info.m_pMCUBufR[i * (image_info.m_MCUWidth) + j] & 0xF8) >> 3;
-	// 					img_pixels[pos] = (uint8_t)(pixel >> 8);
-	// 					img_pixels[pos + 1] = (uint8_t)(pixel & 0xff);
-	// 				}
-	// 			}
-	// 		}
-	// 		else {
-	// 			for(int i = 0; i < image_info.m_MCUHeight; ++i) {
-	// 				for(int j = 0; j < image_info.m_MCUWidth; ++j) {
-	// 					pixel = (image_info.m_pMCUBufR[i * (image_info.m_MCUWidth) + j] & 0xF8) << 8
-	// 							| (image_info.m_pMCUBufG[i * (image_info.m_MCUWidth) + j] & 0xFC) << 3
-	// 							| (image_info.m_pMCUBufB[i * (image_info.m_MCUWidth) + j] & 0xF8) >> 3;
-	// 					img_pixels[pos] = (uint8_t)(pixel >> 8);
-	// 					img_pixels[pos + 1] = (uint8_t)(pixel & 0xff);
-	// 				}
-	// 			}
-	// 		}
-	// 		pos += 2;
-	// 	}
-	// }
-
-	free(JPEG_Decoder);
-	return 1;
-}
+	int start, count; //position of ids[0] in title order, entries held
+	int len; //playlist_len when read
+	uint32_t generation;
+	uint32_t ids[LIBRARY_WINDOW];
+	char titles[LIBRARY_WINDOW][MUSICDB_TITLE_LEN];
+} libraryWindow_t;
+
+//the library rows are created once and rebound to whatever is in view
+static lv_obj_t *library_rows[LIBRARY_ROWS];
+static uint32_t library_ids[LIBRARY_ROWS];
+static char library_text[LIBRARY_ROWS][MUSICDB_TITLE_LEN]; //static text of the row labels
+static libraryWindow_t library_window = {.len = -1};
+static int list_pos; //selected row, position in title order
 
+static lv_res_t onclick_homelist(lv_obj_t * list_btn);
+static lv_res_t onclick_library(lv_obj_t * list_btn);
+static void show_track();
+static void show_track_info();
 static void style_init() {
 	lv_style_copy(&status_bar_style, &lv_style_scr);
 	status_bar_style.body.main_color = LV_COLOR_BLACK;
@@ -192,7 +102,7 @@ void taskBattery(void *parameter) {
 	TickType_t xLastWakeTime;
  	const TickType_t xFrequency = 10*1000 / portTICK_RATE_MS;
  	xLastWakeTime = xTaskGetTickCount();
-	int data = 0;
+	int data = 0, last = -1;
 	while(1) {
 		data = 0;
 		for(int i = 0; i < 5; ++i) {
@@ -203,12 +113,15 @@ void taskBattery(void *parameter) {
 		ESP_LOGI(TAG, "Battery voltage: %i mV", batteryVoltage);
 		batteryPercentage = ((double)batteryVoltage - 3700) / 500.0 * 100;
 		ESP_LOGI(TAG, "Battery pecentage: %i %%", batteryPercentage);
+		if(batteryPercentage != last) ui_post(UI_EVENT_BATTERY, batteryPercentage);
+		last = batteryPercentage;
 		vTaskDelayUntil(&xLastWakeTime, xFrequency);
 	}
 }
 void clear_screen() {
 	lv_group_del(group);
 	lv_obj_clean(screen);
+	if(library_list != NULL) lv_obj_set_hidden(library_list, true);
 	group = lv_group_create();
 	lv_indev_set_group(keypad_indev, group);
 	lv_group_set_style_mod_cb(group, style_mod_cb);
@@ -225,31 +138,79 @@ void drawHomeScreen() {
 	lv_group_focus_obj(home_list);
 }
 
+static void library_fetch(int top) {
+	libraryWindow_t *w = &library_window;
+	//a compaction renumbers the tracks, an id on a row means nothing then
+	if(w->generation != musicdb_generation())
+		for(int i = 0; i < LIBRARY_ROWS; ++i) library_ids[i] = MUSICDB_NONE;
+	w->start = max(top - (LIBRARY_WINDOW - LIBRARY_ROWS) / 2, 0);
+	w->count = musicdb_range(MUSICDB_BY_TITLE, w->start, LIBRARY_WINDOW, w->ids);
+	w->len = playlist_len;
+	w->generation = musicdb_generation();
+	for(int i = 0; i < w->count; ++i) {
+		musicdbRecord_t r;
+		w->titles[i][0] = 0;
+		if(musicdb_record(w->ids[i], &r) == ESP_OK) musicdb_string(r.title, w->titles[i], MUSICDB_TITLE_LEN);
+	}
+}
+
+/* points the rows at list_offset on, only rows whose track changed get new
+ * text. removed tracks leave the window short like they did the pages */
+static void library_bind() {
+	libraryWindow_t *w = &library_window;
+	int len = playlist_len;
+	list_pos = max(min(list_pos, len - 1), 0);
+	list_offset = max(min(list_offset, len - LIBRARY_ROWS), 0);
+	if(list_pos < list_offset) list_offset = list_pos;
+	if(list_pos >= list_offset + LIBRARY_ROWS) list_offset = list_pos - LIBRARY_ROWS + 1;
+	//the scan only adds to the end, a full window stays valid
+	if(w->generation != musicdb_generation() || (w->count < LIBRARY_WINDOW && w->len != len)
+		 || list_offset < w->start || list_offset + LIBRARY_ROWS > w->start + LIBRARY_WINDOW)
+		library_fetch(list_offset);
+	for(int i = 0; i < LIBRARY_ROWS; ++i) {
+		lv_obj_t *btn = library_rows[i];
+		int k = list_offset + i - w->start;
+		if(k >= w->count) {
+			if(lv_obj_get_hidden(btn) == false) lv_obj_set_hidden(btn, true);
+			library_ids[i] = MUSICDB_NONE;
+			continue;
+		}
+		if(lv_obj_get_hidden(btn) == true) lv_obj_set_hidden(btn, false);
+		if(library_ids[i] != w->ids[k]) {
+			library_ids[i] = w->ids[k];
+			lv_obj_set_free_num(btn, w->ids[k]);
+			strcpy(library_text[i], w->titles[k]);
+			lv_label_set_static_text(lv_list_get_btn_label(btn), library_text[i]);
+		}
+		lv_btn_set_state(btn, list_offset + i == list_pos ? LV_BTN_STATE_TGL_REL : LV_BTN_STATE_REL);
+	}
+}
+
+/* the list is kept while other screens are shown and is not in the group,
+ * the UI task moves the selection itself so it can scroll past the rows */
 void drawLibrary() {
-	library_list = lv_list_create(screen, NULL);
-	lv_obj_set_size(library_list, 320, 216);
-	lv_group_add_obj(group, library_list);
-	lv_list_set_anim_time(library_list, 0);
-	char tmp_title[MUSICDB_TITLE_LEN];
-	FILE *db = fopen("/sdcard/music_list.db", "rb");
-	lv_obj_t *btn;
-	if(db != NULL) {
-		for(int i = list_offset; i < list_offset + 4; ++i) {
-			fseek(db, i * (MUSICDB_FN_LEN + MUSICDB_TITLE_LEN) + MUSICDB_FN_LEN, SEEK_SET);
-			fread(tmp_title, 1, MUSICDB_TITLE_LEN, db);
-			btn = lv_list_add(library_list, SYMBOL_AUDIO, tmp_title, onclick_library);
-			lv_label_set_long_mode(lv_list_get_btn_label(btn), LV_LABEL_LONG_BREAK);
+	if(library_list == NULL) {
+		library_list = lv_list_create(lv_scr_act(), NULL);
+		lv_obj_set_size(library_list, 320, 216);
+		lv_obj_set_pos(library_list, 0, 24);
+		lv_list_set_anim_time(library_list, 0);
+		lv_list_set_sb_mode(library_list, LV_SB_MODE_OFF);
+		for(int i = 0; i < LIBRARY_ROWS; ++i) {
+			library_rows[i] = lv_list_add(library_list, SYMBOL_AUDIO, " ", onclick_library);
+			//one line each, so that the rows always fill the list the same way
+			lv_label_set_long_mode(lv_list_get_btn_label(library_rows[i]), LV_LABEL_LONG_DOT);
+			library_ids[i] = MUSICDB_NONE;
 		}
-		fclose(db);
 	}
-	lv_group_focus_obj(library_list);
+	lv_obj_set_hidden(library_list, false);
+	library_bind();
 }
 
 void drawPlaying() {
 	img_cover = lv_img_create(screen, NULL);
 	lv_img_set_src(img_cover, &default_cover);
 	lv_obj_set_pos(img_cover, 15, 15);
-	lv_obj_set_size(img_cover, 128, 128);
+	lv_obj_set_size(img_cover, COVER_SIZE, COVER_SIZE);
 
 	info_obj = lv_obj_create(screen, screen);
 	lv_obj_set_pos(info_obj, 160, 20);
@@ -259,22 +220,18 @@ void drawPlaying() {
 	lv_label_set_style(now_playing, &title_20);
 	lv_obj_set_pos(now_playing, 0, 0);
 	lv_label_set_long_mode(now_playing, LV_LABEL_LONG_SCROLL);
-	lv_label_set_text(now_playing, playerState.title);
 
 	author = lv_label_create(info_obj, NULL);
 	lv_label_set_style(author, &title_20);
 	lv_obj_set_pos(author, 0, 30);
-	lv_label_set_text(author, playerState.author);
 	lv_label_set_long_mode(author, LV_LABEL_LONG_SCROLL);
 
 	album = lv_label_create(info_obj, author);
 	lv_obj_set_pos(album, 0, 60);
-	lv_label_set_text(author, playerState.album);
 	lv_label_set_long_mode(album, LV_LABEL_LONG_SCROLL);
 
 	sample_info = lv_label_create(info_obj, author);
 	lv_obj_set_pos(sample_info, 0, 90);
-	lv_label_set_text(sample_info, "44100Hz 16-bit");
 
 	time_bar = lv_bar_create(screen, NULL);
 	lv_obj_set_size(time_bar, 290, 10);
@@ -283,7 +240,9 @@ void drawPlaying() {
 
 	time_text = lv_label_create(screen, author);
 	lv_obj_set_pos(time_text, 15, 158);
-	lv_label_set_text(time_text, "0:00 / 0:00");
+
+	show_track();
+	show_track_info();
 }
 
 void drawStatusBar() {
@@ -309,11 +268,179 @@ void drawStatusBar() {
 	lv_label_set_style(volume, &status_bar_icon_style);
 	lv_obj_set_pos(volume, 40, 2);
 
+	scan_text = lv_label_create(status_bar, NULL);
+	lv_label_set_style(scan_text, &status_bar_icon_style);
+	lv_obj_set_pos(scan_text, 205, 2);
+
 	wifi_icon = lv_label_create(status_bar, NULL);
 	lv_label_set_style(wifi_icon, &status_bar_icon_style);
 	lv_obj_set_pos(wifi_icon, 265, 2);
 }
 
+//only a label whose text really changes is invalidated and sent to the display
+static void label_set(lv_obj_t *label, const char *text) {
+	if(strcmp(lv_label_get_text(label), text) != 0) lv_label_set_text(label, text);
+}
+
+static void show_battery() {
+	if(batteryPercentage == 0) label_set(battery_icon, SYMBOL_BATTERY_EMPTY);
+	else if(batteryPercentage <= 25) label_set(battery_icon, SYMBOL_BATTERY_1);
+	else if(batteryPercentage <= 50) label_set(battery_icon, SYMBOL_BATTERY_2);
+	else if(batteryPercentage <= 75) label_set(battery_icon, SYMBOL_BATTERY_3);
+	else label_set(battery_icon, SYMBOL_BATTERY_FULL);
+}
+
+static void show_volume() {
+	char tmp_str[32];
+	int v = getVolumePercentage();
+	if(v == 0) sprintf(tmp_str, "%s0%%", SYMBOL_MUTE);
+	else sprintf(tmp_str, "%s%i%%", SYMBOL_VOLUME_MAX, v);
+	label_set(volume, tmp_str);
+}
+
+static void show_play_state() {
+	if(playerState.started == false) label_set(playing_icon, SYMBOL_STOP);
+	else label_set(playing_icon, isPaused() ? SYMBOL_PAUSE : SYMBOL_PLAY);
+}
+
+static void show_wifi() {
+	label_set(wifi_icon, wifi_connected ? SYMBOL_WIFI : " ");
+}
+
+static void show_scan() {
+	char tmp_str[32];
+	scanProgress_t scan;
+	library_scan_progress(&scan);
+	if(scan.running) sprintf(tmp_str, "%s%i%%", SYMBOL_REFRESH, scan.percent);
+	else strcpy(tmp_str, " ");
+	label_set(scan_text, tmp_str);
+}
+
+static void show_status() {
+	show_battery();
+	show_volume();
+	show_play_state();
+	show_wifi();
+	show_scan();
+}
+
+static void show_time() {
+	char tmp_str[32];
+	sprintf(tmp_str, "%i:%02i / %i:%02i", playerState.currentTime / 60
+									, playerState.currentTime % 60
+									, playerState.totalTime / 60
+									, playerState.totalTime % 60);
+	label_set(time_text, tmp_str);
+	int v = 0;
+	if(playerState.totalTime != 0)
+		v = (int)((double)playerState.currentTime / (double)playerState.totalTime * 100);
+	if(lv_bar_get_value(time_bar) != v) lv_bar_set_value(time_bar, v);
+}
+
+static void show_track_info() {
+	char tmp_str[32];
+	sprintf(tmp_str, "%iHz %i-Bit", playerState.sampleRate, playerState.bitsPerSample);
+	label_set(sample_info, tmp_str);
+	show_time();
+}
+
+static void show_track() {
+	label_set(now_playing, playerState.title);
+	label_set(author, playerState.author);
+	label_set(album, playerState.album);
+	cover_request(playerState.fileName);
+}
+
+static void show_cover() {
+	const lv_img_t *cover;
+	if(cover_poll(&cover) == true) lv_img_set_src(img_cover, cover != NULL ? cover : &default_cover);
+}
+
+static void skip_track(int step) {
+	playerState.started = false;
+	switch(playerState.playMode) {
+		case PLAYMODE_RANDOM:
+			srand(time(NULL));
+			nowplay_offset = rand() % playlist_len;
+		break;
+		case PLAYMODE_REPEAT_PLAYLIST:
+			nowplay_offset += step;
+			if(nowplay_offset > playlist_len) nowplay_offset = 0;
+			if(nowplay_offset < 0) nowplay_offset = playlist_len - 1;
+		break;
+		case PLAYMODE_REPEAT:break;
+		default:break;
+	}
+	show_play_state();
+}
+
+//menu navigation, acted on when the key is released
+static void ui_key(uint32_t key) {
+	bool hold = (key & UI_KEY_LONG) != 0;
+	key &= ~UI_KEY_LONG;
+	switch(menuID) {
+		case 1: //Library
+			switch(key) {
+				case LV_GROUP_KEY_ESC:
+					menuID = 0;
+					clear_screen();
+					drawHomeScreen();
+				break;
+				case LV_GROUP_KEY_DOWN:
+					list_pos++;
+					library_bind();
+				break;
+				case LV_GROUP_KEY_UP:
+					list_pos = max(list_pos - 1, 0);
+					library_bind();
+				break;
+				case LV_GROUP_KEY_NEXT:
+					list_offset += LIBRARY_ROWS;
+					list_pos += LIBRARY_ROWS;
+					library_bind();
+				break;
+				case LV_GROUP_KEY_PREV:
+					list_offset = max(list_offset - LIBRARY_ROWS, 0);
+					list_pos = max(list_pos - LIBRARY_ROWS, 0);
+					library_bind();
+				break;
+				case LV_GROUP_KEY_ENTER:
+					if(library_ids[list_pos - list_offset] != MUSICDB_NONE)
+						onclick_library(library_rows[list_pos - list_offset]);
+				break;
+			}
+		break;
+
+		case 4: //now playing
+			switch(key) {
+				case LV_GROUP_KEY_UP:
+					if(getVolumePercentage() >= 90) setVolume(100);
+					else setVolume(getVolumePercentage() + 10);
+				break;
+				case LV_GROUP_KEY_DOWN:
+					if(getVolumePercentage() <= 10) setVolume(0);
+					else setVolume(getVolumePercentage() - 10);
+				break;
+				//held down they seek inside the track instead
+				case LV_GROUP_KEY_PREV:
+					if(hold) player_seek(playerState.currentTime - SEEK_STEP);
+					else skip_track(1);
+				break;
+				case LV_GROUP_KEY_NEXT:
+					if(hold) player_seek(playerState.currentTime + SEEK_STEP);
+					else skip_track(-1);
+				break;
+				case LV_GROUP_KEY_ESC:
+					menuID = 0;
+					clear_screen();
+					drawHomeScreen();
+				break;
+			}
+		break;
+		default:break;
+	}
+}
+
 void taskUI_Char(void *parameter) {
 	th = lv_theme_material_init(210, NULL);
 	lv_theme_set_current(th);
@@ -331,148 +458,48 @@ void taskUI_Char(void *parameter) {
 	lv_group_set_style_mod_cb(group, style_mod_cb);
 	drawHomeScreen();
 
-	lv_indev_state_t l_state = LV_INDEV_STATE_REL;
+	show_status();
+	uiEvent_t e;
 	while(1) {
-		if(batteryPercentage == 0) lv_label_set_text(battery_icon, SYMBOL_BATTERY_EMPTY);
-		else if(batteryPercentage <=25) lv_label_set_text(battery_icon, SYMBOL_BATTERY_1);
-		else if(batteryPercentage > 25 && batteryPercentage <= 50) lv_label_set_text(battery_icon, SYMBOL_BATTERY_2);
-		else if(batteryPercentage > 50 && batteryPercentage <= 75) lv_label_set_text(battery_icon, SYMBOL_BATTERY_3);
-		else lv_label_set_text(battery_icon, SYMBOL_BATTERY_FULL);
-
-		char tmp_str[32];
-		// memset(tmp_str, 0, sizeof(tmp_str));
-		// sprintf(tmp_str, "%i%%", batteryPercentage);
-		// lv_label_set_text(battery_text, tmp_str);
-
-		memset(tmp_str, 0, sizeof(tmp_str));
-		int v = getVolumePercentage();
-		if(v == 0) sprintf(tmp_str, "%s0%%", SYMBOL_MUTE);
-		else sprintf(tmp_str, "%s%i%%", SYMBOL_VOLUME_MAX, v);
-		lv_label_set_text(volume, tmp_str);
-
-		if(playerState.started == false) lv_label_set_text(playing_icon, SYMBOL_STOP);
-		else lv_label_set_text(playing_icon, isPaused() ? SYMBOL_PAUSE : SYMBOL_PLAY);
-		lv_label_set_text(wifi_icon, wifi_connected ? SYMBOL_WIFI : " ");
-
-		lv_indev_data_t i_data;
-		lv_indev_read(keypad_indev, &i_data);
-		switch(menuID) {
-			case 0: // home screen
+		if(ui_event_wait(&e, portMAX_DELAY) == false) continue;
+		switch(e.type) {
+			case UI_EVENT_KEY: ui_key(e.value); break;
+			case UI_EVENT_BATTERY: show_battery(); break;
+			case UI_EVENT_VOLUME: show_volume(); break;
+			case UI_EVENT_PLAY_STATE: show_play_state(); break;
+			case UI_EVENT_WIFI: show_wifi(); break;
+			case UI_EVENT_SCAN:
+				show_scan();
+				//rows that were empty fill up as the scan finds tracks
+				if(menuID == 1) library_bind();
 			break;
-
-			case 1: //Library
-				if(l_state == LV_INDEV_STATE_PR && i_data.state == LV_INDEV_STATE_REL) {
-					switch (i_data.key) {
-						case LV_GROUP_KEY_ESC:
-							menuID = 0;
-							clear_screen();
-							drawHomeScreen();
-						break;
-						case LV_GROUP_KEY_NEXT:
-							list_offset += 4;
-							if(list_offset >= playlist_len - 4 - 1)
-								list_offset = playlist_len - 4 - 1;
-							clear_screen();
-							drawLibrary();
-						break;
-						case LV_GROUP_KEY_PREV:
-							list_offset -= 4;
-							if(list_offset <= 3)
-								list_offset = 0;
-							clear_screen();
-							drawLibrary();
-						break;
-					}
-				}
+			case UI_EVENT_TRACK:
+				if(menuID == 4) show_track();
 			break;
-
-			case 2:
-
+			case UI_EVENT_TRACK_INFO:
+				if(menuID == 4) show_track_info();
 			break;
-
-			case 3:
-
+			case UI_EVENT_TIME:
+				if(menuID == 4) show_time();
 			break;
-
-			case 4: //now playing
-				memset(tmp_str, 0, sizeof(tmp_str));
-				sprintf(tmp_str, "%i:%02i / %i:%02i", playerState.currentTime / 60
-												, playerState.currentTime % 60
-												, playerState.totalTime / 60
-												, playerState.totalTime & 60);
-				lv_label_set_text(time_text, tmp_str);
-				if(playerState.totalTime != 0)
-					lv_bar_set_value(time_bar, (int)((double)playerState.currentTime / (double)playerState.totalTime * 100));
-				else lv_bar_set_value(time_bar, 0);
-
-				memset(tmp_str, 0, sizeof(tmp_str));
-				sprintf(tmp_str, "%iHz %i-Bit", playerState.sampleRate, playerState.bitsPerSample);
-				lv_label_set_text(sample_info, tmp_str);
-
-				if(playerState.musicChanged == true) {
-					lv_label_set_text(now_playing, playerState.title);
-					lv_label_set_text(author, playerState.author);
-					lv_label_set_text(album, playerState.album);
-					playerState.musicChanged = false;
+			case UI_EVENT_COVER:
+				if(menuID == 4) show_cover();
+			break;
+			default:
+				show_status();
+				if(menuID == 1) library_bind();
+				if(menuID == 4) {
+					show_track_info();
+					show_cover();
 				}
-
-				if(l_state == LV_INDEV_STATE_PR && i_data.state == LV_INDEV_STATE_REL) {
-					switch (i_data.key) {
-						case LV_GROUP_KEY_UP:
-							if(getVolumePercentage() >= 90) setVolume(100);
-							else setVolume(getVolumePercentage() + 10);
-						break;
-						case LV_GROUP_KEY_DOWN:
-							if(getVolumePercentage() <= 10) setVolume(0);
-							else setVolume(getVolumePercentage() - 10);
-						break;
-						case LV_GROUP_KEY_PREV:
-							playerState.started = false;
-							switch(playerState.playMode) {
-				        case PLAYMODE_RANDOM:
-				          srand(time(NULL));
-				          nowplay_offset = rand() % playlist_len;
-				        break;
-				        case PLAYMODE_REPEAT_PLAYLIST:
-				          nowplay_offset++;
-				          if(nowplay_offset > playlist_len) nowplay_offset = 0;
-				        break;
-				        case PLAYMODE_REPEAT:break;
-				        default:break;
-				      }
-						break;
-						case LV_GROUP_KEY_NEXT:
-							playerState.started = false;
-							switch(playerState.playMode) {
-				        case PLAYMODE_RANDOM:
-				          srand(time(NULL));
-				          nowplay_offset = rand() % playlist_len;
-				        break;
-				        case PLAYMODE_REPEAT_PLAYLIST:
-				          nowplay_offset--;
-				          if(nowplay_offset < 0) nowplay_offset = playlist_len - 1;
-				        break;
-				        case PLAYMODE_REPEAT:break;
-				        default:break;
-				      }
-						break;
-						case LV_GROUP_KEY_ESC:
-							menuID = 0;
-							clear_screen();
-							drawHomeScreen();
-						break;
-					}
-   			}
 			break;
-			default:break;
 		}
-		l_state = i_data.state;
-		vTaskDelay(50 / portTICK_RATE_MS);
 	}
 }
 
 void wifi_set_stat(bool c) {
 	wifi_connected = c;
+	ui_post(UI_EVENT_WIFI, c);
 }
 
 static lv_res_t onclick_homelist(lv_obj_t * list_btn) {
@@ -496,19 +523,12 @@ static lv_res_t onclick_homelist(lv_obj_t * list_btn) {
 }
 
 static lv_res_t onclick_library(lv_obj_t * list_btn) {
-	char *fn = lv_list_get_btn_text(list_btn), tmp_title[MUSICDB_TITLE_LEN];
+	char *fn = lv_list_get_btn_text(list_btn);
 	ESP_LOGI(TAG, "Now playing: %s", fn);
-	FILE *db = fopen("/sdcard/music_list.db", "rb");
-	for(int i = list_offset; i < list_offset + 4; ++i) {
-		fseek(db, i * (MUSICDB_FN_LEN + MUSICDB_TITLE_LEN) + MUSICDB_FN_LEN, SEEK_SET);
-		fread(tmp_title, 1, MUSICDB_TITLE_LEN, db);
-		if(strcmp(tmp_title, fn) == 0) {
-			nowplay_offset = i;
-			break;
-		}
-	}
+	nowplay_offset = lv_obj_get_free_num(list_btn);
 	player_pause(false);
 	playerState.started = false;
+	ui_post(UI_EVENT_PLAY_STATE, 0);
 
 	return LV_RES_OK;
 }
@@ -4,6 +4,13 @@
 #ifndef min
   #define min(a,b) (((a) < (b)) ? (a) : (b))
 #endif
+#ifndef max
+  #define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#define LIBRARY_ROWS 4 //rows of the library list, one title each
+#define LIBRARY_WINDOW 32 //titles read ahead around the rows
+#define SEEK_STEP 10 //seconds a long press on NEXT/PREV seeks by
 
 extern lv_obj_t *img_cover, *info_obj, *now_playing, *author, *album, *sample_info, *time_text, *time_bar, *playmode;
 
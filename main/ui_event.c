@@ -0,0 +1,33 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include <stdbool.h>
+#include "esp_err.h"
+
+#include "ui_event.h"
+
+static QueueHandle_t uiQueue = NULL;
+static volatile bool dropped;
+
+esp_err_t ui_event_init(void) {
+  uiQueue = xQueueCreate(UI_EVENT_QUEUE_LEN, sizeof(uiEvent_t));
+  if(uiQueue == NULL) return ESP_ERR_NO_MEM;
+  return ESP_OK;
+}
+
+/* a full queue drops the event, the UI is told to redraw everything
+ * instead of a producer being held up by the display */
+void ui_post(uiEventType_t type, int32_t value) {
+  uiEvent_t e = {type, value};
+  if(uiQueue == NULL) return;
+  if(xQueueSend(uiQueue, &e, 0) != pdPASS) dropped = true;
+}
+
+bool ui_event_wait(uiEvent_t *e, TickType_t timeout) {
+  if(dropped == true) {
+    dropped = false;
+    e->type = UI_EVENT_RESYNC;
+    e->value = 0;
+    return true;
+  }
+  return xQueueReceive(uiQueue, e, timeout) == pdPASS;
+}
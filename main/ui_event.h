@@ -0,0 +1,38 @@
+#ifndef _UI_EVENT_H_
+#define _UI_EVENT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+
+#define UI_EVENT_QUEUE_LEN 32
+#define UI_KEY_LONG 0x10000 //or'ed into the key of a UI_EVENT_KEY that was held
+
+/* what changed, the UI reads the new state from where it is kept.
+ * value carries the key for UI_EVENT_KEY and is informational otherwise */
+typedef enum {
+  UI_EVENT_RESYNC = 0, //events were dropped, everything is redrawn
+  UI_EVENT_KEY, //a key was released
+  UI_EVENT_BATTERY,
+  UI_EVENT_VOLUME,
+  UI_EVENT_PLAY_STATE, //paused or started
+  UI_EVENT_WIFI,
+  UI_EVENT_SCAN, //progress or a longer library
+  UI_EVENT_TRACK, //title, author and album of a new track
+  UI_EVENT_TRACK_INFO, //length, sample rate and bits
+  UI_EVENT_TIME, //the play position moved by a second
+  UI_EVENT_COVER //cover_poll() has a cover
+} uiEventType_t;
+
+typedef struct {
+  uiEventType_t type;
+  int32_t value;
+} uiEvent_t;
+
+/* any task can post, ui_post() never blocks. the UI task is the only one
+ * waiting */
+esp_err_t ui_event_init(void);
+void ui_post(uiEventType_t type, int32_t value);
+bool ui_event_wait(uiEvent_t *e, TickType_t timeout);
+#endif